@@ -1,13 +1,13 @@
 /**********************************************************************************
-// App (Arquivo de Cabealho)
+// App (Arquivo de Cabeçalho)
 // 
-// Criao:		11 Jan 2020
-// Atualizao:	09 Jul 2023
+// Criação:		11 Jan 2020
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	Uma classe abstrata para representar uma aplicao
-//              Todas as aplicaes derivadas da classe App devem
-//              sobrescrever os mtodos Init, Update e Finalize. 
+// Descrição:	Uma classe abstrata para representar uma aplicação
+//              Todas as aplicações derivadas da classe App devem
+//              sobrescrever os métodos Init, Update e Finalize. 
 //
 **********************************************************************************/
 
@@ -19,42 +19,65 @@
 #include "Graphics.h"
 #include "Window.h"
 #include "Input.h"
+#include <thread>
+#include <chrono>
 
 // ---------------------------------------------------------------------------------
 
 class App
 {
-	// Membros protegidos so privados para o mundo externo mas
-	// pblicos para as classes derivadas, ou seja, as classes
-	// derivadas de App sero capazes de acessar estes membros.
+	// Membros protegidos são privados para o mundo externo mas
+	// públicos para as classes derivadas, ou seja, as classes
+	// derivadas de App serão capazes de acessar estes membros.
 
 protected:
-	static Graphics*& graphics;					// componente grfico
-	static Window*& window;						// janela da aplicao
+	static Graphics*& graphics;					// componente gráfico
+	static Window*& window;						// janela da aplicação
 	static Input*& input;						// dispositivos de entrada
-	static double& frameTime;					// tempo do ltimo quadro
+	static double& frameTime;					// tempo do último quadro
+	static double& fixedTime;					// duração do passo fixo (0 = desativado)
+	static double& interpolation;				// fração do passo fixo já transcorrida
 
 public:
 	App();										// construtor
 	virtual ~App();								// destrutor
 
-	// Estes mtodos so puramente virtuais, isto , devem ser 
+	// Estes métodos são puramente virtuais, isto é, devem ser 
 	// implementados em todas as classes derivas de App.
 
-	virtual void Init() = 0;					// inicializao
-	virtual void Update() = 0;					// atualizao
-	virtual void Finalize() = 0;				// finalizao	
+	virtual void Init() = 0;					// inicialização
+	virtual void Update() = 0;					// atualização
+	virtual void FixedUpdate() {}				// passo da simulação
+	virtual void Finalize() = 0;				// finalização	
 
-	// Estes mtodos possuem uma implementao vazia por padro
+	// Estes métodos possuem uma implementação vazia por padrão
 	// e apenas um deles deve ser sobrescrito na classe derivada:
-	// - Draw  executado a cada ciclo do lao principal
-	// - Display  chamado apenas uma vez no incio da aplicao
+	// - Draw é executado a cada ciclo do laço principal
+	// - Display é chamado apenas uma vez no início da aplicação
 	//   e deve ser chamado manualmente em Update toda vez
 	//   que a tela precisar ser redesenhada.
+	// No modo sob demanda (Engine::OnDemand) Update e Draw rodam
+	// apenas após eventos; animações chamam Engine::Invalidate.
+	// Com Engine::RenderThread, Draw roda em outra thread junto
+	// com o Update seguinte: Draw lê apenas a cópia da cena que
+	// Update publica (TripleBuffer) e Update só grava comandos
+	// entre ResetCommands e SubmitCommands. Criar ou destruir
+	// malhas dispensa os dois: as cópias seguem na fila de cópia.
 
 	virtual void Draw() {}						// desenho
-	virtual void Display() {}					// exibio
-	virtual void OnPause() { Sleep(10); }		// em pausa
+	virtual void Display() {}					// exibição
+	virtual void OnPause() { std::this_thread::sleep_for(std::chrono::milliseconds(10)); }	// em pausa
+
+	// FixedUpdate avança a simulação em passos de fixedTime segundos,
+	// zero ou mais vezes por quadro, antes de Update. Deve usar apenas
+	// KeyDown: um passo pode não ocorrer no quadro de um KeyPress.
+	// Update desenha interpolando o último passo com interpolation.
+	// Sem passo fixo, FixedUpdate roda uma vez por quadro (interpolation = 1).
+
+	// Resumo do estado da cena usado para comparar execuções
+	// reproduzidas a partir da mesma entrada gravada.
+
+	virtual ullong Hash() { return 0; }			// hash do estado da cena
 };
 
 // ---------------------------------------------------------------------------------
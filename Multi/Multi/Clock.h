@@ -0,0 +1,41 @@
+/**********************************************************************************
+// Clock (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Isola o contador de alta precisão da plataforma. No Windows
+//              usa QueryPerformanceCounter e nas demais plataformas usa o
+//              relógio monotônico (clock_gettime), permitindo que Timer e
+//              o código da CPU compilem fora do Windows.
+//
+**********************************************************************************/
+
+#ifndef DXUT_CLOCK_H_
+#define DXUT_CLOCK_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+
+// -------------------------------------------------------------------------------
+
+class Clock
+{
+public:
+    static llong Counter();                         // valor atual do contador
+    static llong Frequency();                       // ciclos do contador por segundo
+    static double Seconds();                        // valor atual do contador em segundos
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// valor atual do contador convertido em segundos
+inline double Clock::Seconds()
+{ return double(Counter()) / double(Frequency()); }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,109 @@
+/**********************************************************************************
+// CopyBatches (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Controla os lotes de cópia enviados à fila de cópia da GPU:
+//              o rodízio dos alocadores, o valor de barreira que encerra
+//              cada lote e o último lote exigido pelos recursos em uso, que
+//              a fila de desenho precisa aguardar. Não depende do Direct3D:
+//              quem usa executa as esperas e sinalizações na GPU.
+//
+**********************************************************************************/
+
+#ifndef DXUT_COPYBATCHES_H_
+#define DXUT_COPYBATCHES_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <atomic>
+using std::atomic;
+
+// -------------------------------------------------------------------------------
+
+class CopyBatches
+{
+public:
+    static const uint Allocators = 3;               // lotes de cópia em execução simultânea
+
+private:
+    ullong allocFence[Allocators];                  // barreira do último lote de cada alocador
+    uint   allocIndex;                              // alocador do lote atual
+    bool   open;                                    // lote atual recebendo comandos
+    ullong submitted;                               // último lote submetido
+    atomic<ullong> required;                        // lote exigido pelos recursos em uso
+    ullong waited;                                  // último lote aguardado pela fila de desenho
+
+public:
+    CopyBatches();                                  // construtor
+
+    bool Open() const;                              // lote atual recebendo comandos
+    ullong Begin(uint & allocator);                 // abre lote (retorna barreira a aguardar antes de reiniciar o alocador)
+    ullong Current() const;                         // barreira que encerrará o lote atual
+    ullong Submit();                                // fecha lote (retorna barreira a sinalizar)
+    ullong Submitted() const;                       // último lote submetido
+
+    void Require(ullong batch);                     // recurso em uso depende do lote (qualquer thread)
+    ullong Wait();                                  // lote que a fila de desenho deve aguardar (0 = nenhum)
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+inline CopyBatches::CopyBatches()
+    : allocIndex(0), open(false), submitted(0), required(0), waited(0)
+{
+    for (uint i = 0; i < Allocators; ++i)
+        allocFence[i] = 0;
+}
+
+inline bool CopyBatches::Open() const
+{ return open; }
+
+// o alocador só pode ser reiniciado depois que seu último lote terminar
+inline ullong CopyBatches::Begin(uint & allocator)
+{
+    allocIndex = (allocIndex + 1) % Allocators;
+    allocator = allocIndex;
+    open = true;
+    return allocFence[allocIndex];
+}
+
+// cópias gravadas no lote aberto terminam com a próxima barreira
+inline ullong CopyBatches::Current() const
+{ return submitted + 1; }
+
+inline ullong CopyBatches::Submit()
+{
+    allocFence[allocIndex] = ++submitted;
+    open = false;
+    return submitted;
+}
+
+inline ullong CopyBatches::Submitted() const
+{ return submitted; }
+
+// pode ser chamado pelas threads de gravação
+inline void CopyBatches::Require(ullong batch)
+{
+    ullong current = required;
+    while (current < batch && !required.compare_exchange_weak(current, batch));
+}
+
+// cada lote é aguardado uma única vez: as esperas seguintes são implícitas
+inline ullong CopyBatches::Wait()
+{
+    ullong batch = required;
+    if (batch <= waited)
+        return 0;
+
+    waited = batch;
+    return batch;
+}
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// DXUT (Arquivo de Cabealho)
+// DXUT (Arquivo de Cabeçalho)
 //
-// Criao:     04 Jan 2020
-// Atualizao: 09 Set 2023
+// Criação:     04 Jan 2020
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Arquivo mestre para o DirectX Utility Toolkit (DXUT)
+// Descrição:   Arquivo mestre para o DirectX Utility Toolkit (DXUT)
 //
 **********************************************************************************/
 
@@ -23,8 +23,14 @@
 #include "Mesh.h"
 #include "Geometry.h"
 #include "Object.h"
+#include "TripleBuffer.h"
+#include "Rasterizer.h"
+#include "Occlusion.h"
+#include "Meshlet.h"
+#include "Parametric.h"
+#include "HalfEdge.h"
 
-// Cabealhos do DirectX 
+// Cabeçalhos do DirectX 
 #include <D3DCompiler.h>
 #include <DirectXMath.h>
 #include <DirectXColors.h>
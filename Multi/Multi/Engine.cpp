@@ -1,31 +1,83 @@
 /**********************************************************************************
-// Engine (Cdigo Fonte)
+// Engine (Código Fonte)
 //
-// Criao:		15 Mai 2014
-// Atualizao:	26 Jul 2023
+// Criação:		15 Mai 2014
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	A Engine roda aplicaes criadas a partir da classe App.
-//              Para usar a Engine crie uma instncia e chame o mtodo
+// Descrição:	A Engine roda aplicações criadas a partir da classe App.
+//              Para usar a Engine crie uma instância e chame o método
 //				Start() com um objeto derivado da classe App.
+//              Fora do Windows roda com a janela fora da tela, a
+//              entrada postada e o dispositivo gráfico nulo.
 //
 **********************************************************************************/
 
 #include "Engine.h"
-#include <windows.h>
 #include <sstream>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <thread>
 using std::stringstream;
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+static const uint INFINITE = 0xFFFFFFFF;	// espera sem prazo
+#endif
+
+// ------------------------------------------------------------------------------
+
+// tempo de CPU do processo (usuário + núcleo) em segundos
+static double ProcessTime()
+{
+#ifdef _WIN32
+	FILETIME creation, exit, kernel, user;
+	GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user);
+	auto seconds = [](FILETIME t) { return ((ullong(t.dwHighDateTime) << 32) | t.dwLowDateTime) * 1e-7; };
+	return seconds(kernel) + seconds(user);
+#else
+	timespec cpu;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpu);
+	return cpu.tv_sec + cpu.tv_nsec * 1e-9;
+#endif
+}
+
 // ------------------------------------------------------------------------------
-// Inicializao de variveis estticas da classe
+// Inicialização de variáveis estáticas da classe
 
-Graphics* Engine::graphics  = nullptr;	// dispositivo grfico
-Window*   Engine::window    = nullptr;	// janela da aplicao
+Graphics* Engine::graphics  = nullptr;	// dispositivo gráfico
+Window*   Engine::window    = nullptr;	// janela da aplicação
 Input*    Engine::input     = nullptr;	// dispositivos de entrada
-App*      Engine::app       = nullptr;	// apontadador da aplicao
+App*      Engine::app       = nullptr;	// apontadador da aplicação
 double    Engine::frameTime = 0.0;		// tempo do quadro atual
+Telemetry* Engine::telemetry = nullptr;	// tempos dos quadros recentes
+double    Engine::fixedTime = 0.0;		// duração do passo fixo
+double    Engine::interpolation = 1.0;	// fração do passo fixo já transcorrida
+Stepper   Engine::stepper;			// acumulador dos passos fixos
+bool      Engine::onDemand  = false;	// desenha apenas quando algo muda
+bool      Engine::dirty     = true;		// quadro precisa ser desenhado
+bool      Engine::threaded  = false;	// Draw roda em uma thread própria
+double    Engine::workload  = 0.0;		// carga artificial em Update e Draw
 bool      Engine::paused    = false;	// estado do motor
 Timer     Engine::timer;				// medidor de tempo
+Pacer     Engine::pacer;				// limitador da taxa de quadros
+
+// -------------------------------------------------------------------------------
+
+// ocupa a CPU por alguns segundos (carga artificial das medições)
+static void Spin(double secs)
+{
+	if (secs <= 0.0)
+		return;
+
+	double end = Clock::Seconds() + secs;
+	while (Clock::Seconds() < end);
+}
 
 // -------------------------------------------------------------------------------
 
@@ -33,6 +85,18 @@ Engine::Engine()
 {
 	window = new Window();
 	graphics = new Graphics();
+	telemetry = new Telemetry();
+	synthetic = 0;
+	inputEvents = 0;
+	exitCode = 0;
+
+	published = 0;
+	drawn = 0;
+	rendering = false;
+	drawTime = 0.0;
+	drawPresent = 0.0;
+	frameInput = 0.0;
+	drawInput = 0.0;
 }
 
 // -------------------------------------------------------------------------------
@@ -43,6 +107,7 @@ Engine::~Engine()
 	delete graphics;
 	delete input;
 	delete window;
+	delete telemetry;
 }
 
 // -----------------------------------------------------------------------------
@@ -51,17 +116,19 @@ int Engine::Start(App * application)
 {
 	app = application;
 
-	// cria janela da aplicao
+	// cria janela da aplicação
 	window->Create();
 
-	// inicializa dispositivos de entrada (deve ser feito aps criao da janela)
+	// inicializa dispositivos de entrada (deve ser feito após criação da janela)
 	input = new Input();
 
-	// inicializa dispositivo grfico
+	// inicializa dispositivo gráfico
 	graphics->Initialize(window);
 
+#ifdef _WIN32
 	// altera a window procedure da janela ativa para EngineProc
 	SetWindowLongPtr(window->Id(), GWLP_WNDPROC, (LONG_PTR)EngineProc);
+#endif
 
 	return Loop();
 }
@@ -71,7 +138,7 @@ int Engine::Start(App * application)
 double Engine::FrameTime()
 {
 
-#ifdef _DEBUG
+#if defined(_DEBUG) && defined(_WIN32)
 	static double totalTime = 0.0;	// tempo total transcorrido 
 	static uint   frameCount = 0;	// contador de frames transcorridos
 #endif
@@ -79,7 +146,7 @@ double Engine::FrameTime()
 	// tempo do frame atual
 	frameTime = timer.Reset();
 
-#ifdef _DEBUG
+#if defined(_DEBUG) && defined(_WIN32)
 	// tempo acumulado dos frames
 	totalTime += frameTime;
 
@@ -90,12 +157,14 @@ double Engine::FrameTime()
 	if (totalTime >= 1.0)
 	{
 		stringstream text;			// fluxo de texto para mensagens
-		text << std::fixed;			// sempre mostra a parte fracionria
-		text.precision(3);			// trs casas depois da vrgula
+		text << std::fixed;			// sempre mostra a parte fracionária
+		text.precision(3);			// três casas depois da vírgula
 
 		text << window->Title().c_str() << "    "
 			<< "FPS: " << frameCount << "    "
-			<< "Frame Time: " << frameTime * 1000 << " (ms)";
+			<< "Frame Time: " << frameTime * 1000 << " (ms)" << "    "
+			<< "GPU: " << graphics->LiveResources() << " recursos, "
+			<< graphics->LiveBytes() / 1048576.0 << " (MB)";
 
 		SetWindowText(window->Id(), text.str().c_str());
 
@@ -113,66 +182,560 @@ int Engine::Loop()
 {
 	// inicia contagem de tempo
 	timer.Start();
+	Timer total;
+	total.Start();
+	double cpuStart = ProcessTime();
 	
-	// mensagens do Windows
-	MSG msg = { 0 };
-	
-	// inicializao da aplicao
+	// inicialização da aplicação
 	app->Init();
+	StartRenderer();
 
-	// lao principal
-	do
+	// laço principal
+	for (;;)
 	{
-		// trata todos os eventos antes de atualizar a aplicao
-		if (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+		// trata todos os eventos pendentes antes de atualizar a aplicação
+		if (!Drain())
+			break;
+
+		// -----------------------------------------------
+		// Pausa/Resume Jogo
+		// -----------------------------------------------
+
+		if (input->KeyPress(VK_PAUSE))
+		{
+			if (paused)
+				Resume();
+			else
+				Pause();
+		}
+
+		// grava os tempos dos quadros recentes sob demanda
+		if (input->KeyPress(VK_F12))
+			telemetry->Export(telemetry->Output().empty() ? "Telemetry.csv" : telemetry->Output());
+
+		// -----------------------------------------------
+
+		if (!paused && onDemand && !dirty)
+		{
+			// nada mudou: dorme até o próximo evento (ou até a GPU
+			// terminar o trabalho que ainda segura recursos)
+			Idle(!rendering && graphics->PendingReleases() ? 16 : INFINITE);
+		}
+		else if (!paused)
 		{
-			TranslateMessage(&msg);
-			DispatchMessage(&msg);
+			// a aplicação chama Invalidate para continuar animando
+			dirty = false;
+
+			// calcula o tempo do quadro
+			frameTime = FrameTime();
+
+			// simulação e atualização da aplicação 
+			ProfileMark update = graphics->Profile()->BeginCpu("Update");
+			Simulate();
+			app->Update();
+			Spin(workload);
+			graphics->Profile()->EndCpu(update);
+			double updated = graphics->Profile()->Now();
+
+			// desenho da aplicação (ou entrega à thread de desenho)
+			double draw, present;
+			Render(draw, present);
+
+			// registra tempos do quadro (Present é separado do Draw)
+			telemetry->Add(updated - update.start, draw, present);
+
+			// segura o quadro até o fim do período alvo
+			pacer.Wait();
+
+			// eventos seguintes pertencem ao próximo quadro
+			Input::NextFrame();
 		}
 		else
 		{
-			// -----------------------------------------------
-			// Pausa/Resume Jogo
-			// -----------------------------------------------
+			app->OnPause();
+		}
+	}
 
-			if (input->KeyPress(VK_PAUSE))
-			{
-				if (paused)
-					Resume();
-				else
-					Pause();
-			}
+	// finalização do aplicação
+	StopRenderer();
+	app->Finalize();	
 
-			// -----------------------------------------------
+	// grava os tempos dos quadros recentes no encerramento
+	if (!telemetry->Output().empty())
+		telemetry->Export(telemetry->Output());
 
-			if (!paused)
-			{
-				// calcula o tempo do quadro
-				frameTime = FrameTime();
+	// ritmo dos últimos quadros e ocupação da CPU com a taxa limitada
+	if (pacer.Rate() > 0.0)
+	{
+		PaceStats pace = pacer.Stats();
+		char text[256];
+		snprintf(text, sizeof(text),
+			"---> Ritmo: %.0f fps  Desvio P50: %.3f ms  P99: %.3f ms  Margem: %.3f ms  Giro: %.1f%% (%s)  CPU: %.1f%%\n",
+			pacer.Rate(), pace.p50 * 1000.0, pace.p99 * 1000.0, pace.margin * 1000.0,
+			pace.spin * 100.0, pacer.Sleeper(), 100.0 * (ProcessTime() - cpuStart) / total.Elapsed());
+		Print(text);
+	}
 
-				// atualizao da aplicao 
-				app->Update();
+#ifdef _DEBUG
+	// grava os últimos quadros medidos para o chrome://tracing
+	graphics->Profile()->Export("Trace.json");
+#endif
 
-				// desenho da aplicao
-				app->Draw();
-			}
-			else
+	// encerra aplicação
+	return exitCode;
+}
+
+// -------------------------------------------------------------------------------
+
+bool Engine::Drain()
+{
+#ifdef _WIN32
+	// mensagens que chegam durante a drenagem ficam para o próximo
+	// quadro, para que um fluxo contínuo não impeça o desenho
+	DWORD start = GetTickCount();
+	MSG msg = { 0 };
+
+	while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE))
+	{
+		if (msg.message == WM_QUIT)
+		{
+			exitCode = int(msg.wParam);
+			return false;
+		}
+
+		TranslateMessage(&msg);
+		DispatchMessage(&msg);
+
+		// entrada e eventos da janela podem mudar a cena
+		dirty = true;
+
+		if (int(msg.time - start) > 0)
+			break;
+	}
+#else
+	// sem sistema de janelas: o fechamento é pedido pela aplicação
+	if (window->Closed())
+		return false;
+#endif
+
+	// eventos postados por outras threads (entrada sintética)
+	if (Input::Poll())
+		dirty = true;
+
+	return true;
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::Simulate()
+{
+	// passos fixos (ou um passo por quadro, sem passo fixo)
+	stepper.Advance(frameTime, [] { app->FixedUpdate(); });
+	interpolation = stepper.Interpolation();
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::Render(double & draw, double & present)
+{
+	if (!rendering)
+	{
+		ProfileMark mark = graphics->Profile()->BeginCpu("Draw");
+		app->Draw();
+		Spin(workload);
+		graphics->Profile()->EndCpu(mark);
+
+		// Present é separado do Draw
+		present = graphics->PresentTime();
+		draw = graphics->Profile()->Now() - mark.start - present;
+
+		// latência termina com o quadro apresentado
+		if (frameInput > 0.0)
+			latency.push_back(Clock::Seconds() - frameInput);
+		return;
+	}
+
+	std::unique_lock<mutex> lock(renderLock);
+
+	// entrega o quadro e espera o anterior: o próximo Update
+	// roda junto com este desenho, no máximo um quadro à frente;
+	// um quadro substituído antes de ser desenhado passa a sua
+	// entrada mais antiga para o que o substitui
+	if (frameInput > 0.0 && (drawInput == 0.0 || frameInput < drawInput))
+		drawInput = frameInput;
+	++published;
+	renderSignal.notify_all();
+	renderSignal.wait(lock, [this] { return drawn + 1 >= published; });
+
+	// tempos do último quadro concluído
+	draw = drawTime;
+	present = drawPresent;
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::RenderLoop()
+{
+	std::unique_lock<mutex> lock(renderLock);
+
+	for (;;)
+	{
+		renderSignal.wait(lock, [this] { return published > drawn || !rendering; });
+
+		// encerra apenas depois de desenhar o último quadro publicado
+		if (published == drawn)
+			break;
+
+		ullong frame = published;
+		double input = drawInput;
+		drawInput = 0.0;
+		lock.unlock();
+
+		ProfileMark mark = graphics->Profile()->BeginCpu("Draw");
+		app->Draw();
+		Spin(workload);
+		graphics->Profile()->EndCpu(mark);
+
+		double present = graphics->PresentTime();
+		double draw = graphics->Profile()->Now() - mark.start - present;
+
+		// latência do quadro medida depois do Present na thread de desenho
+		double end = Clock::Seconds();
+
+		lock.lock();
+		drawn = frame;
+		drawTime = draw;
+		drawPresent = present;
+		if (input > 0.0)
+			latency.push_back(end - input);
+		renderSignal.notify_all();
+	}
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::StartRenderer()
+{
+	if (!threaded || rendering)
+		return;
+
+	rendering = true;
+	renderer = thread(&Engine::RenderLoop, this);
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::StopRenderer()
+{
+	if (!rendering)
+		return;
+
+	{
+		std::lock_guard<mutex> lock(renderLock);
+		rendering = false;
+	}
+
+	renderSignal.notify_all();
+	renderer.join();
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::Idle(uint timeout)
+{
+#ifdef _WIN32
+	// acorda com qualquer mensagem na fila da thread
+	MsgWaitForMultipleObjects(0, nullptr, FALSE, timeout, QS_ALLINPUT);
+#else
+	// acorda com qualquer evento postado por outra thread
+	Input::Wait(timeout);
+#endif
+
+	// libera recursos que a GPU terminou de usar
+	// (com a thread de desenho, Present faz isso)
+	if (!rendering)
+		graphics->Collect();
+
+	// tempo ocioso não entra no próximo quadro
+	timer.Reset();
+}
+
+// -------------------------------------------------------------------------------
+
+int Engine::Headless(App * application, uint frames, double secs, double dt)
+{
+	app = application;
+
+	// No Windows a janela existe apenas para a swap chain e nunca é exibida:
+	// o dispositivo Direct3D continua sendo criado (na GPU ou no WARP). Nas
+	// demais plataformas a janela é uma superfície fora da tela e o
+	// dispositivo nulo descarta os comandos gravados, sem GPU.
+	window->Create();
+#ifdef _WIN32
+	ShowWindow(window->Id(), SW_HIDE);
+#endif
+
+	// entrada vem do roteiro, não do usuário
+	input = new Input();
+
+	// inicializa dispositivo gráfico
+	graphics->Initialize(window);
+#ifdef _WIN32
+	SetWindowLongPtr(window->Id(), GWLP_WNDPROC, (LONG_PTR)EngineProc);
+#endif
+
+	// tempo de CPU de cada quadro
+	vector<double> times;
+	times.reserve(frames);
+
+	// ordena o roteiro por quadro
+	std::stable_sort(script.begin(), script.end(),
+		[](const InputEvent & a, const InputEvent & b) { return a.frame < b.frame; });
+
+	Timer total;
+	Timer cpu;
+	uint next = 0;
+
+	timer.Start();
+	total.Start();
+
+	// sob demanda nenhum quadro está pendente no início: desenha apenas
+	// após entrada, roteiro ou Invalidate (que Init também pode chamar)
+	dirty = false;
+	app->Init();
+	StartRenderer();
+	double cpuStart = ProcessTime();
+
+	// gerador de eventos: uma thread posta movimentos do mouse na fila
+	// da janela (ou na fila da entrada, fora do Windows), como um mouse
+	// de alta taxa de amostragem
+	std::atomic<bool> generating = synthetic > 0;
+	std::thread generator;
+	if (synthetic)
+	{
+		generator = std::thread([this, &generating]()
+		{
+			auto interval = std::chrono::duration<double>(1.0 / synthetic);
+			auto next = std::chrono::steady_clock::now();
+			for (int i = 0; generating; ++i)
 			{
-				app->OnPause();
+				// cada evento leva o instante em que foi gerado
+#ifdef _WIN32
+				PostMessage(window->Id(), WM_SYNTHETIC_MOVE, WPARAM(Clock::Counter()), MAKELPARAM(i & 0x1ff, (i >> 9) & 0x1ff));
+#else
+				Input::Post({ 0, 0, false, INPUT_MOVE, i & 0x1ff, (i >> 9) & 0x1ff, Clock::Seconds() });
+#endif
+				next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval);
+				std::this_thread::sleep_until(next);
 			}
+		});
+	}
+
+	// executa até atingir o número de quadros ou o tempo limite (0 = sem limite)
+	for (uint frame = 0; (frames == 0 || frame < frames) && (secs == 0.0 || !total.Elapsed(secs)); ++frame)
+	{
+		// mensagens da janela oculta (e do gerador de eventos sintéticos)
+		if (!Drain())
+			break;
+
+		// aplica os eventos roteirizados para este quadro
+		while (next < script.size() && script[next].frame <= frame)
+		{
+			Input::Script(script[next++]);
+			dirty = true;
+		}
+
+		// nada mudou: espera um período de quadro sem desenhar
+		if (onDemand && !dirty)
+		{
+			Idle(uint(dt * 1000.0));
+			Input::NextFrame();
+			continue;
 		}
 
-	} while (msg.message != WM_QUIT);
+		dirty = false;
+
+		// tempo de quadro fixo: a simulação não depende da velocidade da máquina
+		FrameTime();
+		frameTime = dt;
+
+		cpu.Start();
+		Simulate();
+		app->Update();
+		Spin(workload);
+		double update = cpu.Elapsed();
+
+		// latência da entrada: da geração do evento mais antigo do quadro
+		// até o Present do quadro que o consome (medida em Render ou na
+		// thread de desenho)
+		const vector<InputEvent> & events = input->Events();
+		frameInput = 0.0;
+		for (const InputEvent & e : events)
+			if (frameInput == 0.0 || e.time < frameInput)
+				frameInput = e.time;
+		inputEvents += events.size();
+
+		double draw, present;
+		Render(draw, present);
+		double total = cpu.Elapsed();
+		times.push_back(total);
+		telemetry->Add(update, draw, present);
+
+		pacer.Wait();
+		Input::NextFrame();
+	}
 
-	// finalizao do aplicao
-	app->Finalize();	
+	generating = false;
+	if (generator.joinable())
+		generator.join();
+
+	StopRenderer();
+
+	// ocupação da CPU durante os quadros (100% = um núcleo inteiro)
+	double wall = total.Elapsed();
+	double usage = 100.0 * (ProcessTime() - cpuStart) / wall;
+
+	// estado final da cena identifica a execução
+	ullong hash = app->Hash();
+	app->Finalize();
 
-	// encerra aplicao
-	return int(msg.wParam);
+	if (!telemetry->Output().empty())
+		telemetry->Export(telemetry->Output());
+
+	Report(times, hash, usage, wall);
+	return 0;
 }
 
 // -------------------------------------------------------------------------------
 
+void Engine::Report(vector<double> & times, ullong hash, double usage, double wall)
+{
+	// no modo sob demanda uma execução ociosa pode não desenhar nada
+	size_t frames = times.size();
+	if (times.empty())
+		times.push_back(0.0);
+
+	double sum = 0.0;
+	for (double t : times)
+		sum += t;
+
+	// percentis sobre os tempos ordenados
+	std::sort(times.begin(), times.end());
+	auto percentile = [&](double p) { return times[size_t(p * (times.size() - 1))] * 1000.0; };
+
+	char text[1024];
+	snprintf(text, sizeof(text),
+		"---> Quadros: %zu  Média: %.3f ms  Mín: %.3f ms  P50: %.3f ms  P95: %.3f ms  P99: %.3f ms  Máx: %.3f ms  Engasgos: %llu  Cena: %016llx\n",
+		frames, sum / times.size() * 1000.0,
+		times.front() * 1000.0, percentile(0.50), percentile(0.95), percentile(0.99), times.back() * 1000.0,
+		telemetry->Hitches(), hash);
+
+	// passos da simulação mostram quanto atraso foi descartado
+	if (fixedTime > 0.0)
+	{
+		size_t length = strlen(text) - 1;
+		snprintf(text + length, sizeof(text) - length,
+			"  Passos: %llu  Descartados: %llu\n", stepper.Steps(), stepper.Skipped());
+	}
+
+	// desvio dos intervalos em relação à taxa alvo
+	if (pacer.Rate() > 0.0)
+	{
+		PaceStats pace = pacer.Stats();
+		size_t length = strlen(text) - 1;
+		snprintf(text + length, sizeof(text) - length,
+			"  Ritmo: %.0f fps  Desvio P50: %.3f ms  P99: %.3f ms  Margem: %.3f ms  Giro: %.1f%% (%s)\n",
+			pacer.Rate(), pace.p50 * 1000.0, pace.p99 * 1000.0, pace.margin * 1000.0,
+			pace.spin * 100.0, pacer.Sleeper());
+	}
+
+	// eventos de entrada agrupados por quadro e sua latência
+	if (!latency.empty())
+	{
+		std::sort(latency.begin(), latency.end());
+		double average = 0.0;
+		for (double l : latency)
+			average += l;
+		average /= latency.size();
+
+		size_t length = strlen(text) - 1;
+		snprintf(text + length, sizeof(text) - length,
+			"  Entrada: %llu eventos em %zu quadros  Latência média: %.3f ms  P99: %.3f ms\n",
+			inputEvents, latency.size(), average * 1000.0,
+			latency[size_t(0.99 * (latency.size() - 1))] * 1000.0);
+	}
+
+#ifndef _WIN32
+	// volume de comandos descartados pelo dispositivo nulo
+	if (graphics->Frames())
+	{
+		size_t length = strlen(text) - 1;
+		snprintf(text + length, sizeof(text) - length,
+			"  Comandos: %.0f por quadro (%.1f KB)\n",
+			double(graphics->Commands()) / graphics->Frames(),
+			double(graphics->Bytes()) / graphics->Frames() / 1024.0);
+	}
+#endif
+
+	// quadros desenhados e ocupação da CPU medem o custo de ficar ocioso
+	size_t length = strlen(text) - 1;
+	snprintf(text + length, sizeof(text) - length,
+		"  Vazão: %.1f quadros/s  CPU: %.1f%%%s%s\n", frames / wall, usage,
+		onDemand ? "  (sob demanda)" : "", threaded ? "  (thread de desenho)" : "");
+
+	Print(text);
+}
+
+// -------------------------------------------------------------------------------
+
+void Engine::Print(const char * text)
+{
+#ifndef _WIN32
+	// fora do Windows a saída padrão é o console
+	fputs(text, stdout);
+	fflush(stdout);
+#else
+	OutputDebugString(text);
+
+	// execuções automatizadas leem o console de quem iniciou o processo
+	static bool console = []
+	{
+		FILE * out;
+		return AttachConsole(ATTACH_PARENT_PROCESS) && freopen_s(&out, "CONOUT$", "w", stdout) == 0;
+	}();
+
+	if (console)
+	{
+		fputs(text, stdout);
+		fflush(stdout);
+	}
+#endif
+}
+
+// -------------------------------------------------------------------------------
+
+string Engine::Option(const char * cmdLine, const char * name)
+{
+	const char * option = strstr(cmdLine, name);
+	if (!option)
+		return string();
+
+	// valor vai do primeiro caractere após os espaços até o próximo espaço
+	const char * value = option + strlen(name);
+	while (*value == ' ')
+		++value;
+
+	const char * end = value;
+	while (*end && *end != ' ')
+		++end;
+
+	return string(value, end);
+}
+
+// -------------------------------------------------------------------------------
+
+#ifdef _WIN32
+
 LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
 	switch (msg)
@@ -184,7 +747,7 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 		
 	case WM_GETMINMAXINFO:
 	{
-		// ajusta tamanho mnimo da janela
+		// ajusta tamanho mínimo da janela
 		LPMINMAXINFO lpMMI = (LPMINMAXINFO)lParam;
 		lpMMI->ptMinTrackSize.x = window->MinWidth();
 		lpMMI->ptMinTrackSize.y = window->MinHeight();
@@ -204,7 +767,7 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 
 	case WM_SIZING:
 	{
-		// novas dimenses da janela
+		// novas dimensões da janela
 		LPRECT resize = (LPRECT)lParam;
 		uint width = resize->right - resize->left;
 		uint height = resize->bottom - resize->top;
@@ -212,8 +775,8 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 		// redimensionamento da janela
 		if (window->ResizeMode() == ASPECTRATIO)
 		{
-			// mantm o aspect ratio original
-			// de acordo com o canto que est
+			// mantém o aspect ratio original
+			// de acordo com o canto que está
 			// sendo usado para redimensionar
 			switch (wParam)
 			{
@@ -226,7 +789,7 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 				// se a coordenada saiu da tela
 				if (resize->top < 0)
 				{
-					// mantm a janela dentro da tela
+					// mantém a janela dentro da tela
 					resize->top = 0;
 
 					// calcula nova largura para manter o aspect ratio
@@ -252,7 +815,7 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 				// se a coordenada saiu da tela
 				if (resize->bottom > window->ScreenHeight())
 				{
-					// mantm a janela dentro da tela
+					// mantém a janela dentro da tela
 					resize->bottom = window->ScreenHeight();
 
 					// calcula nova largura para manter o aspect ratio
@@ -276,7 +839,7 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 				// se a coordenada saiu da tela
 				if (resize->right > window->ScreenWidth())
 				{
-					// mantm a janela dentro da tela
+					// mantém a janela dentro da tela
 					resize->right = window->ScreenWidth();
 
 					// calcula nova altura para manter o aspect ratio
@@ -303,4 +866,6 @@ LRESULT CALLBACK Engine::EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM l
 	return CallWindowProc(Input::InputProc, hWnd, msg, wParam, lParam);
 }
 
+#endif
+
 // -----------------------------------------------------------------------------
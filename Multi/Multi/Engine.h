@@ -1,13 +1,15 @@
 /**********************************************************************************
-// Engine (Arquivo de Cabealho)
+// Engine (Arquivo de Cabeçalho)
 //
-// Criao:		15 Mai 2014
-// Atualizao:	26 Jul 2023
+// Criação:		15 Mai 2014
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	A Engine roda aplicaes criadas a partir da classe App. 			
-//              Para usar a Engine crie uma instncia e chame o mtodo
+// Descrição:	A Engine roda aplicações criadas a partir da classe App. 			
+//              Para usar a Engine crie uma instância e chame o método
 //				Start() com um objeto derivado da classe App.
+//              Fora do Windows roda com a janela fora da tela, a
+//              entrada postada e o dispositivo gráfico nulo.
 //
 **********************************************************************************/
 
@@ -16,11 +18,22 @@
 
 // ---------------------------------------------------------------------------------
 
-#include "Graphics.h"					// dispositivo grfico
-#include "Window.h"						// janela da aplicao
+#include "Graphics.h"					// dispositivo gráfico
+#include "Window.h"						// janela da aplicação
 #include "Input.h"						// dispositivo de entrada
 #include "Timer.h"						// medidor de tempo
-#include "App.h"						// aplicao grfica
+#include "App.h"						// aplicação gráfica
+#include "Telemetry.h"					// tempos dos quadros recentes
+#include "Pacer.h"						// limitador da taxa de quadros
+#include "Stepper.h"					// simulação em passos fixos
+#include <vector>						// tempos e roteiro da execução sem janela
+#include <thread>						// thread de desenho
+#include <mutex>						// sincronização com a thread de desenho
+#include <condition_variable>			// sinal de quadro publicado ou desenhado
+using std::vector;
+using std::thread;
+using std::mutex;
+using std::condition_variable;
 
 // ---------------------------------------------------------------------------------
 
@@ -28,32 +41,86 @@ class Engine
 {
 private:
 	static Timer timer;                 // medidor de tempo
-	static bool paused;                 // estado do aplicao
+	static Pacer pacer;                 // limitador da taxa de quadros
+	static bool paused;                 // estado do aplicação
+	static Stepper stepper;             // acumulador dos passos fixos
+	static bool onDemand;               // desenha apenas quando algo muda
+	static bool dirty;                  // quadro precisa ser desenhado
+	static bool threaded;               // Draw roda em uma thread própria
+	static double workload;             // carga artificial em Update e Draw (segundos)
+
+	vector<InputEvent> script;          // entrada roteirizada da execução sem janela
+	uint synthetic;                     // movimentos do mouse gerados por segundo
+	vector<double> latency;             // atraso entre a geração do evento e o Present do quadro
+	double frameInput;                  // geração do evento mais antigo do quadro (0 = nenhum)
+	ullong inputEvents;                 // eventos entregues aos quadros medidos
+	int exitCode;                       // código de saída da aplicação
+
+	thread renderer;                    // thread de desenho
+	mutex renderLock;                   // protege o estado compartilhado com o desenho
+	condition_variable renderSignal;    // quadro publicado ou desenhado
+	ullong published;                   // quadros produzidos por Update
+	ullong drawn;                       // quadros concluídos por Draw
+	bool rendering;                     // thread de desenho ativa
+	double drawTime;                    // tempo de Draw do último quadro desenhado
+	double drawPresent;                 // tempo de Present do último quadro desenhado
+	double drawInput;                   // evento mais antigo do quadro publicado (0 = nenhum)
 
 	double FrameTime();                 // calcula o tempo do quadro
-	int Loop();                         // inicia lao principal do motor
+	int Loop();                         // inicia laço principal do motor
+	bool Drain();                       // trata as mensagens pendentes (false = fim da aplicação)
+	void Simulate();                    // executa os passos fixos do quadro
+	void Render(double & draw, double & present);	// desenha ou entrega o quadro à thread de desenho
+	void RenderLoop();                  // laço da thread de desenho
+	void StartRenderer();               // cria a thread de desenho (se ativada)
+	void StopRenderer();                // conclui o último quadro e encerra a thread
+	void Idle(uint timeout);            // bloqueia até um evento ou o fim do prazo (ms)
+	void Report(vector<double> & times, ullong hash, double usage, double wall);	// mostra estatísticas dos quadros medidos
 
 public:
-	static Graphics* graphics;          // dispositivo grfico
-	static Window* window;              // janela da aplicao
-	static Input* input;                // entrada da aplicao
-	static App* app;                    // aplicao a ser executada
+	static Graphics* graphics;          // dispositivo gráfico
+	static Window* window;              // janela da aplicação
+	static Input* input;                // entrada da aplicação
+	static App* app;                    // aplicação a ser executada
 	static double frameTime;            // tempo do quadro atual
+	static double fixedTime;            // duração do passo fixo (0 = desativado)
+	static double interpolation;        // fração do passo fixo já transcorrida
+	static Telemetry* telemetry;        // tempos de CPU dos quadros recentes
 
 	Engine();                           // construtor
 	~Engine();                          // destrutor
 
-	int Start(App * application);       // inicia o execuo da aplicao
+	int Start(App * application);       // inicia o execução da aplicação
+	int Headless(App * application,
+		uint frames, double secs = 0.0,
+		double dt = 1.0 / 60.0);        // executa sem janela visível e mede os quadros
+	void Script(const vector<InputEvent> & events);	// define entrada roteirizada
+	void Synthetic(uint rate);			// gera movimentos do mouse na execução sem janela
+	const vector<double> & Latency();	// latências da entrada medidas na execução sem janela
+
+	// valor da opção "name valor" na linha de comando (vazio se ausente)
+	static string Option(const char * cmdLine, const char * name);
+
+	// escreve no depurador e no console de quem iniciou o processo
+	static void Print(const char * text);
 	
+	static void FixedStep(double step, uint limit = 5);	// ativa simulação em passos fixos
+	static void FrameRate(double fps);  // limita a taxa de quadros (0 = sem limite)
+	static void RenderThread(bool enable);	// desenha em paralelo com o próximo Update
+	static void Workload(double secs);  // soma carga artificial a Update e Draw
+	static void OnDemand(bool enable);  // desenha apenas em resposta a eventos
+	static void Invalidate();           // pede um novo quadro no modo sob demanda
 	static void Pause();                // pausa o motor
 	static void Resume();               // reinicia o motor
 
+#ifdef _WIN32
 	// trata eventos do Windows
 	static LRESULT CALLBACK EngineProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+#endif
 };
 
 // -----------------------------------------------------------------------------
-// Funes Inline
+// Funções Inline
 
 inline void Engine::Pause()
 { paused = true; timer.Stop(); }
@@ -61,6 +128,33 @@ inline void Engine::Pause()
 inline void Engine::Resume()
 { paused = false; timer.Start(); }
 
+inline void Engine::FixedStep(double step, uint limit)
+{ fixedTime = step; stepper.Fixed(step, limit); interpolation = stepper.Interpolation(); }
+
+inline void Engine::FrameRate(double fps)
+{ pacer.Rate(fps); }
+
+inline void Engine::RenderThread(bool enable)
+{ threaded = enable; }
+
+inline void Engine::Workload(double secs)
+{ workload = secs; }
+
+inline void Engine::OnDemand(bool enable)
+{ onDemand = enable; dirty = true; }
+
+inline void Engine::Invalidate()
+{ dirty = true; }
+
+inline void Engine::Script(const vector<InputEvent> & events)
+{ script = events; }
+
+inline void Engine::Synthetic(uint rate)
+{ synthetic = rate; }
+
+inline const vector<double> & Engine::Latency()
+{ return latency; }
+
 // ---------------------------------------------------------------------------------
 
 #endif
\ No newline at end of file
@@ -1,15 +1,25 @@
 /**********************************************************************************
-// Geometry (Cdigo Fonte)
+// Geometry (Código Fonte)
 //
-// Criao:     03 Fev 2013
-// Atualizao: 10 Set 2023
+// Criação:     03 Fev 2013
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Define vrtices e ndices para vrias geometrias
+// Descrição:   Define vértices e índices para várias geometrias
 //
 **********************************************************************************/
 
 #include "Geometry.h"
+#include "HalfEdge.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+#include <emmintrin.h>
 
 //   __________   _____   __________   ________   ___________   ______   ______
 // _/ Geometry \_/ Box \_/ Cylinder \_/ Sphere \_/ GeoSphere \_/ Grid \_/ Quad \_
@@ -21,24 +31,37 @@
 
 void Geometry::Subdivide()
 {
-    // salva uma cpia da geometria original
+    PROFILE_SCOPE("Subdivide");
+
+    // níveis de detalhe, grupos, arestas e normais deixariam de corresponder aos triângulos
+    indices.resize(OriginalCount());
+    lods.clear();
+    meshlets.clear();
+    edges = {};
+    normals.clear();
+
+    // salva uma cópia da geometria original
     vector <Vertex> verticesCopy = vertices;
     vector <uint> indicesCopy = indices;
 
     vertices.resize(0);
     indices.resize(0);
 
-    //       v1
-    //       *
-    //      / \
-    //     /   \
-    //  m0*-----*m1
-    //   / \   / \
-    //  /   \ /   \
-    // *-----*-----*
-    // v0    m2     v2
+    /*       v1
+             *
+            / \
+           /   \
+        m0*-----*m1
+         / \   / \
+        /   \ /   \
+       *-----*-----*
+       v0    m2     v2
+    */
 
     uint numTris = (uint)indicesCopy.size() / 3;
+    vertices.reserve(size_t(numTris) * 6);
+    indices.reserve(size_t(numTris) * 12);
+
     for (uint i = 0; i < numTris; ++i)
     {
         Vertex v0 = verticesCopy[indicesCopy[size_t(i) * 3 + 0]];
@@ -77,239 +100,1213 @@ void Geometry::Subdivide()
     }
 }
 
-//                _____
-// ______________/ Box \_________________________________________________________
 // ------------------------------------------------------------------------------
 
-Box::Box(float width, float height, float depth)
+// quádrica do erro: soma dos quadrados das distâncias a um conjunto de planos
+struct Quadric
 {
-    float w = 0.5f * width;
-    float h = 0.5f * height;
-    float d = 0.5f * depth;
+    double q[10] = {};                      // aa ab ac ad bb bc bd cc cd dd
 
-    // cria os vrtices da geometria
-    Vertex boxVertices[8] =
-    {
-        { XMFLOAT3(-w, -h, -d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(-w, +h, -d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, +h, -d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, -h, -d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(-w, -h, +d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(-w, +h, +d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, +h, +d), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, -h, +d), XMFLOAT4(Colors::Yellow) }
-    };
+    void Add(double a, double b, double c, double d, double weight)
+    {
+        double p[4] = { a, b, c, d };
+        uint k = 0;
+        for (uint i = 0; i < 4; ++i)
+            for (uint j = i; j < 4; ++j)
+                q[k++] += weight * p[i] * p[j];
+    }
+
+    void Add(const Quadric & other)
+    {
+        for (uint i = 0; i < 10; ++i)
+            q[i] += other.q[i];
+    }
+
+    double Error(const XMFLOAT3 & p) const
+    {
+        double x = p.x, y = p.y, z = p.z;
+        double e = q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x
+                 + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y
+                 + q[7] * z * z + 2 * q[8] * z + q[9];
+        return e > 0.0 ? e : 0.0;
+    }
+};
+
+// contração de aresta candidata: from desaparece e suas faces passam para to
+struct Collapse
+{
+    double cost;                            // erro da quádrica na posição de to
+    uint from, to;                          // vértices da aresta
+    uint stampFrom, stampTo;                // versões dos vértices ao calcular o custo
+
+    bool operator>(const Collapse & other) const
+    { return cost > other.cost; }
+};
+
+// posições iguais (com -0 igual a +0) caem no mesmo vértice unido
+struct PositionHash
+{
+    size_t operator()(const XMFLOAT3 & p) const
+    {
+        float c[3] = { p.x + 0.0f, p.y + 0.0f, p.z + 0.0f };
+        uint bits[3];
+        memcpy(bits, c, sizeof(bits));
+        return size_t(bits[0]) * 73856093u ^ size_t(bits[1]) * 19349663u ^ size_t(bits[2]) * 83492791u;
+    }
+};
+
+struct PositionEqual
+{
+    bool operator()(const XMFLOAT3 & a, const XMFLOAT3 & b) const
+    { return a.x == b.x && a.y == b.y && a.z == b.z; }
+};
+
+// ------------------------------------------------------------------------------
+
+void Geometry::Simplify(uint levels, float ratio)
+{
+    PROFILE_SCOPE("Simplify");
+
+    // recomeça a partir do original (grupos e arestas precisam ser refeitos)
+    indices.resize(OriginalCount());
+    lods.clear();
+    meshlets.clear();
+    edges = {};
+
+    uint baseCount = uint(indices.size()) / 3 * 3;
+    lods.push_back({ 0, baseCount, 0.0f });
+
+    if (baseCount == 0 || levels == 0)
+        return;
+
+    // une vértices na mesma posição: costuras de cor ou de
+    // geometrias subdivididas não abrem buracos ao simplificar
+    std::unordered_map<XMFLOAT3, uint, PositionHash, PositionEqual> unique;
+    vector<uint> weld(vertices.size());
+    vector<uint> first;                     // vértice original de cada posição
+    vector<XMFLOAT3> pos;                   // posição de cada vértice unido
+
+    for (uint i = 0; i < vertices.size(); ++i)
+    {
+        auto found = unique.emplace(vertices[i].pos, uint(first.size()));
+        if (found.second)
+        {
+            first.push_back(i);
+            pos.push_back(vertices[i].pos);
+        }
+        weld[i] = found.first->second;
+    }
+
+    uint count = uint(first.size());
+
+    // faces em vértices unidos, sem as degeneradas
+    vector<uint> faces;
+    for (uint i = 0; i < baseCount; i += 3)
+    {
+        uint a = weld[indices[i]], b = weld[indices[i + 1]], c = weld[indices[i + 2]];
+        if (a != b && b != c && a != c)
+            faces.insert(faces.end(), { a, b, c });
+    }
 
-    // insere vrtices na malha
-    for (const Vertex & v : boxVertices)
-        vertices.push_back(v);
+    uint faceCount = uint(faces.size()) / 3;
+    vector<vector<uint>> incident(count);
+    for (uint f = 0; f < faceCount; ++f)
+        for (uint k = 0; k < 3; ++k)
+            incident[faces[f * 3 + k]].push_back(f);
 
-    // ndices indicam como os vrtices so interligados
-    uint boxIndices[36] =
+    // normal (não normalizada) da face com um vértice opcionalmente trocado
+    auto cross = [&](uint f, uint from, uint to)
     {
-        // front face
-        0, 1, 2,
-        0, 2, 3,
+        XMFLOAT3 p[3];
+        for (uint k = 0; k < 3; ++k)
+            p[k] = pos[faces[f * 3 + k] == from ? to : faces[f * 3 + k]];
+
+        XMVECTOR n = XMVector3Cross(
+            XMVectorSubtract(XMLoadFloat3(&p[1]), XMLoadFloat3(&p[0])),
+            XMVectorSubtract(XMLoadFloat3(&p[2]), XMLoadFloat3(&p[0])));
+        return n;
+    };
 
-        // back face
-        4, 7, 5,
-        7, 6, 5,
+    // quádricas dos planos das faces e das bordas abertas
+    vector<Quadric> quadrics(count);
+    std::unordered_map<ullong, uint> edges;
+    for (uint f = 0; f < faceCount; ++f)
+    {
+        XMVECTOR n = XMVector3Normalize(cross(f, 0, 0));
+        XMFLOAT3 normal;
+        XMStoreFloat3(&normal, n);
+        double d = -XMVectorGetX(XMVector3Dot(n, XMLoadFloat3(&pos[faces[f * 3]])));
 
-        // left face
-        4, 5, 1,
-        4, 1, 0,
+        for (uint k = 0; k < 3; ++k)
+        {
+            quadrics[faces[f * 3 + k]].Add(normal.x, normal.y, normal.z, d, 1.0);
 
-        // right face
-        3, 2, 6,
-        3, 6, 7,
+            uint a = faces[f * 3 + k], b = faces[f * 3 + (k + 1) % 3];
+            ++edges[ullong(std::min(a, b)) << 32 | std::max(a, b)];
+        }
+    }
+
+    // bordas ganham um plano perpendicular à face para não encolherem
+    for (uint f = 0; f < faceCount; ++f)
+    {
+        XMVECTOR n = XMVector3Normalize(cross(f, 0, 0));
+        for (uint k = 0; k < 3; ++k)
+        {
+            uint a = faces[f * 3 + k], b = faces[f * 3 + (k + 1) % 3];
+            if (edges[ullong(std::min(a, b)) << 32 | std::max(a, b)] != 1)
+                continue;
+
+            XMVECTOR pa = XMLoadFloat3(&pos[a]);
+            XMVECTOR side = XMVector3Normalize(XMVector3Cross(XMVectorSubtract(XMLoadFloat3(&pos[b]), pa), n));
+            XMFLOAT3 s;
+            XMStoreFloat3(&s, side);
+            double d = -XMVectorGetX(XMVector3Dot(side, pa));
+
+            quadrics[a].Add(s.x, s.y, s.z, d, 10.0);
+            quadrics[b].Add(s.x, s.y, s.z, d, 10.0);
+        }
+    }
 
-        // top face
-        1, 5, 6,
-        1, 6, 2,
+    // fila de contrações pela menor direção de cada aresta
+    std::priority_queue<Collapse, vector<Collapse>, std::greater<Collapse>> queue;
+    vector<uint> stamp(count, 0);
+    vector<bool> dead(count, false);
+    vector<bool> removed(faceCount, false);
 
-        // bottom face
-        4, 0, 3,
-        4, 3, 7
+    auto candidate = [&](uint a, uint b)
+    {
+        Quadric q = quadrics[a];
+        q.Add(quadrics[b]);
+        double toB = q.Error(pos[b]);
+        double toA = q.Error(pos[a]);
+
+        if (toB <= toA)
+            queue.push({ toB, a, b, stamp[a], stamp[b] });
+        else
+            queue.push({ toA, b, a, stamp[b], stamp[a] });
     };
 
-    // insere ndices na malha
-    for (ushort i : boxIndices)
-        indices.push_back(i);
+    for (uint f = 0; f < faceCount; ++f)
+        for (uint k = 0; k < 3; ++k)
+        {
+            uint a = faces[f * 3 + k], b = faces[f * 3 + (k + 1) % 3];
+            if (a < b)
+                candidate(a, b);
+        }
+
+    vector<uint> mark(count, 0);
+    uint collapses = 0;
+    uint alive = faceCount;
+    uint previous = faceCount;
+    double maxCost = 0.0;
+
+    for (uint level = 1; level <= levels; ++level)
+    {
+        uint goal = uint(faceCount * std::pow(ratio, float(level)));
+
+        while (alive > goal && !queue.empty())
+        {
+            Collapse c = queue.top();
+            queue.pop();
+
+            // custos calculados antes de contrações vizinhas estão vencidos
+            if (dead[c.from] || dead[c.to] || stamp[c.from] != c.stampFrom || stamp[c.to] != c.stampTo)
+                continue;
+
+            // a contração não pode virar nenhuma face que sobrevive
+            bool flips = false;
+            for (uint f : incident[c.from])
+            {
+                if (removed[f])
+                    continue;
+
+                uint * v = &faces[f * 3];
+                if (v[0] == c.to || v[1] == c.to || v[2] == c.to)
+                    continue;
+
+                XMVECTOR before = cross(f, 0, 0);
+                XMVECTOR after = cross(f, c.from, c.to);
+                float dot = XMVectorGetX(XMVector3Dot(before, after));
+                if (dot <= 0.0f || XMVectorGetX(XMVector3LengthSq(after)) == 0.0f)
+                {
+                    flips = true;
+                    break;
+                }
+            }
+
+            if (flips)
+                continue;
+
+            // faces com a aresta somem, as demais passam para to
+            for (uint f : incident[c.from])
+            {
+                if (removed[f])
+                    continue;
+
+                uint * v = &faces[f * 3];
+                if (v[0] == c.to || v[1] == c.to || v[2] == c.to)
+                {
+                    removed[f] = true;
+                    --alive;
+                    continue;
+                }
+
+                for (uint k = 0; k < 3; ++k)
+                    if (v[k] == c.from)
+                        v[k] = c.to;
+                incident[c.to].push_back(f);
+            }
+
+            incident[c.from].clear();
+            dead[c.from] = true;
+            quadrics[c.to].Add(quadrics[c.from]);
+            ++stamp[c.to];
+            maxCost = std::max(maxCost, c.cost);
+
+            // descarta faces removidas e recalcula as arestas de to
+            vector<uint> & around = incident[c.to];
+            around.erase(std::remove_if(around.begin(), around.end(),
+                [&](uint f) { return removed[f]; }), around.end());
+
+            // cada vizinho aparece em duas faces: entra na fila uma vez
+            ++collapses;
+            for (uint f : around)
+                for (uint k = 0; k < 3; ++k)
+                {
+                    uint v = faces[f * 3 + k];
+                    if (v != c.to && mark[v] != collapses)
+                    {
+                        mark[v] = collapses;
+                        candidate(c.to, v);
+                    }
+                }
+        }
+
+        // nada mais pode ser contraído sem virar faces
+        if (alive == previous)
+            break;
+
+        uint start = uint(indices.size());
+        for (uint f = 0; f < faceCount; ++f)
+            if (!removed[f])
+                for (uint k = 0; k < 3; ++k)
+                    indices.push_back(first[faces[f * 3 + k]]);
+
+        lods.push_back({ start, uint(indices.size()) - start, float(std::sqrt(maxCost)) });
+        previous = alive;
+    }
 }
 
-//                        __________
-// ______________________/ Cylinder \____________________________________________
 // ------------------------------------------------------------------------------
 
-Cylinder::Cylinder(float bottom, float top, float height, uint sliceCount, uint stackCount)
+void Geometry::Clusterize(uint maxVertices, uint maxTriangles)
 {
-    // altura de uma camada
-    float stackHeight = height / stackCount;
+    PROFILE_SCOPE("Clusterize");
 
-    // incremento no raio de cada camada
-    float radiusStep = (top - bottom) / stackCount;
+    // refaz os grupos a partir do original (arestas depois deles são deslocadas)
+    if (!meshlets.empty())
+    {
+        uint start = meshlets[0].startIndex;
+        uint end = meshlets.back().startIndex + meshlets.back().indexCount;
+        indices.erase(indices.begin() + start, indices.begin() + end);
+        if (edges.indexCount && edges.startIndex >= end)
+            edges.startIndex -= end - start;
+        meshlets.clear();
+    }
 
-    // nmero de anis do cilindro
-    uint ringCount = stackCount + 1;
+    uint triCount = OriginalCount() / 3;
+    uint vertCount = uint(vertices.size());
+    if (triCount == 0 || maxVertices < 3 || maxTriangles == 0)
+        return;
+
+    // triângulos que usam cada vértice (listas compactas)
+    vector<uint> offsets(size_t(vertCount) + 1, 0);
+    for (uint i = 0; i < triCount * 3; ++i)
+        ++offsets[indices[i] + 1];
+    for (uint v = 0; v < vertCount; ++v)
+        offsets[v + 1] += offsets[v];
+
+    vector<uint> adjacent(size_t(triCount) * 3);
+    vector<uint> fill(offsets.begin(), offsets.end() - 1);
+    for (uint i = 0; i < triCount * 3; ++i)
+        adjacent[fill[indices[i]]++] = i / 3;
+
+    // centro de cada triângulo para manter os grupos compactos
+    vector<XMFLOAT3> centers(triCount);
+    for (uint t = 0; t < triCount; ++t)
+    {
+        const XMFLOAT3 & a = vertices[indices[t * 3]].pos;
+        const XMFLOAT3 & b = vertices[indices[t * 3 + 1]].pos;
+        const XMFLOAT3 & c = vertices[indices[t * 3 + 2]].pos;
+        centers[t] = XMFLOAT3((a.x + b.x + c.x) / 3, (a.y + b.y + c.y) / 3, (a.z + b.z + c.z) / 3);
+    }
 
-    // calcula vrtices de cada anel
-    for (uint i = 0; i < ringCount; ++i)
+    vector<bool> used(triCount, false);
+    vector<uint> slot(vertCount, ~0u);      // posição do vértice no grupo atual
+    vector<uint> members;                   // vértices do grupo atual
+    vector<uint> candidates;                // triângulos vizinhos ao grupo atual
+    uint scan = 0;
+    uint seed = ~0u;
+
+    while (true)
     {
-        float y = -0.5f * height + i * stackHeight;
-        float r = bottom + i * radiusStep;
-        float theta = 2.0f * XM_PI / sliceCount;
+        // começa pelo vizinho deixado pelo grupo anterior ou pelo próximo livre
+        if (seed == ~0u)
+        {
+            while (scan < triCount && used[scan])
+                ++scan;
+            if (scan == triCount)
+                break;
+            seed = scan;
+        }
 
-        for (uint j = 0; j <= sliceCount; ++j)
+        Meshlet meshlet = {};
+        meshlet.startIndex = uint(indices.size());
+        members.clear();
+        candidates.clear();
+        float sum[3] = { 0.0f, 0.0f, 0.0f };
+        uint tri = seed;
+
+        while (tri != ~0u)
+        {
+            // acrescenta o triângulo e os vizinhos de seus vértices novos
+            used[tri] = true;
+            for (uint k = 0; k < 3; ++k)
+            {
+                uint v = indices[tri * 3 + k];
+                indices.push_back(v);
+                if (slot[v] == ~0u)
+                {
+                    slot[v] = uint(members.size());
+                    members.push_back(v);
+                    candidates.insert(candidates.end(), adjacent.begin() + offsets[v], adjacent.begin() + offsets[v + 1]);
+                }
+            }
+            sum[0] += centers[tri].x;
+            sum[1] += centers[tri].y;
+            sum[2] += centers[tri].z;
+            meshlet.indexCount += 3;
+
+            if (meshlet.indexCount / 3 == maxTriangles)
+                break;
+
+            // próximo: menos vértices novos e, no empate, mais perto do centro
+            float n = float(meshlet.indexCount / 3);
+            XMFLOAT3 mid(sum[0] / n, sum[1] / n, sum[2] / n);
+            uint bestNew = 4;
+            float bestDist = 0.0f;
+            tri = ~0u;
+
+            for (uint c = 0; c < candidates.size(); )
+            {
+                uint t = candidates[c];
+                if (used[t])
+                {
+                    candidates[c] = candidates.back();
+                    candidates.pop_back();
+                    continue;
+                }
+                ++c;
+
+                uint fresh = (slot[indices[t * 3]] == ~0u) + (slot[indices[t * 3 + 1]] == ~0u) + (slot[indices[t * 3 + 2]] == ~0u);
+                if (members.size() + fresh > maxVertices || fresh > bestNew)
+                    continue;
+
+                float dx = centers[t].x - mid.x, dy = centers[t].y - mid.y, dz = centers[t].z - mid.z;
+                float dist = dx * dx + dy * dy + dz * dz;
+                if (fresh < bestNew || dist < bestDist)
+                {
+                    bestNew = fresh;
+                    bestDist = dist;
+                    tri = t;
+                }
+            }
+        }
+
+        meshlet.vertexCount = uint(members.size());
+
+        // esfera envolvente: centro da caixa e vértice mais distante
+        XMFLOAT3 lo = vertices[members[0]].pos, hi = lo;
+        for (uint v : members)
+        {
+            const XMFLOAT3 & p = vertices[v].pos;
+            lo = XMFLOAT3(std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z));
+            hi = XMFLOAT3(std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z));
+        }
+        meshlet.center = XMFLOAT3((lo.x + hi.x) * 0.5f, (lo.y + hi.y) * 0.5f, (lo.z + hi.z) * 0.5f);
+        for (uint v : members)
+        {
+            const XMFLOAT3 & p = vertices[v].pos;
+            float dx = p.x - meshlet.center.x, dy = p.y - meshlet.center.y, dz = p.z - meshlet.center.z;
+            meshlet.radius = std::max(meshlet.radius, std::sqrt(dx * dx + dy * dy + dz * dz));
+        }
+
+        // cone das normais (horárias na tela são de frente, como no pipeline)
+        vector<XMFLOAT3> normals;
+        float axis[3] = { 0.0f, 0.0f, 0.0f };
+        for (uint i = meshlet.startIndex; i < meshlet.startIndex + meshlet.indexCount; i += 3)
+        {
+            const XMFLOAT3 & a = vertices[indices[i]].pos;
+            const XMFLOAT3 & b = vertices[indices[i + 1]].pos;
+            const XMFLOAT3 & c = vertices[indices[i + 2]].pos;
+            float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+            float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+            float nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+            float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            if (length == 0.0f)
+                continue;
+            normals.push_back(XMFLOAT3(nx / length, ny / length, nz / length));
+            axis[0] += nx / length;
+            axis[1] += ny / length;
+            axis[2] += nz / length;
+        }
+
+        float length = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+        meshlet.coneCutoff = 1.0f;
+        if (length > 0.0f)
         {
-            float c = cosf(j * theta);
-            float s = sinf(j * theta);
+            meshlet.coneAxis = XMFLOAT3(axis[0] / length, axis[1] / length, axis[2] / length);
+            float spread = 1.0f;
+            for (const XMFLOAT3 & n : normals)
+                spread = std::min(spread, n.x * meshlet.coneAxis.x + n.y * meshlet.coneAxis.y + n.z * meshlet.coneAxis.z);
+
+            // cones mais abertos que ~84 graus quase nunca descartam
+            if (spread > 0.1f)
+                meshlet.coneCutoff = std::sqrt(1.0f - spread * spread);
+        }
 
-            Vertex vertex;
-            vertex.pos = XMFLOAT3(r * c, y, r * s);
-            vertex.color = XMFLOAT4(Colors::Yellow);
-            vertices.push_back(vertex);
+        meshlets.push_back(meshlet);
+
+        // o grupo seguinte começa ao lado deste
+        seed = ~0u;
+        float bestDist = 0.0f;
+        XMFLOAT3 mid = meshlet.center;
+        for (uint t : candidates)
+        {
+            if (used[t])
+                continue;
+            float dx = centers[t].x - mid.x, dy = centers[t].y - mid.y, dz = centers[t].z - mid.z;
+            float dist = dx * dx + dy * dy + dz * dz;
+            if (seed == ~0u || dist < bestDist)
+            {
+                seed = t;
+                bestDist = dist;
+            }
         }
+
+        for (uint v : members)
+            slot[v] = ~0u;
     }
+}
 
-    // nmero de vrtices em cada anel do cilindro
-    uint ringVertexCount = sliceCount + 1;
+// ------------------------------------------------------------------------------
 
-    // calcula ndices para cada camada
-    for (uint i = 0; i < stackCount; ++i)
+uint Geometry::Select(uint current, float pixels, float tolerance, float slack) const
+{
+    // pixels: tamanho na tela de uma unidade do objeto
+    if (lods.size() < 2)
+        return 0;
+
+    uint level = current < lods.size() ? current : uint(lods.size()) - 1;
+
+    // nível atual com desvio visível: passa aos mais detalhados
+    while (level > 0 && lods[level].error * pixels > tolerance)
+        --level;
+
+    // nível mais simples apenas com folga abaixo da tolerância, para
+    // que objetos perto do limite não troquem de nível a cada quadro
+    while (level + 1 < lods.size() && lods[level + 1].error * pixels <= tolerance * slack)
+        ++level;
+
+    return level;
+}
+
+// ------------------------------------------------------------------------------
+
+// atan2(y, x) para y >= 0 em quatro pistas (erro abaixo de 1e-5 radiano)
+static __m128 Angle(__m128 y, __m128 x)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(sign, x);
+
+    // reduz a tangente a [0, 1] e aproxima o arco por polinômio
+    __m128 low = _mm_min_ps(ax, y);
+    __m128 high = _mm_max_ps(ax, y);
+    __m128 a = _mm_and_ps(_mm_div_ps(low, high), _mm_cmpgt_ps(high, zero));
+    __m128 s = _mm_mul_ps(a, a);
+    __m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-0.0464964749f), s), _mm_set1_ps(0.15931422f));
+    r = _mm_sub_ps(_mm_mul_ps(r, s), _mm_set1_ps(0.327622764f));
+    r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(r, s), a), a);
+
+    // desfaz a redução: octante acima da diagonal e x negativo
+    __m128 steep = _mm_cmpgt_ps(y, ax);
+    r = _mm_or_ps(_mm_and_ps(steep, _mm_sub_ps(_mm_set1_ps(XM_PIDIV2), r)), _mm_andnot_ps(steep, r));
+    __m128 back = _mm_cmplt_ps(x, zero);
+    return _mm_or_ps(_mm_and_ps(back, _mm_sub_ps(_mm_set1_ps(XM_PI), r)), _mm_andnot_ps(back, r));
+}
+
+// ------------------------------------------------------------------------------
+
+void Geometry::ComputeNormals(uint weight, float creaseAngle)
+{
+    PROFILE_SCOPE("Normals");
+
+    uint count = OriginalCount() / 3 * 3;
+    uint triCount = count / 3;
+    uint vertCount = uint(vertices.size());
+    uint blocks = (triCount + 3) / 4;
+
+    ThreadPool & pool = ThreadPool::Shared();
+    auto run = [&](uint n, const Task & task)
     {
-        for (uint j = 0; j < sliceCount; ++j)
+        if (triCount >= (1u << 15))
+            pool.Run(pool.Size() * 4, n, task);
+        else
+            task(0, 0, n);
+    };
+
+    // normal unitária de cada triângulo e peso de cada canto,
+    // quatro triângulos por vez com uma coordenada por registro
+    vector<float> faceX(size_t(blocks) * 4);
+    vector<float> faceY(size_t(blocks) * 4);
+    vector<float> faceZ(size_t(blocks) * 4);
+    vector<float> weights(count);
+
+    run(blocks, [&](uint, uint first, uint last)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 one = _mm_set1_ps(1.0f);
+
+        for (uint block = first; block < last; ++block)
         {
-            indices.push_back(i * ringVertexCount + j);
-            indices.push_back((i + 1) * ringVertexCount + j);
-            indices.push_back((i + 1) * ringVertexCount + j + 1);
-            indices.push_back(i * ringVertexCount + j);
-            indices.push_back((i + 1) * ringVertexCount + j + 1);
-            indices.push_back(i * ringVertexCount + j + 1);
+            uint t = block * 4;
+            uint lanes = std::min(4u, triCount - t);
+
+            // p[canto][eixo][triângulo]
+            alignas(16) float p[3][3][4] = {};
+            for (uint lane = 0; lane < lanes; ++lane)
+            {
+                for (uint k = 0; k < 3; ++k)
+                {
+                    const XMFLOAT3 & pos = vertices[indices[(t + lane) * 3 + k]].pos;
+                    p[k][0][lane] = pos.x;
+                    p[k][1][lane] = pos.y;
+                    p[k][2][lane] = pos.z;
+                }
+            }
+
+            // e[k]: aresta que sai do canto k
+            __m128 e[3][3];
+            for (uint axis = 0; axis < 3; ++axis)
+            {
+                __m128 p0 = _mm_load_ps(p[0][axis]);
+                __m128 p1 = _mm_load_ps(p[1][axis]);
+                __m128 p2 = _mm_load_ps(p[2][axis]);
+                e[0][axis] = _mm_sub_ps(p1, p0);
+                e[1][axis] = _mm_sub_ps(p2, p1);
+                e[2][axis] = _mm_sub_ps(p0, p2);
+            }
+
+            // (p1 - p0) x (p2 - p0) = e0 x (-e2) = e2 x e0
+            __m128 nx = _mm_sub_ps(_mm_mul_ps(e[2][1], e[0][2]), _mm_mul_ps(e[2][2], e[0][1]));
+            __m128 ny = _mm_sub_ps(_mm_mul_ps(e[2][2], e[0][0]), _mm_mul_ps(e[2][0], e[0][2]));
+            __m128 nz = _mm_sub_ps(_mm_mul_ps(e[2][0], e[0][1]), _mm_mul_ps(e[2][1], e[0][0]));
+
+            // comprimento é o dobro da área; triângulos degenerados ficam sem normal
+            __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz)));
+            __m128 inverse = _mm_and_ps(_mm_div_ps(one, length), _mm_cmpgt_ps(length, zero));
+            _mm_storeu_ps(&faceX[t], _mm_mul_ps(nx, inverse));
+            _mm_storeu_ps(&faceY[t], _mm_mul_ps(ny, inverse));
+            _mm_storeu_ps(&faceZ[t], _mm_mul_ps(nz, inverse));
+
+            alignas(16) float area[4];
+            _mm_store_ps(area, length);
+
+            if (weight == NORMALS_AREA)
+            {
+                for (uint lane = 0; lane < lanes; ++lane)
+                    for (uint k = 0; k < 3; ++k)
+                        weights[(t + lane) * 3 + k] = area[lane];
+                continue;
+            }
+
+            // ângulo do canto k: atan2(|a x b|, a . b) entre a aresta que sai
+            // dele e a que chega invertida (|a x b| é o mesmo nos três cantos)
+            alignas(16) float angles[3][4];
+            for (uint k = 0; k < 3; ++k)
+            {
+                const __m128 * out = e[k];
+                const __m128 * in = e[(k + 2) % 3];
+                __m128 dot = _mm_mul_ps(out[0], in[0]);
+                dot = _mm_add_ps(dot, _mm_mul_ps(out[1], in[1]));
+                dot = _mm_add_ps(dot, _mm_mul_ps(out[2], in[2]));
+                _mm_store_ps(angles[k], Angle(length, _mm_sub_ps(zero, dot)));
+            }
+
+            for (uint lane = 0; lane < lanes; ++lane)
+                for (uint k = 0; k < 3; ++k)
+                    weights[(t + lane) * 3 + k] = angles[k][lane];
         }
+    });
+
+    // cantos de cada vértice (listas compactas)
+    vector<uint> offsets(size_t(vertCount) + 1, 0);
+    for (uint c = 0; c < count; ++c)
+        ++offsets[indices[c] + 1];
+    for (uint v = 0; v < vertCount; ++v)
+        offsets[v + 1] += offsets[v];
+
+    vector<uint> corners(count);
+    vector<uint> fill(offsets.begin(), offsets.end() - 1);
+    for (uint c = 0; c < count; ++c)
+        corners[fill[indices[c]]++] = c;
+
+    auto face = [&](uint c)
+    { return XMVectorSet(faceX[c / 3], faceY[c / 3], faceZ[c / 3], 0.0f); };
+
+    // cada vértice soma as normais dos seus cantos: sem disputa entre threads
+    // e com o mesmo resultado para qualquer número de threads
+    bool crease = creaseAngle < 180.0f;
+    float cutoff = std::cos(XMConvertToRadians(creaseAngle));
+    normals.assign(vertCount, XMFLOAT3(0.0f, 0.0f, 0.0f));
+
+    if (!crease)
+    {
+        run(vertCount, [&](uint, uint first, uint last)
+        {
+            for (uint v = first; v < last; ++v)
+            {
+                XMVECTOR sum = XMVectorZero();
+                for (uint i = offsets[v]; i < offsets[v + 1]; ++i)
+                    sum = XMVectorAdd(sum, XMVectorScale(face(corners[i]), weights[corners[i]]));
+                XMStoreFloat3(&normals[v], XMVector3Normalize(sum));
+            }
+        });
+        return;
     }
 
-    // constri vrtices das tampas do cilindro
-    for (uint k = 0; k < 2; ++k)
+    // o canto c é a origem da semi-aresta c: girar em torno do vértice
+    // percorre os cantos vizinhos, e arestas com diedro acima do ângulo
+    // de vinco separam o leque em grupos de cantos suavizados juntos
+    HalfEdgeMesh mesh(*this);
+    vector<XMFLOAT3> cornerNormals(count);
+    vector<uint> leader(count, HalfEdgeMesh::Invalid);
+    vector<uint> extras(size_t(vertCount) + 1, 0);
+
+    run(vertCount, [&](uint, uint first, uint last)
     {
-        uint baseIndex = uint(vertices.size());
+        vector<uint> group;
+        for (uint v = first; v < last; ++v)
+        {
+            uint groups = 0;
+            for (uint i = offsets[v]; i < offsets[v + 1]; ++i)
+            {
+                // o primeiro canto de cada grupo, na ordem dos cantos, é o líder
+                uint c = corners[i];
+                if (leader[c] != HalfEdgeMesh::Invalid)
+                    continue;
+
+                group.assign(1, c);
+                leader[c] = c;
+
+                // junta o canto vizinho se a aresta entre os dois não é um vinco
+                auto join = [&](uint h, uint next)
+                {
+                    if (next == HalfEdgeMesh::Invalid || leader[next] != HalfEdgeMesh::Invalid ||
+                        XMVectorGetX(XMVector3Dot(face(h), face(next))) < cutoff)
+                        return false;
+
+                    leader[next] = c;
+                    group.push_back(next);
+                    return true;
+                };
+
+                // gira para um lado e depois para o outro até um vinco ou a borda
+                for (uint h = c; join(h, mesh.Rotate(h)); h = group.back());
+                for (uint h = c; !mesh.Boundary(h) && join(h, mesh.Next(mesh.Twin(h))); h = group.back());
+
+                XMVECTOR sum = XMVectorZero();
+                for (uint g : group)
+                    sum = XMVectorAdd(sum, XMVectorScale(face(g), weights[g]));
+
+                XMFLOAT3 normal;
+                XMStoreFloat3(&normal, XMVector3Normalize(sum));
+                for (uint g : group)
+                    cornerNormals[g] = normal;
+                ++groups;
+            }
+
+            if (offsets[v] < offsets[v + 1])
+                normals[v] = cornerNormals[corners[offsets[v]]];
+            extras[size_t(v) + 1] = groups > 1 ? groups - 1 : 0;
+        }
+    });
+
+    // cópias dos vértices divididos vão para o fim, na ordem dos vértices
+    for (uint v = 0; v < vertCount; ++v)
+        extras[size_t(v) + 1] += extras[v];
+    if (extras[vertCount] == 0)
+        return;
+
+    vertices.resize(size_t(vertCount) + extras[vertCount]);
+    normals.resize(vertices.size());
+
+    // níveis de detalhe e grupos já construídos seguem com os vértices originais
+    run(vertCount, [&](uint, uint first, uint last)
+    {
+        for (uint v = first; v < last; ++v)
+        {
+            uint next = vertCount + extras[v];
+
+            // o grupo do primeiro canto fica com o vértice; os líderes
+            // vêm antes dos seus cantos e os demais grupos ganham cópias
+            for (uint i = offsets[v] + 1; i < offsets[v + 1]; ++i)
+            {
+                uint c = corners[i];
+                if (leader[c] != c)
+                {
+                    indices[c] = indices[leader[c]];
+                }
+                else
+                {
+                    vertices[next] = vertices[v];
+                    normals[next] = cornerNormals[c];
+                    indices[c] = next++;
+                }
+            }
+        }
+    });
+}
+
+// ------------------------------------------------------------------------------
+
+void Geometry::ExtractEdges()
+{
+    PROFILE_SCOPE("Edges");
+
+    // refaz as arestas a partir do original (grupos depois delas são deslocados)
+    if (edges.indexCount)
+    {
+        uint start = edges.startIndex;
+        uint end = start + edges.indexCount;
+        indices.erase(indices.begin() + start, indices.begin() + end);
+        for (Meshlet & meshlet : meshlets)
+            if (meshlet.startIndex >= end)
+                meshlet.startIndex -= end - start;
+    }
+    edges = {};
+
+    uint triCount = OriginalCount() / 3;
+    if (triCount == 0)
+        return;
+
+    ThreadPool & pool = ThreadPool::Shared();
+    uint chunks = triCount >= (1u << 15) ? pool.Size() * 4 : 1;
+
+    // cada aresta vira uma chave com o menor índice na parte alta; os bits
+    // altos do hash da chave escolhem um dos grupos, compactados independentemente
+    // (malhas pequenas usam um único grupo)
+    const uint BinBits = chunks > 1 ? 10 : 0;
+    const uint Bins = 1u << BinBits;
+    const ullong Empty = ~0ull;
+    auto hash = [](ullong key) { return key * 0x9E3779B97F4A7C15ull; };
+    auto bin = [&](ullong key) { return uint(hash(key) >> 32 >> (32 - BinBits)); };
+    auto run = [&](uint n, const Task & task)
+    {
+        if (chunks > 1)
+            pool.Run(chunks, n, task);
+        else
+            task(0, 0, n);
+    };
 
-        float y = (k - 0.5f) * height;
-        float theta = 2.0f * XM_PI / sliceCount;
-        float r = (k ? top : bottom);
-        Vertex vertex;
+    // percorre as arestas não degeneradas dos triângulos de um bloco
+    auto visit = [&](uint first, uint last, auto && func)
+    {
+        for (uint t = first; t < last; ++t)
+        {
+            const uint * tri = &indices[size_t(t) * 3];
+            for (uint k = 0; k < 3; ++k)
+            {
+                uint a = tri[k];
+                uint b = tri[k == 2 ? 0 : k + 1];
+                if (a != b)
+                    func(a < b ? (ullong(a) << 32) | b : (ullong(b) << 32) | a);
+            }
+        }
+    };
 
-        for (uint i = 0; i <= sliceCount; i++)
+    // chaves de cada bloco em cada grupo
+    vector<uint> offsets(size_t(chunks) * Bins, 0);
+    run(triCount, [&](uint chunk, uint first, uint last)
+    {
+        uint * count = &offsets[size_t(chunk) * Bins];
+        visit(first, last, [&](ullong key) { ++count[bin(key)]; });
+    });
+
+    // grupos ficam contíguos e, dentro deles, os blocos seguem em ordem
+    vector<uint> binStart(size_t(Bins) + 1, 0);
+    uint total = 0;
+    for (uint b = 0; b < Bins; ++b)
+    {
+        binStart[b] = total;
+        for (uint c = 0; c < chunks; ++c)
         {
-            float x = r * cosf(i * theta);
-            float z = r * sinf(i * theta);
+            uint n = offsets[size_t(c) * Bins + b];
+            offsets[size_t(c) * Bins + b] = total;
+            total += n;
+        }
+    }
+    binStart[Bins] = total;
 
-            vertex.pos = XMFLOAT3(x, y, z);
-            vertex.color = XMFLOAT4(Colors::Yellow);
-            vertices.push_back(vertex);
+    vector<ullong> keys(total);
+    run(triCount, [&](uint chunk, uint first, uint last)
+    {
+        uint * next = &offsets[size_t(chunk) * Bins];
+        visit(first, last, [&](ullong key) { keys[next[bin(key)]++] = key; });
+    });
+
+    // remove repetições de cada grupo com uma tabela de endereçamento aberto,
+    // mantendo a primeira ocorrência no início da faixa do grupo
+    vector<uint> unique(size_t(Bins) + 1, 0);
+    run(Bins, [&](uint, uint first, uint last)
+    {
+        vector<ullong> table;
+        for (uint b = first; b < last; ++b)
+        {
+            uint begin = binStart[b];
+            uint end = binStart[b + 1];
+
+            uint size = 16;
+            while (size < 2 * (end - begin))
+                size *= 2;
+            table.assign(size, Empty);
+
+            uint kept = begin;
+            for (uint i = begin; i < end; ++i)
+            {
+                ullong key = keys[i];
+                uint slot = uint(hash(key) >> 24) & (size - 1);
+                while (table[slot] != Empty && table[slot] != key)
+                    slot = (slot + 1) & (size - 1);
+
+                if (table[slot] == Empty)
+                {
+                    table[slot] = key;
+                    keys[kept++] = key;
+                }
+            }
+            unique[size_t(b) + 1] = kept - begin;
         }
+    });
 
-        // vrtice central da tampa
-        vertex.pos = XMFLOAT3(0.0f, y, 0.0f);
-        vertex.color = XMFLOAT4(Colors::Yellow);
-        vertices.push_back(vertex);
+    for (uint b = 0; b < Bins; ++b)
+        unique[size_t(b) + 1] += unique[b];
 
-        uint centerIndex = uint(vertices.size() - 1);
+    // acrescenta as arestas como pares de índices após o restante
+    uint base = IndexCount();
+    indices.resize(size_t(base) + 2 * size_t(unique[Bins]));
 
-        // indices para a tampa
-        for (uint i = 0; i < sliceCount; ++i)
+    run(Bins, [&](uint, uint first, uint last)
+    {
+        for (uint b = first; b < last; ++b)
         {
-            indices.push_back(centerIndex);
-            indices.push_back(baseIndex + i + k);
-            indices.push_back(baseIndex + i + 1 - k);
+            uint * out = &indices[base + 2 * size_t(unique[b])];
+            uint count = unique[size_t(b) + 1] - unique[b];
+            for (uint i = 0; i < count; ++i)
+            {
+                ullong key = keys[binStart[b] + i];
+                out[2 * i] = uint(key >> 32);
+                out[2 * i + 1] = uint(key);
+            }
         }
+    });
+
+    edges = { base, 2 * unique[Bins] };
+}
+
+// ------------------------------------------------------------------------------
+
+// vértices são gravados como 7 floats seguidos (posição e cor)
+static_assert(sizeof(Vertex) == 7 * sizeof(float), "Vertex deve ter 7 floats");
+
+// grava count vértices (u[j] * su, y, v[j] * sv) com a mesma cor:
+// quatro posições por vez com SSE2, cada vértice com duas escritas
+// que se sobrepõem no componente vermelho da cor
+static void StoreRow(Vertex * out, const float * u, const float * v,
+                     float su, float y, float sv, uint count, const XMFLOAT4 & color)
+{
+    float * dst = reinterpret_cast<float *>(out);
+    const __m128 scaleU = _mm_set1_ps(su);
+    const __m128 scaleV = _mm_set1_ps(sv);
+    const __m128 yr = _mm_setr_ps(y, color.x, y, color.x);
+    const __m128 rgba = _mm_loadu_ps(&color.x);
+
+    uint j = 0;
+    for (; j + 4 <= count; j += 4)
+    {
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(u + j), scaleU);
+        __m128 z = _mm_mul_ps(_mm_loadu_ps(v + j), scaleV);
+        __m128 lo = _mm_unpacklo_ps(x, z);          // x0 z0 x1 z1
+        __m128 hi = _mm_unpackhi_ps(x, z);          // x2 z2 x3 z3
+
+        float * p = dst + size_t(j) * 7;
+        _mm_storeu_ps(p, _mm_unpacklo_ps(lo, yr));  // x0 y z0 r
+        _mm_storeu_ps(p + 3, rgba);
+        _mm_storeu_ps(p + 7, _mm_unpackhi_ps(lo, yr));
+        _mm_storeu_ps(p + 10, rgba);
+        _mm_storeu_ps(p + 14, _mm_unpacklo_ps(hi, yr));
+        _mm_storeu_ps(p + 17, rgba);
+        _mm_storeu_ps(p + 21, _mm_unpackhi_ps(hi, yr));
+        _mm_storeu_ps(p + 24, rgba);
+    }
+
+    for (; j < count; ++j)
+    {
+        out[j].pos = XMFLOAT3(u[j] * su, y, v[j] * sv);
+        out[j].color = color;
     }
 }
 
-//                                     ________
-// ___________________________________/ Sphere \_________________________________
+// grava os índices de count quadriláteros seguidos de uma faixa: o
+// quadrilátero j usa base + j + pattern[k] e quatro deles (24 índices)
+// saem em seis escritas SSE2
+static void StoreQuads(uint * out, uint base, const uint pattern[6], uint count)
+{
+    // deslocamentos de cada elemento dentro de um grupo de quatro quadriláteros
+    uint lanes[24];
+    for (uint q = 0; q < 4; ++q)
+        for (uint k = 0; k < 6; ++k)
+            lanes[q * 6 + k] = q + pattern[k];
+
+    __m128i offsets[6];
+    for (uint m = 0; m < 6; ++m)
+        offsets[m] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes + m * 4));
+
+    uint j = 0;
+    for (; j + 4 <= count; j += 4)
+    {
+        __m128i start = _mm_set1_epi32(int(base + j));
+        __m128i * p = reinterpret_cast<__m128i *>(out + size_t(j) * 6);
+        for (uint m = 0; m < 6; ++m)
+            _mm_storeu_si128(p + m, _mm_add_epi32(start, offsets[m]));
+    }
+
+    for (; j < count; ++j)
+        for (uint k = 0; k < 6; ++k)
+            out[size_t(j) * 6 + k] = base + j + pattern[k];
+}
+
+// cosseno e seno de cada fatia de um anel (uma vez por geometria)
+static void SliceTable(uint sliceCount, vector<float> & cosines, vector<float> & sines)
+{
+    float theta = 2.0f * XM_PI / sliceCount;
+    cosines.resize(size_t(sliceCount) + 1);
+    sines.resize(size_t(sliceCount) + 1);
+
+    for (uint j = 0; j <= sliceCount; ++j)
+    {
+        cosines[j] = cosf(j * theta);
+        sines[j] = sinf(j * theta);
+    }
+}
+
+//                _____
+// ______________/ Box \_________________________________________________________
 // ------------------------------------------------------------------------------
 
-Sphere::Sphere(float radius, uint sliceCount, uint stackCount)
+// vértices da caixa unitária (sinais de cada eixo) e índices que os interligam
+static constexpr float BoxCorners[8][3] =
 {
-    // calcula os vrtice iniciando no plo superior e descendo pelas camadas
-    Vertex topVertex;
-    topVertex.pos = XMFLOAT3(0.0f, radius, 0.0f);
-    topVertex.color = XMFLOAT4(Colors::Yellow);
+    { -1, -1, -1 }, { -1, +1, -1 }, { +1, +1, -1 }, { +1, -1, -1 },
+    { -1, -1, +1 }, { -1, +1, +1 }, { +1, +1, +1 }, { +1, -1, +1 }
+};
 
-    Vertex bottomVertex;
-    bottomVertex.pos = XMFLOAT3(0.0f, -radius, 0.0f);
-    bottomVertex.color = XMFLOAT4(Colors::Yellow);
+static constexpr uint BoxIndices[36] =
+{
+    // front face
+    0, 1, 2,
+    0, 2, 3,
 
-    vertices.push_back(topVertex);
+    // back face
+    4, 7, 5,
+    7, 6, 5,
 
-    float phiStep = XM_PI / stackCount;
-    float thetaStep = 2.0f * XM_PI / sliceCount;
+    // left face
+    4, 5, 1,
+    4, 1, 0,
+
+    // right face
+    3, 2, 6,
+    3, 6, 7,
+
+    // top face
+    1, 5, 6,
+    1, 6, 2,
+
+    // bottom face
+    4, 0, 3,
+    4, 3, 7
+};
+
+// ------------------------------------------------------------------------------
 
-    // calcula os vrtices para cada anel (no conta os plos como anis)
-    for (uint i = 1; i <= stackCount - 1; ++i)
+Box::Box(float width, float height, float depth)
+{
+    PROFILE_SCOPE("Box");
+
+    float w = 0.5f * width;
+    float h = 0.5f * height;
+    float d = 0.5f * depth;
+
+    // cria os vértices da geometria
+    vertices.resize(8);
+    for (uint i = 0; i < 8; ++i)
     {
-        float phi = i * phiStep;
+        vertices[i].pos = XMFLOAT3(BoxCorners[i][0] * w, BoxCorners[i][1] * h, BoxCorners[i][2] * d);
+        vertices[i].color = XMFLOAT4(Colors::Yellow);
+    }
 
-        // vrtices do anel
-        for (uint j = 0; j <= sliceCount; ++j)
-        {
-            float theta = j * thetaStep;
+    // índices indicam como os vértices são interligados
+    indices.assign(std::begin(BoxIndices), std::end(BoxIndices));
+}
+
+//                        __________
+// ______________________/ Cylinder \____________________________________________
+// ------------------------------------------------------------------------------
+
+Cylinder::Cylinder(float bottom, float top, float height, uint sliceCount, uint stackCount)
+{
+    PROFILE_SCOPE("Cylinder");
+
+    // altura de uma camada
+    float stackHeight = height / stackCount;
+
+    // incremento no raio de cada camada
+    float radiusStep = (top - bottom) / stackCount;
+
+    // número de anéis do cilindro
+    uint ringCount = stackCount + 1;
 
-            Vertex v;
+    // número de vértices em cada anel do cilindro
+    uint ringVertexCount = sliceCount + 1;
 
-            // coordenadas esfricas para cartesianas
-            v.pos.x = radius * sinf(phi) * cosf(theta);
-            v.pos.y = radius * cosf(phi);
-            v.pos.z = radius * sinf(phi) * sinf(theta);
+    // anéis laterais e tampas (cada tampa com um anel e o centro)
+    vertices.resize(size_t(ringCount) * ringVertexCount + 2 * (size_t(ringVertexCount) + 1));
+    indices.resize(size_t(stackCount) * sliceCount * 6 + 2 * size_t(sliceCount) * 3);
 
-            v.color = XMFLOAT4(Colors::Yellow);
+    // senos e cossenos são os mesmos em todos os anéis
+    vector<float> cosines, sines;
+    SliceTable(sliceCount, cosines, sines);
+    XMFLOAT4 color(Colors::Yellow);
 
-            vertices.push_back(v);
+    // calcula vértices de cada anel
+    for (uint i = 0; i < ringCount; ++i)
+    {
+        float y = -0.5f * height + i * stackHeight;
+        float r = bottom + i * radiusStep;
+        StoreRow(&vertices[size_t(i) * ringVertexCount], cosines.data(), sines.data(), r, y, r, ringVertexCount, color);
+    }
+
+    // calcula índices para cada camada
+    const uint side[6] = { 0, ringVertexCount, ringVertexCount + 1, 0, ringVertexCount + 1, 1 };
+    for (uint i = 0; i < stackCount; ++i)
+        StoreQuads(&indices[size_t(i) * sliceCount * 6], i * ringVertexCount, side, sliceCount);
+
+    // constrói vértices das tampas do cilindro
+    size_t k = size_t(stackCount) * sliceCount * 6;
+    for (uint cap = 0; cap < 2; ++cap)
+    {
+        uint baseIndex = ringCount * ringVertexCount + cap * (ringVertexCount + 1);
+
+        float y = (cap - 0.5f) * height;
+        float r = (cap ? top : bottom);
+        StoreRow(&vertices[baseIndex], cosines.data(), sines.data(), r, y, r, ringVertexCount, color);
+
+        // vértice central da tampa
+        uint centerIndex = baseIndex + ringVertexCount;
+        vertices[centerIndex].pos = XMFLOAT3(0.0f, y, 0.0f);
+        vertices[centerIndex].color = color;
+
+        // indices para a tampa
+        for (uint i = 0; i < sliceCount; ++i)
+        {
+            indices[k++] = centerIndex;
+            indices[k++] = baseIndex + i + cap;
+            indices[k++] = baseIndex + i + 1 - cap;
         }
     }
+}
 
-    vertices.push_back(bottomVertex);
+//                                     ________
+// ___________________________________/ Sphere \_________________________________
+// ------------------------------------------------------------------------------
 
-    // calcula os ndices da camada superior 
-    // esta camada conecta o plo superior ao primeiro anel
+Sphere::Sphere(float radius, uint sliceCount, uint stackCount)
+{
+    PROFILE_SCOPE("Sphere");
+
+    // pólos e anéis (não conta os pólos como anéis)
+    uint ringVertexCount = sliceCount + 1;
+    uint ringCount = stackCount - 1;
+    vertices.resize(size_t(ringCount) * ringVertexCount + 2);
+    indices.resize(2 * size_t(sliceCount) * 3 + size_t(stackCount - 2) * sliceCount * 6);
+
+    // calcula os vértice iniciando no pólo superior e descendo pelas camadas
+    XMFLOAT4 color(Colors::Yellow);
+    vertices.front().pos = XMFLOAT3(0.0f, radius, 0.0f);
+    vertices.front().color = color;
+    vertices.back().pos = XMFLOAT3(0.0f, -radius, 0.0f);
+    vertices.back().color = color;
+
+    float phiStep = XM_PI / stackCount;
+
+    // senos e cossenos são os mesmos em todos os anéis
+    vector<float> cosines, sines;
+    SliceTable(sliceCount, cosines, sines);
+
+    // calcula os vértices para cada anel: coordenadas esféricas
+    // para cartesianas com o raio do anel fixo
+    for (uint i = 1; i <= ringCount; ++i)
+    {
+        float phi = i * phiStep;
+        float r = radius * sinf(phi);
+        StoreRow(&vertices[1 + size_t(i - 1) * ringVertexCount], cosines.data(), sines.data(), r, radius * cosf(phi), r, ringVertexCount, color);
+    }
+
+    // calcula os índices da camada superior 
+    // esta camada conecta o pólo superior ao primeiro anel
+    size_t k = 0;
     for (uint i = 1; i <= sliceCount; ++i)
     {
-        indices.push_back(0);
-        indices.push_back(i + 1);
-        indices.push_back(i);
+        indices[k++] = 0;
+        indices[k++] = i + 1;
+        indices[k++] = i;
     }
 
-    // calcula os ndices para as camadas internas (no conectadas aos plos)
+    // calcula os índices para as camadas internas (não conectadas aos pólos)
     uint baseIndex = 1;
-    uint ringVertexCount = sliceCount + 1;
+    const uint inner[6] = { 0, 1, ringVertexCount, ringVertexCount, 1, ringVertexCount + 1 };
     for (uint i = 0; i < stackCount - 2; ++i)
     {
-        for (uint j = 0; j < sliceCount; ++j)
-        {
-            indices.push_back(baseIndex + i * ringVertexCount + j);
-            indices.push_back(baseIndex + i * ringVertexCount + j + 1);
-            indices.push_back(baseIndex + (i + 1) * ringVertexCount + j);
-
-            indices.push_back(baseIndex + (i + 1) * ringVertexCount + j);
-            indices.push_back(baseIndex + i * ringVertexCount + j + 1);
-            indices.push_back(baseIndex + (i + 1) * ringVertexCount + j + 1);
-        }
+        StoreQuads(&indices[k], baseIndex + i * ringVertexCount, inner, sliceCount);
+        k += size_t(sliceCount) * 6;
     }
 
-    // calcula os ndices da camada inferior 
-    // esta camada conecta o plo inferior ao ltimo anel
+    // calcula os índices da camada inferior 
+    // esta camada conecta o pólo inferior ao último anel
 
-    // plo inferior  adicionado por ltimo
+    // pólo inferior é adicionado por último
     uint southPoleIndex = (uint)vertices.size() - 1;
 
-    // se posiciona nos ndices do primeiro vrtice do ltimo anel
+    // se posiciona nos índices do primeiro vértice do último anel
     baseIndex = southPoleIndex - ringVertexCount;
 
     for (uint i = 0; i < sliceCount; ++i)
     {
-        indices.push_back(southPoleIndex);
-        indices.push_back(baseIndex + i);
-        indices.push_back(baseIndex + i + 1);
+        indices[k++] = southPoleIndex;
+        indices[k++] = baseIndex + i;
+        indices[k++] = baseIndex + i + 1;
     }
 }
 
@@ -317,47 +1314,165 @@ Sphere::Sphere(float radius, uint sliceCount, uint stackCount)
 // ______________________________________________/ GeoSphere \___________________
 // ------------------------------------------------------------------------------
 
-GeoSphere::GeoSphere(float radius, uint subdivisions)
+// icosaedro subdividido: cada nível é gerado em tempo de compilação
+// com as mesmas operações de Geometry::Subdivide e da projeção na
+// esfera; índices iguais e posições iguais às da geração em execução
+// até a ordem da soma dos quadrados em XMVector3Normalize
+template<uint Level>
+struct GeoLevel
 {
-    // limita o nmero de subdivises
-    subdivisions = (subdivisions > 6U ? 6U : subdivisions);
+    static constexpr uint VertexCount = Level == 0 ? 12 : 120u << (2 * (Level - 1));
+    static constexpr uint IndexCount = 60u << (2 * Level);
+
+    float pos[VertexCount][3];              // posições (antes ou depois da projeção)
+    uint index[IndexCount];                 // índices
+};
+
+// raiz quadrada arredondada para float (Newton em double)
+static constexpr float SquareRoot(float x)
+{
+    if (x <= 0.0f)
+        return 0.0f;
+
+    double r = x > 1.0f ? x : 1.0;
+    for (uint i = 0; i < 64; ++i)
+    {
+        double next = 0.5 * (r + x / r);
+        if (next == r)
+            break;
+        r = next;
+    }
+
+    return float(r);
+}
 
-    // aproxima uma esfera pela subdiviso de um icosadro
+// icosaedro
+static constexpr GeoLevel<0> Icosahedron()
+{
     const float X = 0.525731f;
     const float Z = 0.850651f;
 
-    // vrtices do icosadro
-    XMFLOAT3 pos[12] =
+    GeoLevel<0> ico =
     {
-        XMFLOAT3(-X, 0.0f, Z),  XMFLOAT3(X, 0.0f, Z),
-        XMFLOAT3(-X, 0.0f, -Z), XMFLOAT3(X, 0.0f, -Z),
-        XMFLOAT3(0.0f, Z, X),   XMFLOAT3(0.0f, Z, -X),
-        XMFLOAT3(0.0f, -Z, X),  XMFLOAT3(0.0f, -Z, -X),
-        XMFLOAT3(Z, X, 0.0f),   XMFLOAT3(-Z, X, 0.0f),
-        XMFLOAT3(Z, -X, 0.0f),  XMFLOAT3(-Z, -X, 0.0f)
+        {
+            { -X, 0.0f, Z },  { X, 0.0f, Z },
+            { -X, 0.0f, -Z }, { X, 0.0f, -Z },
+            { 0.0f, Z, X },   { 0.0f, Z, -X },
+            { 0.0f, -Z, X },  { 0.0f, -Z, -X },
+            { Z, X, 0.0f },   { -Z, X, 0.0f },
+            { Z, -X, 0.0f },  { -Z, -X, 0.0f }
+        },
+        {
+            1,4,0,  4,9,0,  4,5,9,  8,5,4,  1,8,4,
+            1,10,8, 10,3,8, 8,3,5,  3,2,5,  3,7,2,
+            3,10,7, 10,6,7, 6,11,7, 6,0,11, 6,1,0,
+            10,1,6, 11,0,9, 2,11,9, 5,2,9,  11,2,7
+        }
     };
+    return ico;
+}
 
-    // ndices do icosadro
-    uint k[60] =
+// divide cada triângulo em quatro, como Geometry::Subdivide
+template<uint Level>
+static constexpr GeoLevel<Level + 1> Subdivided(const GeoLevel<Level> & in)
+{
+    GeoLevel<Level + 1> out = {};
+    constexpr uint order[12] = { 0, 3, 5, 3, 4, 5, 5, 4, 2, 3, 1, 4 };
+
+    for (uint t = 0; t < GeoLevel<Level>::IndexCount / 3; ++t)
     {
-        1,4,0,  4,9,0,  4,5,9,  8,5,4,  1,8,4,
-        1,10,8, 10,3,8, 8,3,5,  3,2,5,  3,7,2,
-        3,10,7, 10,6,7, 6,11,7, 6,0,11, 6,1,0,
-        10,1,6, 11,0,9, 2,11,9, 5,2,9,  11,2,7
-    };
+        const float * v[3] = { in.pos[in.index[t * 3]], in.pos[in.index[t * 3 + 1]], in.pos[in.index[t * 3 + 2]] };
 
-    // ajusta e inicializa vetores de vrtices e ndices
-    vertices.resize(12);
-    indices.assign(&k[0], &k[60]);
+        for (uint k = 0; k < 3; ++k)
+        {
+            // vértices originais (0, 1, 2) e pontos centrais das arestas (3, 4, 5)
+            out.pos[t * 6 + k][0] = v[k][0];
+            out.pos[t * 6 + k][1] = v[k][1];
+            out.pos[t * 6 + k][2] = v[k][2];
+
+            const float * a = v[k == 2 ? 0 : k];
+            const float * b = v[k == 2 ? 2 : k + 1];
+            out.pos[t * 6 + 3 + k][0] = 0.5f * (a[0] + b[0]);
+            out.pos[t * 6 + 3 + k][1] = 0.5f * (a[1] + b[1]);
+            out.pos[t * 6 + 3 + k][2] = 0.5f * (a[2] + b[2]);
+        }
 
-    for (uint i = 0; i < 12; ++i)
-        vertices[i].pos = pos[i];
+        for (uint k = 0; k < 12; ++k)
+            out.index[t * 12 + k] = t * 6 + order[k];
+    }
 
-    // subdivide cada tringulo do icosaedro um certo nmero de vezes
-    for (uint i = 0; i < subdivisions; ++i)
+    return out;
+}
+
+// projeta na esfera unitária, como XMVector3Normalize
+template<uint Level>
+static constexpr GeoLevel<Level> Projected(const GeoLevel<Level> & in)
+{
+    GeoLevel<Level> out = in;
+
+    for (uint i = 0; i < GeoLevel<Level>::VertexCount; ++i)
+    {
+        float x = in.pos[i][0], y = in.pos[i][1], z = in.pos[i][2];
+        float length = SquareRoot(x * x + y * y + z * z);
+        out.pos[i][0] = x / length;
+        out.pos[i][1] = y / length;
+        out.pos[i][2] = z / length;
+    }
+
+    return out;
+}
+
+// níveis prontos: 0 a 3 projetados e o 3 ainda plano para subdivisões maiores
+static constexpr GeoLevel<0> GeoFlat0 = Icosahedron();
+static constexpr GeoLevel<1> GeoFlat1 = Subdivided(GeoFlat0);
+static constexpr GeoLevel<2> GeoFlat2 = Subdivided(GeoFlat1);
+static constexpr GeoLevel<3> GeoFlat3 = Subdivided(GeoFlat2);
+
+static constexpr GeoLevel<0> GeoUnit0 = Projected(GeoFlat0);
+static constexpr GeoLevel<1> GeoUnit1 = Projected(GeoFlat1);
+static constexpr GeoLevel<2> GeoUnit2 = Projected(GeoFlat2);
+static constexpr GeoLevel<3> GeoUnit3 = Projected(GeoFlat3);
+
+static_assert(GeoLevel<3>::VertexCount == 1920 && GeoLevel<3>::IndexCount == 3840, "níveis do icosaedro");
+
+// copia um nível pronto: índices de uma vez e posições na escala pedida
+template<uint Level>
+static void CopyLevel(const GeoLevel<Level> & level, float scale, Geometry & geometry)
+{
+    geometry.vertices.resize(GeoLevel<Level>::VertexCount);
+    for (uint i = 0; i < GeoLevel<Level>::VertexCount; ++i)
+    {
+        geometry.vertices[i].pos = XMFLOAT3(scale * level.pos[i][0], scale * level.pos[i][1], scale * level.pos[i][2]);
+        geometry.vertices[i].color = XMFLOAT4(Colors::Yellow);
+    }
+
+    geometry.indices.assign(std::begin(level.index), std::end(level.index));
+}
+
+// ------------------------------------------------------------------------------
+
+GeoSphere::GeoSphere(float radius, uint subdivisions)
+{
+    PROFILE_SCOPE("GeoSphere");
+
+    // limita o número de subdivisões
+    subdivisions = (subdivisions > 6U ? 6U : subdivisions);
+
+    // níveis gerados na compilação só precisam da escala
+    switch (subdivisions)
+    {
+    case 0: CopyLevel(GeoUnit0, radius, *this); return;
+    case 1: CopyLevel(GeoUnit1, radius, *this); return;
+    case 2: CopyLevel(GeoUnit2, radius, *this); return;
+    case 3: CopyLevel(GeoUnit3, radius, *this); return;
+    }
+
+    // níveis maiores continuam a subdivisão do último pronto
+    CopyLevel(GeoFlat3, 1.0f, *this);
+    for (uint i = 3; i < subdivisions; ++i)
         Subdivide();
 
-    // projeta os vrtices em uma esfera e ajusta a escala
+    // projeta os vértices em uma esfera e ajusta a escala
     for (uint i = 0; i < vertices.size(); ++i)
     {
         // normaliza vetor (ponto)
@@ -377,51 +1492,52 @@ GeoSphere::GeoSphere(float radius, uint subdivisions)
 
 Grid::Grid(float width, float depth, uint m, uint n)
 {
+    PROFILE_SCOPE("Grid");
+
     uint vertexCount = m * n;
     uint triangleCount = 2 * (m - 1) * (n - 1);
 
-    // cria os vrtices
+    // cria os vértices
     float halfWidth = 0.5f * width;
     float halfDepth = 0.5f * depth;
 
     float dx = width / (n - 1);
     float dz = depth / (m - 1);
 
-    // ajusta tamanho do vetor de vrtices
+    // ajusta tamanho dos vetores de vértices e índices
     vertices.resize(vertexCount);
+    indices.resize(size_t(triangleCount) * 3);
 
-    for (uint i = 0; i < m; ++i)
-    {
-        float z = halfDepth - i * dz;
+    // coordenadas x são as mesmas em todas as linhas
+    vector<float> xs(n), ones(n, 1.0f);
+    for (uint j = 0; j < n; ++j)
+        xs[j] = -halfWidth + j * dx;
 
-        for (uint j = 0; j < n; ++j)
+    XMFLOAT4 color(Colors::Yellow);
+    const uint quad[6] = { 0, 1, n, n, 1, n + 1 };
+
+    // define vértices da linha i e índices da faixa entre as linhas i e i + 1
+    auto rows = [&](uint first, uint last)
+    {
+        for (uint i = first; i < last; ++i)
         {
-            float x = -halfWidth + j * dx;
+            float z = halfDepth - i * dz;
+            StoreRow(&vertices[size_t(i) * n], xs.data(), ones.data(), 1.0f, 0.0f, z, n, color);
 
-            // define vrtices do grid
-            vertices[size_t(i) * n + j].pos = XMFLOAT3(x, 0.0f, z);
-            vertices[size_t(i) * n + j].color = XMFLOAT4(Colors::Yellow);
+            if (i < m - 1)
+                StoreQuads(&indices[size_t(i) * (n - 1) * 6], i * n, quad, n - 1);
         }
-    }
-
-    // ajusta tamanho do vetor de ndices
-    indices.resize(size_t(triangleCount) * 3);
-
-    size_t k = 0;
+    };
 
-    for (uint i = 0; i < m - 1; ++i)
+    // grids muito grandes são gerados em faixas de linhas paralelas
+    if (size_t(m) * n >= (1u << 20))
     {
-        for (uint j = 0; j < n - 1; ++j)
-        {
-            indices[k] = i * n + j;
-            indices[k + 1] = i * n + j + 1;
-            indices[k + 2] = (i + 1) * n + j;
-            indices[k + 3] = (i + 1) * n + j;
-            indices[k + 4] = i * n + j + 1;
-            indices[k + 5] = (i + 1) * n + j + 1;
-
-            k += 6; // prximo quad
-        }
+        ThreadPool & pool = ThreadPool::Shared();
+        pool.Run(pool.Size() * 4, m, [&](uint, uint first, uint last) { rows(first, last); });
+    }
+    else
+    {
+        rows(0, m);
     }
 }
 
@@ -429,36 +1545,39 @@ Grid::Grid(float width, float depth, uint m, uint n)
 // _____________________________________________________________________/ Quad \_
 // ------------------------------------------------------------------------------
 
+// vértices do quadrado unitário (sinais de x e y) e índices das duas faces
+static constexpr float QuadCorners[4][2] =
+{
+    { -1, -1 }, { -1, +1 }, { +1, +1 }, { +1, -1 }
+};
+
+static constexpr uint QuadIndices[12] =
+{
+    0, 1, 2,
+    0, 2, 3,
+    2, 1, 0,
+    3, 2, 0
+};
+
+// ------------------------------------------------------------------------------
+
 Quad::Quad(float width, float height)
 {
+    PROFILE_SCOPE("Quad");
+
     float w = 0.5f * width;
     float h = 0.5f * height;
 
     // cria vertex buffer
-    Vertex quadVertices[4] =
+    vertices.resize(4);
+    for (uint i = 0; i < 4; ++i)
     {
-        { XMFLOAT3(-w, -h, 0.0f), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(-w, +h, 0.0f), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, +h, 0.0f), XMFLOAT4(Colors::Yellow) },
-        { XMFLOAT3(+w, -h, 0.0f), XMFLOAT4(Colors::Yellow) }
-    };
-
-    // insere vrtices na malha
-    for (const Vertex & v : quadVertices)
-        vertices.push_back(v);
+        vertices[i].pos = XMFLOAT3(QuadCorners[i][0] * w, QuadCorners[i][1] * h, 0.0f);
+        vertices[i].color = XMFLOAT4(Colors::Yellow);
+    }
 
     // cria o index buffer
-    uint quadIndices[12] =
-    {
-        0, 1, 2,
-        0, 2, 3,
-        2, 1, 0,
-        3, 2, 0
-    };
-
-    // insere ndices na malha
-    for (uint i : quadIndices)
-        indices.push_back(i);
+    indices.assign(std::begin(QuadIndices), std::end(QuadIndices));
 }
 
 // -------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Geometry (Arquivo de Cabealho)
+// Geometry (Arquivo de Cabeçalho)
 //
-// Criao:     03 Fev 2013
-// Atualizao: 10 Set 2023
+// Criação:     03 Fev 2013
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Define vrtices e ndices para vrias geometrias
+// Descrição:   Define vértices e índices para várias geometrias
 //
 **********************************************************************************/
 
@@ -29,29 +29,80 @@ struct Vertex
     XMFLOAT4 color;
 };
 
+// peso de cada triângulo na normal de seus vértices
+enum NormalWeight { NORMALS_AREA, NORMALS_ANGLE };
+
+// nível de detalhe: faixa de índices dentro da própria geometria
+struct LevelOfDetail
+{
+    uint  startIndex;                       // primeiro índice do nível
+    uint  indexCount;                       // número de índices do nível
+    float error;                            // desvio máximo estimado em relação ao original
+};
+
+// grupo de triângulos vizinhos com limites para descarte
+struct Meshlet
+{
+    uint     startIndex;                    // primeiro índice do grupo
+    uint     indexCount;                    // número de índices do grupo
+    uint     vertexCount;                   // vértices distintos do grupo
+    XMFLOAT3 center;                        // centro da esfera envolvente
+    float    radius;                        // raio da esfera envolvente
+    XMFLOAT3 coneAxis;                      // direção média das normais
+    float    coneCutoff;                    // seno do meio ângulo do cone (1 = sem cone)
+};
+
+// arestas únicas do original como lista de linhas (pares de índices)
+struct EdgeList
+{
+    uint startIndex;                        // primeiro índice da lista
+    uint indexCount;                        // número de índices (2 por aresta, 0 = sem arestas)
+};
+
 // -------------------------------------------------------------------------------
 // Geometry
 // -------------------------------------------------------------------------------
 
 struct Geometry
 {
-    vector<Vertex> vertices;                // vrtices da geometria
-    vector<uint>   indices;                 // ndices da geometria
-
-    void Subdivide();                       // subdivide tringulos
-
-    // mtodos inline
-    const Vertex* VertexData() const        // retorna vrtices da geometria
+    vector<Vertex> vertices;                // vértices da geometria
+    vector<uint>   indices;                 // índices da geometria (original, níveis de detalhe, grupos e arestas)
+    vector<LevelOfDetail> lods;             // níveis de detalhe (vazio = apenas o original)
+    vector<Meshlet> meshlets;               // grupos de triângulos do original (vazio = sem grupos)
+    vector<XMFLOAT3> normals;               // normal de cada vértice (vazio = sem normais)
+    EdgeList edges = {};                    // arestas do original (indexCount 0 = sem arestas)
+
+    void Subdivide();                       // subdivide triângulos
+    void Simplify(uint levels,
+                  float ratio = 0.5f);      // acrescenta níveis simplificados aos índices
+    void Clusterize(uint maxVertices = 64,
+                    uint maxTriangles = 124);   // acrescenta o original agrupado aos índices
+    uint Select(uint current, float pixels,
+                float tolerance,
+                float slack = 0.75f) const; // escolhe o nível de detalhe pelo tamanho na tela
+    void ComputeNormals(uint weight = NORMALS_ANGLE,
+                        float creaseAngle = 180.0f);    // normais suaves, divididas nos vincos
+    void ExtractEdges();                    // acrescenta as arestas únicas do original aos índices
+
+    // métodos inline
+    const Vertex* VertexData() const        // retorna vértices da geometria
     { return vertices.data(); }
     
-    const uint* IndexData() const           // retorna ndices da geometria
+    const uint* IndexData() const           // retorna índices da geometria
     { return indices.data(); }
     
-    uint VertexCount() const                // retorna nmero de vrtices
+    uint VertexCount() const                // retorna número de vértices
     { return uint(vertices.size()); }
     
-    uint IndexCount() const                 // retorna nmero de ndices
+    uint IndexCount() const                 // retorna número de índices
     { return uint(indices.size()); }
+
+    uint OriginalCount() const              // retorna número de índices do original
+    {
+        if (!lods.empty()) return lods[0].indexCount;
+        uint count = meshlets.empty() ? IndexCount() : meshlets[0].startIndex;
+        return edges.indexCount && edges.startIndex < count ? edges.startIndex : count;
+    }
 };
 
 // -------------------------------------------------------------------------------
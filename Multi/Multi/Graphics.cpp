@@ -1,43 +1,197 @@
 /**********************************************************************************
-// Graphics (Cdigo Fonte)
+// Graphics (Código Fonte)
 // 
-// Criao:     06 Abr 2011
-// Atualizao: 24 Jul 2023
+// Criação:     06 Abr 2011
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Usa funes do Direct3D 12 para acessar a GPU
+// Descrição:   Usa funções do Direct3D 12 para acessar a GPU
 //
 **********************************************************************************/
 
 #include "Graphics.h"
 #include "Error.h"
+#include "Timer.h"
 #include <sstream>
+#include <cstring>
 using std::wstringstream;
+using std::stringstream;
+
+// ------------------------------------------------------------------------------
+// Chaves do cache de pipelines
+//
+// As chaves são calculadas a partir do conteúdo das descrições, nunca dos
+// ponteiros: nomes semânticos, bytecode dos shaders e tabelas de descritores
+// são percorridos. Estruturas com campos menores que 4 bytes são acumuladas
+// campo a campo para que bytes de alinhamento não alterem a chave.
+// ------------------------------------------------------------------------------
+
+template<class T>
+static ullong HashValue(const T & value, ullong hash)
+{ return PipelineCache::Hash(&value, sizeof(T), hash); }
+
+static ullong HashString(const char * str, ullong hash)
+{ return str ? PipelineCache::Hash(str, strlen(str) + 1, hash) : HashValue(0, hash); }
+
+static ullong HashShader(const D3D12_SHADER_BYTECODE & shader, ullong hash)
+{
+    hash = HashValue(ullong(shader.BytecodeLength), hash);
+    if (shader.pShaderBytecode)
+        hash = PipelineCache::Hash(shader.pShaderBytecode, shader.BytecodeLength, hash);
+    return hash;
+}
+
+static ullong HashRootSignature(const D3D12_ROOT_SIGNATURE_DESC & desc)
+{
+    ullong hash = HashValue(desc.Flags, PipelineCache::Hash(nullptr, 0));
+    hash = HashValue(desc.NumParameters, hash);
+
+    for (uint i = 0; i < desc.NumParameters; ++i)
+    {
+        const D3D12_ROOT_PARAMETER & param = desc.pParameters[i];
+        hash = HashValue(param.ParameterType, hash);
+        hash = HashValue(param.ShaderVisibility, hash);
+
+        switch (param.ParameterType)
+        {
+        case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
+            hash = HashValue(param.DescriptorTable.NumDescriptorRanges, hash);
+            for (uint j = 0; j < param.DescriptorTable.NumDescriptorRanges; ++j)
+                hash = HashValue(param.DescriptorTable.pDescriptorRanges[j], hash);
+            break;
+        case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
+            hash = HashValue(param.Constants, hash);
+            break;
+        default:
+            hash = HashValue(param.Descriptor, hash);
+            break;
+        }
+    }
+
+    hash = HashValue(desc.NumStaticSamplers, hash);
+    for (uint i = 0; i < desc.NumStaticSamplers; ++i)
+        hash = HashValue(desc.pStaticSamplers[i], hash);
+
+    return hash;
+}
+
+static ullong HashPipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC & desc, ullong rootKey)
+{
+    ullong hash = HashValue(rootKey, PipelineCache::Hash(nullptr, 0));
+
+    // shaders
+    hash = HashShader(desc.VS, hash);
+    hash = HashShader(desc.PS, hash);
+    hash = HashShader(desc.DS, hash);
+    hash = HashShader(desc.HS, hash);
+    hash = HashShader(desc.GS, hash);
+    hash = HashValue(desc.StreamOutput.NumEntries, hash);
+
+    // color blender
+    hash = HashValue(desc.BlendState.AlphaToCoverageEnable, hash);
+    hash = HashValue(desc.BlendState.IndependentBlendEnable, hash);
+    for (const D3D12_RENDER_TARGET_BLEND_DESC & rt : desc.BlendState.RenderTarget)
+    {
+        hash = HashValue(rt.BlendEnable, hash);
+        hash = HashValue(rt.LogicOpEnable, hash);
+        hash = HashValue(rt.SrcBlend, hash);
+        hash = HashValue(rt.DestBlend, hash);
+        hash = HashValue(rt.BlendOp, hash);
+        hash = HashValue(rt.SrcBlendAlpha, hash);
+        hash = HashValue(rt.DestBlendAlpha, hash);
+        hash = HashValue(rt.BlendOpAlpha, hash);
+        hash = HashValue(rt.LogicOp, hash);
+        hash = HashValue(rt.RenderTargetWriteMask, hash);
+    }
+    hash = HashValue(desc.SampleMask, hash);
+
+    // rasterizador
+    hash = HashValue(desc.RasterizerState, hash);
+
+    // depth stencil
+    const D3D12_DEPTH_STENCIL_DESC & ds = desc.DepthStencilState;
+    hash = HashValue(ds.DepthEnable, hash);
+    hash = HashValue(ds.DepthWriteMask, hash);
+    hash = HashValue(ds.DepthFunc, hash);
+    hash = HashValue(ds.StencilEnable, hash);
+    hash = HashValue(ds.StencilReadMask, hash);
+    hash = HashValue(ds.StencilWriteMask, hash);
+    hash = HashValue(ds.FrontFace, hash);
+    hash = HashValue(ds.BackFace, hash);
+
+    // input layout
+    hash = HashValue(desc.InputLayout.NumElements, hash);
+    for (uint i = 0; i < desc.InputLayout.NumElements; ++i)
+    {
+        const D3D12_INPUT_ELEMENT_DESC & e = desc.InputLayout.pInputElementDescs[i];
+        hash = HashString(e.SemanticName, hash);
+        hash = HashValue(e.SemanticIndex, hash);
+        hash = HashValue(e.Format, hash);
+        hash = HashValue(e.InputSlot, hash);
+        hash = HashValue(e.AlignedByteOffset, hash);
+        hash = HashValue(e.InputSlotClass, hash);
+        hash = HashValue(e.InstanceDataStepRate, hash);
+    }
+
+    // saída
+    hash = HashValue(desc.IBStripCutValue, hash);
+    hash = HashValue(desc.PrimitiveTopologyType, hash);
+    hash = HashValue(desc.NumRenderTargets, hash);
+    hash = HashValue(desc.RTVFormats, hash);
+    hash = HashValue(desc.DSVFormat, hash);
+    hash = HashValue(desc.SampleDesc, hash);
+    hash = HashValue(desc.NodeMask, hash);
+    hash = HashValue(desc.Flags, hash);
+
+    return hash;
+}
 
 // ------------------------------------------------------------------------------
 
 Graphics::Graphics()
 {
-    // configurao
+    // configuração
     backBufferCount = 2;    // double-buffering
-    backBufferIndex = 0;    // zero  o primeiro
+    backBufferIndex = 0;    // zero é o primeiro
     antialiasing = 1;       // sem antialiasing
-    quality = 0;            // qualidade padro
+    quality = 0;            // qualidade padrão
     vSync = false;          // sem vertical sync
+    software = false;       // usa a placa de vídeo
 
     // cor de fundo
     bgColor[0] = 0.0f;      // Red
     bgColor[1] = 0.0f;      // Green
     bgColor[2] = 0.0f;      // Blue
-    bgColor[3] = 0.0f;      // Alpha (0 = transparente, 1 = slido)
+    bgColor[3] = 0.0f;      // Alpha (0 = transparente, 1 = sólido)
 
-    // infraestrutura grfica
+    // infraestrutura gráfica
     factory           = nullptr;
     device            = nullptr;
     swapChain         = nullptr;
     commandQueue      = nullptr;
     commandList       = nullptr;
     commandListAlloc  = nullptr;
+
+    // gravação paralela
+    workers           = nullptr;
+    recorderCount     = 0;
+    recorderPending   = 0;
+    framePipeline     = nullptr;
+
+    // fila de cópia
+    copyQueue         = nullptr;
+    copyList          = nullptr;
+    copyFence         = nullptr;
+    for (uint i = 0; i < CopyAllocators; ++i)
+        copyAlloc[i] = nullptr;
+
+    // cache de pipelines
+    pipelineCache     = nullptr;
+    for (uint i = 0; i < MaxRecorders; ++i)
+    {
+        recorderList[i] = nullptr;
+        recorderAlloc[i] = nullptr;
+    }
     
     // pipeline do Direct3D
     renderTargets     = new ID3D12Resource*[backBufferCount] {nullptr};
@@ -48,10 +202,29 @@ Graphics::Graphics()
     ZeroMemory(&viewport, sizeof(viewport));
     ZeroMemory(&scissorRect, sizeof(scissorRect));
 
-    // sincronizao cpu/gpu
+    // medição de desempenho
+    profiler          = nullptr;
+    timestampHeap     = nullptr;
+    statsHeap         = nullptr;
+    queryReadback     = nullptr;
+    gpuFrequency      = 1;
+    profileFrame      = 0;
+    frameRange        = MaxGpuRanges;
+    presentTime       = 0.0;
+    for (uint i = 0; i < ProfileFrames; ++i)
+    {
+        gpuRangeCount[i] = 0;
+        profileFence[i] = 0;
+        profileFrameId[i] = 0;
+    }
+
+    // sincronização cpu/gpu
     fence = nullptr;
     fenceEvent = nullptr;
     fenceValue = 0;
+
+    // lista de comandos principal sem dono
+    commandOwner = std::thread::id();
 }
 
 // ------------------------------------------------------------------------------
@@ -61,6 +234,13 @@ Graphics::~Graphics()
     // espera GPU finalizar comandos na fila
     WaitCommandQueue();
 
+    // espera GPU finalizar as cópias submetidas
+    if (copyFence)
+        WaitFence(copyFence, copyBatches.Submitted());
+
+    // libera objetos que aguardavam a GPU
+    Collect();
+
     // libera depth stencil buffer
     if (depthStencil)
         depthStencil->Release();
@@ -80,6 +260,35 @@ Graphics::~Graphics()
     if (fence)
         fence->Release();
 
+    // libera consultas da medição de desempenho
+    if (queryReadback)
+        queryReadback->Release();
+
+    if (statsHeap)
+        statsHeap->Release();
+
+    if (timestampHeap)
+        timestampHeap->Release();
+
+    Profiler::Active(nullptr);
+    delete profiler;
+
+    // libera fila, lista e alocadores de cópia
+    if (copyFence)
+        copyFence->Release();
+
+    if (copyList)
+        copyList->Release();
+
+    for (uint i = 0; i < CopyAllocators; ++i)
+    {
+        if (copyAlloc[i])
+            copyAlloc[i]->Release();
+    }
+
+    if (copyQueue)
+        copyQueue->Release();
+
     // libera depth stencil heap
     if (depthStencilHeap)
         depthStencilHeap->Release();
@@ -91,11 +300,24 @@ Graphics::~Graphics()
     // libera swap chain
     if (swapChain)
     {
-        // Direct3D  incapaz de fechar quando em tela cheia
+        // Direct3D é incapaz de fechar quando em tela cheia
         swapChain->SetFullscreenState(false, NULL);
         swapChain->Release();
     }
 
+    // libera listas e alocadores da gravação paralela
+    for (uint i = 0; i < recorderCount; ++i)
+    {
+        recorderList[i]->Release();
+        recorderAlloc[i]->Release();
+    }
+
+    // encerra threads de gravação
+    delete workers;
+
+    // libera cache de pipelines
+    delete pipelineCache;
+
     // libera lista de comandos
     if (commandList)
         commandList->Release();
@@ -108,7 +330,7 @@ Graphics::~Graphics()
     if (commandQueue)
         commandQueue->Release();
 
-    // libera dispositivo grfico
+    // libera dispositivo gráfico
     if (device)
         device->Release();
 
@@ -124,7 +346,7 @@ void Graphics::LogHardwareInfo()
     const uint BytesInMegaByte = 1048576U;
 
     // --------------------------------------
-    // Adaptador de vdeo (placa de vdeo)
+    // Adaptador de vídeo (placa de vídeo)
     // --------------------------------------
     IDXGIAdapter* adapter = nullptr;
     if (factory->EnumAdapters(0, &adapter) != DXGI_ERROR_NOT_FOUND)
@@ -133,7 +355,7 @@ void Graphics::LogHardwareInfo()
         adapter->GetDesc(&desc);
 
         wstringstream text;
-        text << L"---> Placa de vdeo: " << desc.Description << L"\n";
+        text << L"---> Placa de vídeo: " << desc.Description << L"\n";
         OutputDebugStringW(text.str().c_str());
     }
 
@@ -144,15 +366,15 @@ void Graphics::LogHardwareInfo()
         adapter4->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &memInfo);
         
         wstringstream text;
-        text << L"---> Memria de vdeo (livre): " << memInfo.Budget / BytesInMegaByte << L"MB\n";
-        text << L"---> Memria de vdeo (usada): " << memInfo.CurrentUsage / BytesInMegaByte << L"MB\n";
+        text << L"---> Memória de vídeo (livre): " << memInfo.Budget / BytesInMegaByte << L"MB\n";
+        text << L"---> Memória de vídeo (usada): " << memInfo.CurrentUsage / BytesInMegaByte << L"MB\n";
         OutputDebugStringW(text.str().c_str());
 
         adapter4->Release();
     }    
 
     // -----------------------------------------
-    // Feature Level mximo suportado pela GPU
+    // Feature Level máximo suportado pela GPU
     // -----------------------------------------
     D3D_FEATURE_LEVEL featureLevels[10] =
     {
@@ -177,7 +399,7 @@ void Graphics::LogHardwareInfo()
         &featureLevelsInfo,
         sizeof(featureLevelsInfo));
 
-    // bloco de instrues
+    // bloco de instruções
     {
         wstringstream text;
         text << L"---> Feature Level: ";
@@ -198,7 +420,7 @@ void Graphics::LogHardwareInfo()
     }
 
     // -----------------------------------------
-    // Sada de vdeo (monitor)
+    // Saída de vídeo (monitor)
     // -----------------------------------------
 
     IDXGIOutput* output = nullptr;
@@ -213,22 +435,22 @@ void Graphics::LogHardwareInfo()
     }
 
     // ------------------------------------------
-    // Modo de vdeo (resoluo)
+    // Modo de vídeo (resolução)
     // ------------------------------------------
 
-    // pega as dimenses da tela
+    // pega as dimensões da tela
     uint dpi = GetDpiForSystem();
     uint screenWidth = GetSystemMetricsForDpi(SM_CXSCREEN, dpi);
     uint screenHeight = GetSystemMetricsForDpi(SM_CYSCREEN, dpi);
 
-    // pega a frequencia de atualizao da tela
+    // pega a frequencia de atualização da tela
     DEVMODE devMode = { 0 };
     devMode.dmSize = sizeof(DEVMODE);
     EnumDisplaySettings(NULL, ENUM_CURRENT_SETTINGS, &devMode);
     uint refresh = devMode.dmDisplayFrequency;
 
     wstringstream text;
-    text << L"---> Resoluo: " << screenWidth << L"x" << screenHeight << L" " << refresh << L" Hz\n";
+    text << L"---> Resolução: " << screenWidth << L"x" << screenHeight << L" " << refresh << L" Hz\n";
     OutputDebugStringW(text.str().c_str());
 
     // ------------------------------------------
@@ -250,23 +472,23 @@ void Graphics::Initialize(Window * window)
     uint factoryFlags = 0;
 
 #ifdef _DEBUG
-    // habilita a camada de depurao do DXGI
+    // habilita a camada de depuração do DXGI
     factoryFlags = DXGI_CREATE_FACTORY_DEBUG;
 
-    // habilita a camada de depurao do D3D12
+    // habilita a camada de depuração do D3D12
     ID3D12Debug * debugController;
     ThrowIfFailed(D3D12GetDebugInterface(IID_PPV_ARGS(&debugController)));
     debugController->EnableDebugLayer();
 #endif
 
-    // cria objeto para infraestrutura grfica do DirectX (DXGI)
+    // cria objeto para infraestrutura gráfica do DirectX (DXGI)
     ThrowIfFailed(CreateDXGIFactory2(factoryFlags, IID_PPV_ARGS(&factory)));
 
-    // cria objeto para dispositivo grfico
-    if FAILED(D3D12CreateDevice(
-        nullptr,                                // adaptador de vdeo (nullptr = adaptador padro)
-        D3D_FEATURE_LEVEL_11_0,                 // verso mnima dos recursos do Direct3D
-        IID_PPV_ARGS(&device)))                 // guarda o dispositivo D3D criado
+    // cria objeto para dispositivo gráfico
+    if (software || FAILED(D3D12CreateDevice(
+        nullptr,                                // adaptador de vídeo (nullptr = adaptador padrão)
+        D3D_FEATURE_LEVEL_11_0,                 // versão mínima dos recursos do Direct3D
+        IID_PPV_ARGS(&device))))                // guarda o dispositivo D3D criado
     {
         // tenta criar um dispositivo WARP 
         IDXGIAdapter * warp;
@@ -274,20 +496,20 @@ void Graphics::Initialize(Window * window)
 
         // cria objeto D3D usando dispositivo WARP
         ThrowIfFailed(D3D12CreateDevice(
-            warp,                               // adaptador de vdeo WARP (software)
-            D3D_FEATURE_LEVEL_11_0,             // verso mnima dos recursos do Direct3D
+            warp,                               // adaptador de vídeo WARP (software)
+            D3D_FEATURE_LEVEL_11_0,             // versão mínima dos recursos do Direct3D
             IID_PPV_ARGS(&device)));            // guarda o dispositivo D3D criado
 
-        // libera objeto no mais necessrio
+        // libera objeto não mais necessário
         warp->Release();
 
         // informa uso de um disposito WARP:
         // implementa as funcionalidades do 
         // D3D12 em software (lento)
-        OutputDebugString("---> Usando Adaptador WARP: no h suporte ao D3D12\n");
+        OutputDebugString("---> Usando Adaptador WARP: não há suporte ao D3D12\n");
     }
 
-    // exibe informaes do hardware grfico no Output do Visual Studio
+    // exibe informações do hardware gráfico no Output do Visual Studio
 #ifdef _DEBUG
     LogHardwareInfo();
 #endif 
@@ -310,22 +532,113 @@ void Graphics::Initialize(Window * window)
     // cria a lista de comandos
     ThrowIfFailed(device->CreateCommandList(
         0,                                      // usando apenas uma GPU
-        D3D12_COMMAND_LIST_TYPE_DIRECT,         // no herda estado na GPU
+        D3D12_COMMAND_LIST_TYPE_DIRECT,         // não herda estado na GPU
         commandListAlloc,                       // alocador de comandos
         nullptr,                                // estado inicial do pipeline
         IID_PPV_ARGS(&commandList)));           // objeto lista de comandos
 
+    // ---------------------------------------------------
+    // Listas e alocadores para gravação paralela
+    // ---------------------------------------------------
+
+    // uma lista de comandos e um alocador por thread de gravação
+    workers = new ThreadPool();
+    recorderCount = workers->Size() < MaxRecorders ? workers->Size() : MaxRecorders;
+
+    for (uint i = 0; i < recorderCount; ++i)
+    {
+        ThrowIfFailed(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            IID_PPV_ARGS(&recorderAlloc[i])));
+
+        ThrowIfFailed(device->CreateCommandList(
+            0,
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            recorderAlloc[i],
+            nullptr,
+            IID_PPV_ARGS(&recorderList[i])));
+
+        // listas são criadas abertas, mas só são reiniciadas a cada quadro
+        recorderList[i]->Close();
+    }
+
+    // ---------------------------------------------------
+    // Fila, lista e alocadores de cópia
+    // ---------------------------------------------------
+
+    // cópias para a GPU executam em paralelo com a renderização
+    D3D12_COMMAND_QUEUE_DESC copyDesc = {};
+    copyDesc.Type = D3D12_COMMAND_LIST_TYPE_COPY;
+    copyDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+    ThrowIfFailed(device->CreateCommandQueue(&copyDesc, IID_PPV_ARGS(&copyQueue)));
+
+    // um alocador por lote em execução
+    for (uint i = 0; i < CopyAllocators; ++i)
+    {
+        ThrowIfFailed(device->CreateCommandAllocator(
+            D3D12_COMMAND_LIST_TYPE_COPY,
+            IID_PPV_ARGS(&copyAlloc[i])));
+    }
+
+    ThrowIfFailed(device->CreateCommandList(
+        0,
+        D3D12_COMMAND_LIST_TYPE_COPY,
+        copyAlloc[0],
+        nullptr,
+        IID_PPV_ARGS(&copyList)));
+
+    // a lista só é aberta quando houver cópias a gravar
+    copyList->Close();
+
+    // ---------------------------------------------------
+    // Cache de pipelines em disco
+    // ---------------------------------------------------
+
+    pipelineCache = new PipelineCache("Cache");
+
+    // ---------------------------------------------------
+    // Consultas para medição de desempenho
+    // ---------------------------------------------------
+
+    // a linha do tempo usa o mesmo contador que a calibração da GPU
+    profiler = new Profiler(Clock::Seconds);
+    Profiler::Active(profiler);
+
+    // início e fim de cada faixa, para cada quadro em voo
+    D3D12_QUERY_HEAP_DESC queryDesc = {};
+    queryDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    queryDesc.Count = ProfileFrames * MaxGpuRanges * 2;
+    ThrowIfFailed(device->CreateQueryHeap(&queryDesc, IID_PPV_ARGS(&timestampHeap)));
+
+    // estatísticas do pipeline de cada faixa
+    queryDesc.Type = D3D12_QUERY_HEAP_TYPE_PIPELINE_STATISTICS;
+    queryDesc.Count = ProfileFrames * MaxGpuRanges;
+    ThrowIfFailed(device->CreateQueryHeap(&queryDesc, IID_PPV_ARGS(&statsHeap)));
+
+    // buffer onde a GPU resolve os resultados para leitura da CPU
+    Allocate(READBACK,
+        ProfileFrames * MaxGpuRanges * (2 * sizeof(ullong) + sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS)),
+        &queryReadback);
+
+    ThrowIfFailed(commandQueue->GetTimestampFrequency(&gpuFrequency));
+
     // ---------------------------------------------------
     // Cria cerca para sincronizar CPU/GPU
     // ---------------------------------------------------
 
-    // cria cerca para sincronizao
+    // cria cerca para sincronização
     ThrowIfFailed(device->CreateFence(
         0,                                      // valor inicial da cerca
-        D3D12_FENCE_FLAG_NONE,                  // cerca padro para uma GPU
+        D3D12_FENCE_FLAG_NONE,                  // cerca padrão para uma GPU
         IID_PPV_ARGS(&fence)));                 // objeto representando a cerca
 
-    // cria objeto para sinalizao de eventos
+    // cria cerca para a fila de cópia
+    ThrowIfFailed(device->CreateFence(
+        0,
+        D3D12_FENCE_FLAG_NONE,
+        IID_PPV_ARGS(&copyFence)));
+
+    // cria objeto para sinalização de eventos
     fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
     if (fenceEvent == nullptr)
     {
@@ -353,9 +666,9 @@ void Graphics::Initialize(Window * window)
     ThrowIfFailed(factory->CreateSwapChainForHwnd(
         commandQueue,                           // fila de comandos da GPU 
         window->Id(),                           // identificador da janela
-        &swapChainDesc,                         // descrio da swap chain
+        &swapChainDesc,                         // descrição da swap chain
         nullptr,                                // swap chain para tela cheia
-        nullptr,                                // restringir tela de sada
+        nullptr,                                // restringir tela de saída
         &swapChain));                           // objeto swap chain
 
     // ---------------------------------------------------
@@ -369,11 +682,11 @@ void Graphics::Initialize(Window * window)
     renderTargetHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
     ThrowIfFailed(device->CreateDescriptorHeap(&renderTargetHeapDesc, IID_PPV_ARGS(&renderTargetHeap)));
 
-    // pega um Handle para o incio da Heap
+    // pega um Handle para o início da Heap
     D3D12_CPU_DESCRIPTOR_HANDLE rtHandle = renderTargetHeap->GetCPUDescriptorHandleForHeapStart();
 
-    // valor a incrementar para acessar o prximo descritor dentro da Heap
-    // o tamanho de um descritor depende do hardware grfico e do tipo de heap utilizada
+    // valor a incrementar para acessar o próximo descritor dentro da Heap
+    // o tamanho de um descritor depende do hardware gráfico e do tipo de heap utilizada
     rtDescriptorSize = device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 
     // cria um descritor (view) de Render Target para cada buffer (front e back buffers)
@@ -388,7 +701,7 @@ void Graphics::Initialize(Window * window)
     // Depth/Stencil View (e heaps associadas)
     // ---------------------------------------------------
 
-    // descrio do buffer Depth/Stencil
+    // descrição do buffer Depth/Stencil
     D3D12_RESOURCE_DESC depthStencilDesc = {};
     depthStencilDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
     depthStencilDesc.Alignment = 0;
@@ -432,13 +745,13 @@ void Graphics::Initialize(Window * window)
     depthstencilHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE;
     ThrowIfFailed(device->CreateDescriptorHeap(&depthstencilHeapDesc, IID_PPV_ARGS(&depthStencilHeap)));
 
-    // pega um Handle para o incio da Heap
+    // pega um Handle para o início da Heap
     D3D12_CPU_DESCRIPTOR_HANDLE dsHandle = depthStencilHeap->GetCPUDescriptorHandleForHeapStart();
 
-    // cria um descritor (view) de Depth/Stencil para o mip nvel 0
+    // cria um descritor (view) de Depth/Stencil para o mip nível 0
     device->CreateDepthStencilView(depthStencil, nullptr, dsHandle);
 
-    // faz a transio do estado inicial do recurso para ser usado como buffer de profundidade
+    // faz a transição do estado inicial do recurso para ser usado como buffer de profundidade
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -448,11 +761,11 @@ void Graphics::Initialize(Window * window)
     barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
     commandList->ResourceBarrier(1, &barrier);
 
-    // submete comando para transio do depth/stencil buffer
+    // submete comando para transição do depth/stencil buffer
     SubmitCommands();
 
     // ---------------------------------------------------
-    // Viewport e Retngulo de Recorte
+    // Viewport e Retângulo de Recorte
     // ---------------------------------------------------
 
     // ajusta a viewport
@@ -463,7 +776,7 @@ void Graphics::Initialize(Window * window)
     viewport.MinDepth = 0.0f;
     viewport.MaxDepth = 1.0f;
 
-    // ajusta o retngulo de corte
+    // ajusta o retângulo de corte
     scissorRect = { 0, 0, window->Width(), window->Height() };
 
     // ---------------------------------------------------
@@ -477,23 +790,36 @@ void Graphics::Initialize(Window * window)
     bgColor[0] = GetRValue(color)/255.0f;   // Red
     bgColor[1] = GetGValue(color)/255.0f;   // Green
     bgColor[2] = GetBValue(color)/255.0f;   // Blue
-    bgColor[3] = 1.0f;                      // Alpha (1 = slido)
+    bgColor[3] = 1.0f;                      // Alpha (1 = sólido)
 }
 
 // -----------------------------------------------------------------------------
 
 void Graphics::Clear(ID3D12PipelineState * pso)
 {
-    // reutiliza a memria associada com a lista de comandos
+    // o quadro grava na lista principal até Present
+    AcquireCommands();
+
+    // reutiliza a memória associada com a lista de comandos
     // a lista de comandos deve ter terminado de executar na GPU
+    // (Present já esperou; falta apenas o que foi submetido depois)
+    WaitFence(fence, fenceValue);
     commandListAlloc->Reset();
 
     // uma lista de comandos pode ser reinicializada depois de 
-    // adicionada  fila de comandos da GPU (via ExecuteCommandList)
-    // reutilizando a lista de comandos reutiliza memria
+    // adicionada à fila de comandos da GPU (via ExecuteCommandList)
+    // reutilizando a lista de comandos reutiliza memória
     commandList->Reset(commandListAlloc, pso);
 
-    // indica que o backbuffer ser usado como alvo de renderizao
+    // lê as consultas do último quadro que usou este conjunto
+    // e reaproveita o conjunto para o quadro atual
+    WaitFence(fence, profileFence[profileFrame]);
+    ReadProfile(profileFrame);
+    profileFrameId[profileFrame] = profiler->Frame();
+    frameRange = BeginGpuRange(commandList, "Frame");
+    presentTime = 0.0;
+
+    // indica que o backbuffer será usado como alvo de renderização
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -503,10 +829,6 @@ void Graphics::Clear(ID3D12PipelineState * pso)
     barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
     commandList->ResourceBarrier(1, &barrier);
 
-    // ajusta a viewport e retngulos de corte
-    commandList->RSSetViewports(1, &viewport);
-    commandList->RSSetScissorRects(1, &scissorRect);
-
     // limpa o backbuffer e depth/stencil buffer    
     D3D12_CPU_DESCRIPTOR_HANDLE dsHandle = depthStencilHeap->GetCPUDescriptorHandleForHeapStart();
     D3D12_CPU_DESCRIPTOR_HANDLE rtHandle = renderTargetHeap->GetCPUDescriptorHandleForHeapStart();
@@ -514,20 +836,86 @@ void Graphics::Clear(ID3D12PipelineState * pso)
     commandList->ClearRenderTargetView(rtHandle, bgColor, 0, nullptr);
     commandList->ClearDepthStencilView(dsHandle, D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr);
 
-    // especifica quais buffers sero utilizados na renderizao
-    commandList->OMSetRenderTargets(1, &rtHandle, true, &dsHandle);
+    // ajusta viewport e buffers utilizados na renderização
+    BindTargets(commandList);
+
+    // guarda pipeline para as listas gravadas em paralelo
+    framePipeline = pso;
 }
 
 // ------------------------------------------------------------------------------
 
-bool Graphics::WaitCommandQueue()
+void Graphics::BindTargets(ID3D12GraphicsCommandList * cmdList)
+{
+    // ajusta a viewport e retângulos de corte
+    cmdList->RSSetViewports(1, &viewport);
+    cmdList->RSSetScissorRects(1, &scissorRect);
+
+    // especifica quais buffers serão utilizados na renderização
+    D3D12_CPU_DESCRIPTOR_HANDLE dsHandle = depthStencilHeap->GetCPUDescriptorHandleForHeapStart();
+    D3D12_CPU_DESCRIPTOR_HANDLE rtHandle = renderTargetHeap->GetCPUDescriptorHandleForHeapStart();
+    rtHandle.ptr += SIZE_T(backBufferIndex) * SIZE_T(rtDescriptorSize);
+    cmdList->OMSetRenderTargets(1, &rtHandle, true, &dsHandle);
+}
+
+// ------------------------------------------------------------------------------
+
+void Graphics::Record(uint drawCount, const RecordFunc & record)
+{
+    // cada lista precisa de desenhos suficientes para compensar seu custo
+    const uint MinDrawsPerRecorder = 256;
+
+    uint available = recorderCount - recorderPending;
+    uint chunks = drawCount / MinDrawsPerRecorder;
+    chunks = chunks < available ? chunks : available;
+
+    // poucos desenhos são gravados em uma única lista: a principal ou,
+    // após uma gravação paralela, a última lista gravada (mantém a ordem)
+    if (chunks <= 1)
+    {
+        record(recorderPending ? recorderList[recorderPending - 1] : commandList, 0, drawCount);
+        return;
+    }
+
+    // divide os desenhos em blocos contíguos, um por lista de comandos,
+    // que serão submetidos na ordem em que aparecem na cena
+    uint base = recorderPending;
+    workers->Run(chunks, drawCount, [&](uint chunk, uint first, uint last)
+    {
+        PROFILE_SCOPE("Record");
+        ID3D12GraphicsCommandList * cmdList = recorderList[base + chunk];
+
+        // a GPU já concluiu o quadro anterior (Present espera a fila)
+        recorderAlloc[base + chunk]->Reset();
+        cmdList->Reset(recorderAlloc[base + chunk], framePipeline);
+
+        BindTargets(cmdList);
+        record(cmdList, first, last);
+    });
+
+    recorderPending += chunks;
+}
+
+// ------------------------------------------------------------------------------
+
+bool Graphics::SignalCommandQueue()
 {
-    // avana o valor da cerca para marcar novos comandos a partir desse ponto
+    // Retire lê a barreira a partir de outras threads
+    std::lock_guard<mutex> lock(resourceLock);
+
+    // avança o valor da cerca para marcar novos comandos a partir desse ponto
     fenceValue++;
 
-    // adiciona uma instruo na fila de comandos para inserir uma nova barreira
+    // adiciona uma instrução na fila de comandos para inserir uma nova barreira
     // GPU vai finalizar todos os comandos em curso antes de processar esse sinal
-    if (FAILED(commandQueue->Signal(fence, fenceValue)))
+    return SUCCEEDED(commandQueue->Signal(fence, fenceValue));
+}
+
+// ------------------------------------------------------------------------------
+
+bool Graphics::WaitCommandQueue()
+{
+    if (!SignalCommandQueue())
         return false;
 
     // espera a GPU completar todos os comandos anteriores
@@ -537,7 +925,7 @@ bool Graphics::WaitCommandQueue()
         if (FAILED(fence->SetEventOnCompletion(fenceValue, fenceEvent)))
             return false;
 
-        // espera at o evento ser acionado
+        // espera até o evento ser acionado
         WaitForSingleObject(fenceEvent, INFINITE);
     }
 
@@ -546,9 +934,48 @@ bool Graphics::WaitCommandQueue()
 
 // -----------------------------------------------------------------------------
 
+void Graphics::WaitFence(ID3D12Fence * f, ullong value)
+{
+    if (f->GetCompletedValue() < value)
+    {
+        // aciona evento quando a GPU atingir a barreira e espera por ele
+        if (SUCCEEDED(f->SetEventOnCompletion(value, fenceEvent)))
+            WaitForSingleObject(fenceEvent, INFINITE);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::AcquireCommands()
+{
+    // a mesma thread pode reiniciar a lista sem submeter antes
+    if (commandOwner.load() != std::this_thread::get_id())
+    {
+        commandLock.lock();
+        commandOwner = std::this_thread::get_id();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ReleaseCommands()
+{
+    // a lista criada em Initialize não tem dono
+    if (commandOwner.load() == std::this_thread::get_id())
+    {
+        commandOwner = std::thread::id();
+        commandLock.unlock();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 void Graphics::ResetCommands()
 {
-    // reinicia a lista de comandos para preparar para os comandos de inicializao
+    // comandos gravados fora do quadro esperam o desenho de outra thread
+    AcquireCommands();
+
+    // reinicia a lista de comandos para preparar para os comandos de inicialização
     commandList->Reset(commandListAlloc, nullptr);
 }
 
@@ -556,13 +983,43 @@ void Graphics::ResetCommands()
 
 void Graphics::SubmitCommands()
 {
-    // submete os comandos gravados na lista para execuo na GPU
+    ExecuteCommands();
+    ReleaseCommands();
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ExecuteCommands()
+{
+    // as cópias gravadas até aqui seguem em um único lote
+    FlushUploads();
+
+    // a fila principal espera apenas pelo lote que os desenhos usam,
+    // e só se a GPU ainda não o concluiu
+    ullong required = copyBatches.Wait();
+    if (required && copyFence->GetCompletedValue() < required)
+        commandQueue->Wait(copyFence, required);
+
+    // submete os comandos gravados na lista para execução na GPU
+    // seguidos das listas gravadas em paralelo, na ordem dos blocos
+    ID3D12CommandList* cmdsLists[MaxRecorders + 1] = { commandList };
     commandList->Close();
-    ID3D12CommandList* cmdsLists[] = { commandList };
-    commandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
-    // espera at a GPU completar a execuo dos comandos
-    WaitCommandQueue();
+    for (uint i = 0; i < recorderPending; ++i)
+    {
+        recorderList[i]->Close();
+        cmdsLists[i + 1] = recorderList[i];
+    }
+
+    commandQueue->ExecuteCommandLists(recorderPending + 1, cmdsLists);
+    recorderPending = 0;
+
+    // apenas marca o fim dos comandos: quem reaproveita o alocador
+    // espera pela barreira (Present e Clear), as submissões avulsas não
+    SignalCommandQueue();
+
+    // libera objetos que não estão mais em uso pela GPU
+    Collect();
 }
 
 // -----------------------------------------------------------------------------
@@ -579,8 +1036,10 @@ void Graphics::Allocate(uint type, uint sizeInBytes, ID3D12Resource** resource)
     
     if (type == GPU)
         bufferProp.Type = D3D12_HEAP_TYPE_DEFAULT;
+    else if (type == READBACK)
+        bufferProp.Type = D3D12_HEAP_TYPE_READBACK;
 
-    // descrio do buffer 
+    // descrição do buffer 
     D3D12_RESOURCE_DESC bufferDesc = {};
     bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
     bufferDesc.Alignment = 0;
@@ -599,6 +1058,8 @@ void Graphics::Allocate(uint type, uint sizeInBytes, ID3D12Resource** resource)
     
     if (type == GPU)
         initState = D3D12_RESOURCE_STATE_COMMON;
+    else if (type == READBACK)
+        initState = D3D12_RESOURCE_STATE_COPY_DEST;
 
     // cria um buffer para o recurso
     ThrowIfFailed(device->CreateCommittedResource(
@@ -608,6 +1069,49 @@ void Graphics::Allocate(uint type, uint sizeInBytes, ID3D12Resource** resource)
         initState,
         nullptr,
         IID_PPV_ARGS(resource)));
+
+    // contabiliza recurso vivo
+    std::lock_guard<mutex> lock(resourceLock);
+    retired.Track(sizeInBytes);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Retire(ID3D12Resource* resource, ullong batch)
+{
+    if (!resource)
+        return;
+
+    std::lock_guard<mutex> lock(resourceLock);
+
+    // comandos já gravados (e ainda não submetidos) podem usar o recurso,
+    // por isso ele só é liberado após a próxima barreira sinalizada
+    // e, se foi destino ou origem de uma cópia, após o fim do seu lote
+    retired.Retire(resource, fenceValue + 1, batch, resource->GetDesc().Width);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Retire(ID3D12Pageable* object)
+{
+    if (!object)
+        return;
+
+    std::lock_guard<mutex> lock(resourceLock);
+    retired.Retire(object, fenceValue + 1);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Collect()
+{
+    std::lock_guard<mutex> lock(resourceLock);
+    if (retired.Pending() == 0)
+        return;
+
+    // cada objeto espera pelas barreiras das filas que o usaram
+    retired.Collect(fence->GetCompletedValue(), copyFence->GetCompletedValue(),
+        [](ID3D12Pageable * object) { object->Release(); });
 }
 
 // -----------------------------------------------------------------------------
@@ -615,22 +1119,22 @@ void Graphics::Allocate(uint type, uint sizeInBytes, ID3D12Resource** resource)
 void Graphics::Copy(const void* vertices, uint sizeInBytes, ID3D12Resource* bufferUpload, ID3D12Resource* bufferGPU)
 {
     // ----------------------------------------------------------------------------------
-    // Copia vrtices para o buffer padro (GPU)
+    // Copia vértices para o buffer padrão (GPU)
     // ----------------------------------------------------------------------------------
     //
     //  Para copiar dados para a GPU:
-    //  - primeiro copia-se os dados para a heap intermediria de upload
+    //  - primeiro copia-se os dados para a heap intermediária de upload
     //  - depois usando ID3D12CommandList::CopyBufferRegion copia-se de upload para a GPU
     //
     // ----------------------------------------------------------------------------------
 
-    // descreve os dados que sero copiados
+    // descreve os dados que serão copiados
     D3D12_SUBRESOURCE_DATA vertexSubResourceData = {};
     vertexSubResourceData.pData = vertices;
     vertexSubResourceData.RowPitch = sizeInBytes;
     vertexSubResourceData.SlicePitch = sizeInBytes;
 
-    // descreve o layout da memria de vdeo (GPU)
+    // descreve o layout da memória de vídeo (GPU)
     D3D12_PLACED_SUBRESOURCE_FOOTPRINT layouts;
     uint numRows;
     ullong rowSizesInBytes;
@@ -638,21 +1142,21 @@ void Graphics::Copy(const void* vertices, uint sizeInBytes, ID3D12Resource* buff
 
     D3D12_RESOURCE_DESC bufferGPUDesc = bufferGPU->GetDesc();
 
-    // pega layout da memria de vdeo
+    // pega layout da memória de vídeo
     device->GetCopyableFootprints(
         &bufferGPUDesc,
         0, 1, 0, &layouts, &numRows,
         &rowSizesInBytes, &requiredSize);
 
     // --------------------------------------
-    // Copia Vrtices no Upload Buffer
+    // Copia Vértices no Upload Buffer
     // --------------------------------------
 
-    // trava memria do upload buffer para acesso exclusivo 
+    // trava memória do upload buffer para acesso exclusivo 
     BYTE* pData;
     bufferUpload->Map(0, nullptr, (void**)&pData);
 
-    // descreve o destino de uma operao de cpia
+    // descreve o destino de uma operação de cópia
     D3D12_MEMCPY_DEST DestData =
     {
         pData + layouts.Offset,
@@ -660,30 +1164,30 @@ void Graphics::Copy(const void* vertices, uint sizeInBytes, ID3D12Resource* buff
         layouts.Footprint.RowPitch * ullong(numRows)
     };
 
-    // copia vrtices no upload buffer
+    // copia vértices no upload buffer
     for (uint z = 0; z < layouts.Footprint.Depth; ++z)
     {
-        // endereo de destino
+        // endereço de destino
         BYTE * destSlice = (BYTE*)(DestData.pData) + DestData.SlicePitch * z;
 
-        // endereo da fonte
+        // endereço da fonte
         const BYTE* srcSlice = (const BYTE*)(vertexSubResourceData.pData) + vertexSubResourceData.SlicePitch * z;
         
-        // faz cpia linha a linha
+        // faz cópia linha a linha
         for (uint y = 0; y < numRows; ++y)
             memcpy(destSlice + DestData.RowPitch * y,
                    srcSlice + vertexSubResourceData.RowPitch * y,
                    (size_t)rowSizesInBytes);
     }
 
-    // libera trava de memria do upload buffer 
+    // libera trava de memória do upload buffer 
     bufferUpload->Unmap(0, nullptr);
 
     // --------------------------------------
-    // Copia Vrtices do Upload -> GPU Buffer
+    // Copia Vértices do Upload -> GPU Buffer
     // --------------------------------------
 
-    // altera estado da memria da GPU (de leitura para escrita)
+    // altera estado da memória da GPU (de leitura para escrita)
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -701,7 +1205,7 @@ void Graphics::Copy(const void* vertices, uint sizeInBytes, ID3D12Resource* buff
         layouts.Offset,
         layouts.Footprint.Width);
 
-    // altera estado da memria da GPU (de escrita para leitura)
+    // altera estado da memória da GPU (de escrita para leitura)
     barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -714,9 +1218,287 @@ void Graphics::Copy(const void* vertices, uint sizeInBytes, ID3D12Resource* buff
 
 // -----------------------------------------------------------------------------
 
+ullong Graphics::Upload(const void* data, uint sizeInBytes, ID3D12Resource* bufferUpload, ID3D12Resource* bufferGPU)
+{
+    // Update grava cópias enquanto Present submete o lote em outra thread
+    std::lock_guard<mutex> lock(resourceLock);
+
+    // abre um novo lote de cópias
+    if (!copyBatches.Open())
+    {
+        // o alocador só pode ser reiniciado depois que seu último lote terminar
+        // (espera sem o sinalizador de eventos, usado por Present em outra thread)
+        uint index;
+        ullong reuse = copyBatches.Begin(index);
+        if (copyFence->GetCompletedValue() < reuse)
+            copyFence->SetEventOnCompletion(reuse, nullptr);
+
+        copyAlloc[index]->Reset();
+        copyList->Reset(copyAlloc[index], nullptr);
+    }
+
+    // copia os dados para o buffer de upload
+    BYTE* pData;
+    bufferUpload->Map(0, nullptr, (void**)&pData);
+    memcpy(pData, data, sizeInBytes);
+    bufferUpload->Unmap(0, nullptr);
+
+    // buffers em estado comum são promovidos para destino de cópia
+    // e voltam ao estado comum ao fim do lote: dispensam barreiras
+    copyList->CopyBufferRegion(bufferGPU, 0, bufferUpload, 0, sizeInBytes);
+
+    // a cópia termina junto com o lote atual
+    return copyBatches.Current();
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Require(ullong batch)
+{
+    // pode ser chamado pelas threads de gravação
+    copyBatches.Require(batch);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::FlushUploads()
+{
+    // só submete o lote: a ordem em relação aos desenhos vem de Require
+    std::lock_guard<mutex> lock(resourceLock);
+    if (!copyBatches.Open())
+        return;
+
+    // submete o lote e marca seu fim na barreira da fila de cópia
+    copyList->Close();
+    ID3D12CommandList* cmdsLists[] = { copyList };
+    copyQueue->ExecuteCommandLists(1, cmdsLists);
+
+    copyQueue->Signal(copyFence, copyBatches.Submit());
+}
+
+// -----------------------------------------------------------------------------
+
+uint Graphics::BeginGpuRange(ID3D12GraphicsCommandList * cmdList, const char * name, bool stats)
+{
+    // pode ser chamado pelas threads de gravação
+    uint range = gpuRangeCount[profileFrame]++;
+    if (range >= MaxGpuRanges)
+        return MaxGpuRanges;
+
+    gpuRangeName[profileFrame][range] = name;
+    gpuRangeStats[profileFrame][range] = stats;
+
+    uint index = profileFrame * MaxGpuRanges + range;
+    cmdList->EndQuery(timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP, index * 2);
+
+    // estatísticas exigem início e fim na mesma lista de comandos
+    if (stats)
+        cmdList->BeginQuery(statsHeap, D3D12_QUERY_TYPE_PIPELINE_STATISTICS, index);
+
+    return range;
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::EndGpuRange(ID3D12GraphicsCommandList * cmdList, uint range)
+{
+    // faixas além do limite do quadro são descartadas
+    if (range >= MaxGpuRanges)
+        return;
+
+    uint index = profileFrame * MaxGpuRanges + range;
+    cmdList->EndQuery(timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP, index * 2 + 1);
+
+    if (gpuRangeStats[profileFrame][range])
+        cmdList->EndQuery(statsHeap, D3D12_QUERY_TYPE_PIPELINE_STATISTICS, index);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ResolveProfile(ID3D12GraphicsCommandList * cmdList)
+{
+    uint count = gpuRangeCount[profileFrame];
+    if (count > MaxGpuRanges)
+        count = MaxGpuRanges;
+
+    // tempos de início e fim ficam lado a lado no buffer de leitura
+    uint first = profileFrame * MaxGpuRanges;
+    cmdList->ResolveQueryData(
+        timestampHeap, D3D12_QUERY_TYPE_TIMESTAMP,
+        first * 2, count * 2,
+        queryReadback, ullong(first) * 2 * sizeof(ullong));
+
+    // estatísticas ficam depois de todos os tempos
+    ullong statsOffset = ullong(ProfileFrames) * MaxGpuRanges * 2 * sizeof(ullong);
+    for (uint i = 0; i < count; ++i)
+    {
+        if (gpuRangeStats[profileFrame][i])
+            cmdList->ResolveQueryData(
+                statsHeap, D3D12_QUERY_TYPE_PIPELINE_STATISTICS,
+                first + i, 1,
+                queryReadback, statsOffset + (first + i) * sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ReadProfile(uint frame)
+{
+    uint count = gpuRangeCount[frame];
+    gpuRangeCount[frame] = 0;
+
+    if (count > MaxGpuRanges)
+        count = MaxGpuRanges;
+    if (count == 0)
+        return;
+
+    // relaciona o relógio da GPU com o contador da CPU
+    ullong gpuStamp, cpuStamp;
+    commandQueue->GetClockCalibration(&gpuStamp, &cpuStamp);
+    double cpuTime = double(cpuStamp) / double(Clock::Frequency()) - profiler->Origin();
+
+    // a CPU lê o buffer inteiro e não escreve nele
+    ullong statsOffset = ullong(ProfileFrames) * MaxGpuRanges * 2 * sizeof(ullong);
+    D3D12_RANGE readRange = { 0, SIZE_T(statsOffset + ullong(ProfileFrames) * MaxGpuRanges * sizeof(D3D12_QUERY_DATA_PIPELINE_STATISTICS)) };
+    D3D12_RANGE writeRange = { 0, 0 };
+
+    byte * data;
+    queryReadback->Map(0, &readRange, reinterpret_cast<void**>(&data));
+
+    uint first = frame * MaxGpuRanges;
+    const ullong * stamps = reinterpret_cast<const ullong*>(data) + first * 2;
+    const D3D12_QUERY_DATA_PIPELINE_STATISTICS * stats =
+        reinterpret_cast<const D3D12_QUERY_DATA_PIPELINE_STATISTICS*>(data + statsOffset) + first;
+
+    for (uint i = 0; i < count; ++i)
+    {
+        ProfileRange range = {};
+        range.name = gpuRangeName[frame][i];
+        range.track = GPU_TRACK;
+        range.frame = profileFrameId[frame];
+        range.start = Profiler::GpuTime(stamps[i * 2], gpuStamp, gpuFrequency, cpuTime);
+        range.end = Profiler::GpuTime(stamps[i * 2 + 1], gpuStamp, gpuFrequency, cpuTime);
+
+        if (gpuRangeStats[frame][i])
+        {
+            range.hasStats = true;
+            range.vertices = stats[i].IAVertices;
+            range.primitives = stats[i].CInvocations;
+            range.pixels = stats[i].PSInvocations;
+        }
+
+        profiler->Add(range);
+    }
+
+    queryReadback->Unmap(0, &writeRange);
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::CreateRootSignature(const D3D12_ROOT_SIGNATURE_DESC * desc, ID3D12RootSignature ** rootSignature)
+{
+    ullong key = HashRootSignature(*desc);
+    vector<byte> blob;
+
+    // assinatura já serializada em uma execução anterior
+    if (pipelineCache->Load(key, "rs", blob))
+    {
+        if (SUCCEEDED(device->CreateRootSignature(0, blob.data(), blob.size(), IID_PPV_ARGS(rootSignature))))
+        {
+            rootSignatureKeys[*rootSignature] = key;
+            return;
+        }
+
+        // blob rejeitado pelo dispositivo
+        pipelineCache->Invalidate(key, "rs");
+    }
+
+    // serializa assinatura raiz
+    ID3DBlob* serialized = nullptr;
+    ID3DBlob* error = nullptr;
+    HRESULT hr = D3D12SerializeRootSignature(desc, D3D_ROOT_SIGNATURE_VERSION_1, &serialized, &error);
+
+    if (error != nullptr)
+    {
+        OutputDebugString((char*)error->GetBufferPointer());
+        error->Release();
+    }
+
+    ThrowIfFailed(hr);
+
+    ThrowIfFailed(device->CreateRootSignature(
+        0,
+        serialized->GetBufferPointer(),
+        serialized->GetBufferSize(),
+        IID_PPV_ARGS(rootSignature)));
+
+    // guarda assinatura serializada para as próximas execuções
+    pipelineCache->Store(key, "rs", serialized->GetBufferPointer(), serialized->GetBufferSize());
+    serialized->Release();
+
+    rootSignatureKeys[*rootSignature] = key;
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::CreatePipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC * desc, ID3D12PipelineState ** pipelineState)
+{
+    Timer timer;
+    timer.Start();
+
+    // a chave inclui a assinatura raiz usada pelo pipeline
+    auto rootKey = rootSignatureKeys.find(desc->pRootSignature);
+    ullong key = HashPipeline(*desc, rootKey != rootSignatureKeys.end() ? rootKey->second : 0);
+
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC pso = *desc;
+    vector<byte> blob;
+    bool warm = pipelineCache->Load(key, "pso", blob);
+
+    if (warm)
+    {
+        // pipeline compilado em uma execução anterior
+        pso.CachedPSO = { blob.data(), blob.size() };
+
+        // outro driver ou adaptador invalidam o blob guardado
+        if (FAILED(device->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(pipelineState))))
+        {
+            pipelineCache->Invalidate(key, "pso");
+            pso.CachedPSO = {};
+            warm = false;
+        }
+    }
+
+    if (!warm)
+    {
+        ThrowIfFailed(device->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(pipelineState)));
+
+        // guarda pipeline compilado para as próximas execuções
+        ID3DBlob* compiled = nullptr;
+        if (SUCCEEDED((*pipelineState)->GetCachedBlob(&compiled)))
+        {
+            pipelineCache->Store(key, "pso", compiled->GetBufferPointer(), compiled->GetBufferSize());
+            compiled->Release();
+        }
+    }
+
+    // informa o custo de criação (partida fria ou quente)
+    stringstream text;
+    text << std::fixed;
+    text.precision(3);
+    text << "---> Pipeline " << std::hex << key << std::dec
+         << (warm ? ": cache quente, " : ": cache frio, ")
+         << timer.Elapsed() * 1000.0 << " ms\n";
+    OutputDebugString(text.str().c_str());
+}
+
+// -----------------------------------------------------------------------------
+
 void Graphics::Present()
 {
-    // indica que o backbuffer ser usado para apresentao
+    PROFILE_SCOPE("Present");
+    llong presentStart = Clock::Counter();
+
+    // indica que o backbuffer será usado para apresentação
     D3D12_RESOURCE_BARRIER barrier = {};
     barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
     barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
@@ -724,14 +1506,34 @@ void Graphics::Present()
     barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
     barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
     barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-    commandList->ResourceBarrier(1, &barrier);
 
-    // submete a lista de comandos para execuo na GPU
-    SubmitCommands();
+    // a transição deve ocorrer depois do último desenho gravado
+    ID3D12GraphicsCommandList * last = recorderPending ? recorderList[recorderPending - 1] : commandList;
+    last->ResourceBarrier(1, &barrier);
+
+    // encerra a faixa do quadro e copia as consultas para leitura
+    EndGpuRange(last, frameRange);
+    ResolveProfile(last);
+
+    // submete a lista de comandos para execução na GPU
+    // e espera até a GPU completar a execução do quadro
+    ExecuteCommands();
+    WaitFence(fence, fenceValue);
+
+    // consultas deste quadro ficam prontas nesta barreira
+    profileFence[profileFrame] = fenceValue;
+    profileFrame = (profileFrame + 1) % ProfileFrames;
+    profiler->NextFrame();
 
     // apresenta frame e troca front/back buffer
     swapChain->Present(vSync, 0);
     backBufferIndex = (backBufferIndex + 1) % backBufferCount;
+
+    // inclui a espera pela GPU feita antes da apresentação
+    presentTime += double(Clock::Counter() - presentStart) / double(Clock::Frequency());
+
+    // a lista principal fica livre para outra thread
+    ReleaseCommands();
 }
 
 // -----------------------------------------------------------------------------
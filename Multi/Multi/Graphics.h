@@ -1,101 +1,214 @@
 /**********************************************************************************
-// Graphics (Arquivo de Cabealho)
+// Graphics (Arquivo de Cabeçalho)
 // 
-// Criao:     06 Abr 2011
-// Atualizao: 24 Jul 2023
+// Criação:     06 Abr 2011
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Usa funes do Direct3D 12 para acessar a GPU
+// Descrição:   Usa funções do Direct3D 12 para acessar a GPU
+//              Fora do Windows Graphics é o dispositivo nulo (NullGraphics)
 //
 **********************************************************************************/
 
 #ifndef DXUT_GRAPHICS_H
 #define DXUT_GRAPHICS_H
 
+#ifndef _WIN32
+#include "NullGraphics.h"        // aceita e descarta os comandos gravados
+#else
+
 // --------------------------------------------------------------------------------
-// Incluses
+// Inclusões
 
-#include <dxgi1_6.h>             // infraestrutura grfica do DirectX
-#include <d3d12.h>               // principais funes do Direct3D
+#include <dxgi1_6.h>             // infraestrutura gráfica do DirectX
+#include <d3d12.h>               // principais funções do Direct3D
 #include "Window.h"              // cria e configura uma janela do Windows
-#include "Types.h"               // tipos especficos da engine
+#include "Types.h"               // tipos específicos da engine
+#include "ThreadPool.h"          // threads para gravação paralela
+#include "PipelineCache.h"       // cache de pipelines em disco
+#include "Profiler.h"            // faixas de tempo da CPU e da GPU
+#include "ReleaseQueue.h"        // liberação adiada de recursos
+#include "CopyBatches.h"         // lotes da fila de cópia
 #include <D3DCompiler.h>         // fornece D3DBlob
+#include <unordered_map>         // chaves das assinaturas raiz
+using std::unordered_map;
+
+enum AllocationType { GPU, UPLOAD, CBUFFER, READBACK };
 
-enum AllocationType { GPU, UPLOAD, CBUFFER };
+// grava os desenhos [first, last) em uma lista de comandos
+using RecordFunc = function<void(ID3D12GraphicsCommandList* cmdList, uint first, uint last)>;
 
 // --------------------------------------------------------------------------------
 
 class Graphics
 {
 private:
-    // configurao
-    uint                         backBufferCount;           // nmero de buffers na swap chain (double, triple, etc.)
-    uint                         antialiasing;              // nmero de amostras para cada pixel na tela
+    // configuração
+    uint                         backBufferCount;           // número de buffers na swap chain (double, triple, etc.)
+    uint                         antialiasing;              // número de amostras para cada pixel na tela
     uint                         quality;                   // qualidade da amostragem de antialiasing
     bool                         vSync;                     // vertical sync 
+    bool                         software;                  // usa adaptador WARP (sem placa de vídeo)
     float                        bgColor[4];                // cor de fundo do backbuffer
 
     // pipeline
-    ID3D12Device7             * device;                    // dispositivo grfico
+    ID3D12Device7             * device;                    // dispositivo gráfico
     IDXGIFactory7              * factory;                   // interface principal da DXGI
     IDXGISwapChain1            * swapChain;                 // swap chain
-    uint                         backBufferIndex;           // ndice do backbuffer atual
+    uint                         backBufferIndex;           // índice do backbuffer atual
     
     ID3D12CommandQueue         * commandQueue;              // fila de comandos da GPU
     ID3D12GraphicsCommandList  * commandList;               // lista de comandos a submeter para GPU
-    ID3D12CommandAllocator     * commandListAlloc;          // memria utilizada pela lista de comandos
+    ID3D12CommandAllocator     * commandListAlloc;          // memória utilizada pela lista de comandos
+
+    // gravação paralela
+    static const uint            MaxRecorders = 8;          // máximo de listas gravadas em paralelo
+    ThreadPool                 * workers;                   // threads que gravam comandos
+    ID3D12GraphicsCommandList  * recorderList[MaxRecorders];   // uma lista de comandos por thread
+    ID3D12CommandAllocator     * recorderAlloc[MaxRecorders];  // um alocador de comandos por thread
+    uint                         recorderCount;             // número de listas de gravação criadas
+    uint                         recorderPending;           // listas gravadas no quadro atual
+    ID3D12PipelineState        * framePipeline;             // pipeline usado no quadro atual
+
+    // fila de cópia
+    static const uint            CopyAllocators = CopyBatches::Allocators;  // lotes de cópia em execução simultânea
+    ID3D12CommandQueue         * copyQueue;                 // fila de cópia da GPU
+    ID3D12GraphicsCommandList  * copyList;                  // lista de comandos de cópia
+    ID3D12CommandAllocator     * copyAlloc[CopyAllocators]; // alocadores usados em rodízio
+    ID3D12Fence                * copyFence;                 // barreira da fila de cópia
+    CopyBatches                  copyBatches;               // lotes submetidos e exigidos
      
-    ID3D12Resource            ** renderTargets;             // buffers para renderizao (front e back)
+    ID3D12Resource            ** renderTargets;             // buffers para renderização (front e back)
     ID3D12Resource             * depthStencil;              // buffer de profundidade e estampa            
     ID3D12DescriptorHeap       * renderTargetHeap;          // descriptor heap para os Render Targets
     ID3D12DescriptorHeap       * depthStencilHeap;          // descriptor heap para o Depth Stencil
     uint                         rtDescriptorSize;          // tamanho de cada descritor de Render Target
     D3D12_VIEWPORT               viewport;                  // viewport
-    D3D12_RECT                   scissorRect;               // retngulo de corte
+    D3D12_RECT                   scissorRect;               // retângulo de corte
+
+    // cache de pipelines
+    PipelineCache              * pipelineCache;             // blobs de pipelines e assinaturas raiz
+    unordered_map<ID3D12RootSignature*, ullong> rootSignatureKeys; // chave de cada assinatura raiz
+
+    // medição de desempenho
+    static const uint            ProfileFrames = 3;         // quadros em voo antes da leitura das consultas
+    static const uint            MaxGpuRanges = 64;         // faixas da GPU por quadro
+    Profiler                   * profiler;                  // linha do tempo da CPU e da GPU
+    ID3D12QueryHeap            * timestampHeap;             // consultas de tempo (início e fim)
+    ID3D12QueryHeap            * statsHeap;                 // consultas de estatísticas do pipeline
+    ID3D12Resource             * queryReadback;             // resultados das consultas lidos pela CPU
+    ullong                       gpuFrequency;              // frequência do relógio da GPU
+    uint                         profileFrame;              // conjunto de consultas do quadro atual
+    atomic<uint>                 gpuRangeCount[ProfileFrames];  // faixas gravadas em cada quadro
+    string                       gpuRangeName[ProfileFrames][MaxGpuRanges];  // nome de cada faixa
+    bool                         gpuRangeStats[ProfileFrames][MaxGpuRanges]; // faixa com estatísticas
+    ullong                       profileFence[ProfileFrames];   // barreira que conclui cada quadro
+    ullong                       profileFrameId[ProfileFrames]; // número de cada quadro
+    uint                         frameRange;                // faixa que cobre o quadro inteiro
+    double                       presentTime;               // tempo de CPU gasto em Present no quadro
 
-    // sincronizao                         
+    // sincronização                         
     ID3D12Fence                * fence;                     // barreira para sincronizar CPU/GPU
     HANDLE                       fenceEvent;                // sinalizador de eventos
-    ullong                       fenceValue;				// nmero atual da barreira
+    ullong                       fenceValue;				// número atual da barreira
 
-    // mtodos privados
-    void LogHardwareInfo();                                 // mostra informaes do hardware
-    bool WaitCommandQueue();                                // espera execuo da fila de comandos
+    // liberação adiada de recursos
+    ReleaseQueue<ID3D12Pageable*> retired;                  // objetos aguardando a GPU
+
+    // posse da lista de comandos principal: vai de ResetCommands (ou Clear)
+    // até SubmitCommands (ou Present), permitindo que Update e Draw rodem
+    // em threads diferentes sem gravar na mesma lista ao mesmo tempo
+    mutex                        commandLock;               // protege a lista de comandos principal
+    atomic<std::thread::id>      commandOwner;              // thread que possui a lista
+
+    // malhas são criadas e destruídas em Update sem tomar a lista principal:
+    // a lista de cópia e a fila de liberação têm trava própria
+    mutex                        resourceLock;              // protege cópias e liberações
+
+    // métodos privados
+    void LogHardwareInfo();                                 // mostra informações do hardware
+    bool WaitCommandQueue();                                // espera execução da fila de comandos
+    bool SignalCommandQueue();                              // marca o fim dos comandos submetidos
+    void BindTargets(ID3D12GraphicsCommandList * cmdList);  // ajusta viewport e alvos de renderização
+    void WaitFence(ID3D12Fence * f, ullong value);          // espera a GPU atingir uma barreira
+    void ResolveProfile(ID3D12GraphicsCommandList * cmdList);  // copia consultas do quadro para leitura
+    void ReadProfile(uint frame);                           // converte consultas concluídas em faixas
+    void AcquireCommands();                                 // toma posse da lista de comandos principal
+    void ReleaseCommands();                                 // devolve a lista de comandos principal
+    void ExecuteCommands();                                 // executa comandos pendentes (sem esperar a GPU)
 
 public:
     Graphics();                                             // constructor
     ~Graphics();                                            // destructor
 
     void VSync(bool state);                                 // liga/desliga vertical sync
+    void Software(bool state);                              // força o uso do adaptador WARP
     void Initialize(Window * window);                       // inicializa o Direct3D
     void Clear(ID3D12PipelineState * pso);                  // limpa o backbuffer com a cor de fundo
+    void Record(uint drawCount, const RecordFunc & record); // grava desenhos em paralelo
     void Present();                                         // apresenta desenho na tela
 
     void ResetCommands();                                   // reinicia lista para receber novos comandos
-    void SubmitCommands();                                  // submete para execuo os comandos pendentes
+    void SubmitCommands();                                  // submete para execução os comandos pendentes
 
     void Allocate(uint type,
                   uint sizeInBytes, 
-                  ID3D12Resource** resource);               // aloca memria da GPU para recurso
+                  ID3D12Resource** resource);               // aloca memória da GPU para recurso
 
     void Copy(const void* vertices, 
               uint sizeInBytes,
               ID3D12Resource* bufferUpload,
-              ID3D12Resource* bufferGPU);                   // copia vrtices para a GPU
+              ID3D12Resource* bufferGPU);                   // copia vértices para a GPU
+
+    ullong Upload(const void* data,
+                  uint sizeInBytes,
+                  ID3D12Resource* bufferUpload,
+                  ID3D12Resource* bufferGPU);               // copia dados na fila de cópia (retorna lote)
+
+    void Require(ullong batch);                             // desenho depende do lote de cópia
+    void FlushUploads();                                    // submete o lote de cópias pendente
+
+    void Retire(ID3D12Resource* resource, ullong batch = 0);  // libera recurso quando a GPU deixar de usá-lo
+    void Retire(ID3D12Pageable* object);                    // libera heap quando a GPU deixar de usá-la
+    void Collect();                                         // libera objetos cuja barreira já passou
+
+    uint BeginGpuRange(ID3D12GraphicsCommandList * cmdList,
+                       const char * name,
+                       bool stats = false);                 // inicia faixa de tempo da GPU
+    void EndGpuRange(ID3D12GraphicsCommandList * cmdList,
+                     uint range);                           // encerra faixa de tempo da GPU
+
+    void CreateRootSignature(
+        const D3D12_ROOT_SIGNATURE_DESC * desc,
+        ID3D12RootSignature ** rootSignature);              // cria assinatura raiz usando o cache
+
+    void CreatePipelineState(
+        const D3D12_GRAPHICS_PIPELINE_STATE_DESC * desc,
+        ID3D12PipelineState ** pipelineState);              // cria pipeline usando o cache
 
     ID3D12Device7* Device();                                // retorna dispositivo Direct3D
     ID3D12GraphicsCommandList* CommandList();               // retorna lista de comandos
-    uint Antialiasing();                                    // retorna nmero de amostras por pixel
+    uint Antialiasing();                                    // retorna número de amostras por pixel
     uint Quality();                                         // retorna qualidade das amostras
+    uint Recorders();                                       // retorna número de listas de gravação
+    uint LiveResources();                                   // retorna recursos alocados e não liberados
+    ullong LiveBytes();                                     // retorna memória dos recursos não liberados
+    uint PendingReleases();                                 // retorna objetos aguardando a GPU
+    Profiler * Profile();                                   // retorna linha do tempo de desempenho
+    double PresentTime();                                   // retorna tempo de CPU gasto em Present
 };
 
 // --------------------------------------------------------------------------------
-// Mtodos Inline
+// Métodos Inline
 
 // liga/desliga vertical sync
 inline void Graphics::VSync(bool state)
 { vSync = state; }
 
+// força o uso do adaptador WARP (renderização em software)
+inline void Graphics::Software(bool state)
+{ software = state; }
+
 // retorna dispositivo Direct3D
 inline ID3D12Device7* Graphics::Device()
 { return device; }
@@ -104,7 +217,7 @@ inline ID3D12Device7* Graphics::Device()
 inline ID3D12GraphicsCommandList* Graphics::CommandList()
 { return commandList; }
 
-// retorna nmero de amostras por pixel
+// retorna número de amostras por pixel
 inline uint Graphics::Antialiasing()
 { return antialiasing; }
 
@@ -112,6 +225,32 @@ inline uint Graphics::Antialiasing()
 inline uint Graphics::Quality()
 { return quality; }
 
+// retorna número de listas de gravação paralela
+inline uint Graphics::Recorders()
+{ return recorderCount; }
+
+// retorna recursos alocados e ainda não liberados
+inline uint Graphics::LiveResources()
+{ return retired.Live(); }
+
+// retorna memória dos recursos ainda não liberados
+inline ullong Graphics::LiveBytes()
+{ return retired.LiveBytes(); }
+
+// retorna objetos aguardando a GPU para serem liberados
+inline uint Graphics::PendingReleases()
+{ return retired.Pending(); }
+
+// retorna linha do tempo de desempenho da CPU e da GPU
+inline Profiler * Graphics::Profile()
+{ return profiler; }
+
+// retorna tempo de CPU gasto em Present no quadro atual (em segundos)
+inline double Graphics::PresentTime()
+{ return presentTime; }
+
 // --------------------------------------------------------------------------------
 
+#endif
+
 #endif
\ No newline at end of file
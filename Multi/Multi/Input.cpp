@@ -1,34 +1,60 @@
 /**********************************************************************************
-// Input (Cdigo Fonte)
+// Input (Código Fonte)
 //
-// Criao:		06 Jan 2020
-// Atualizao:	08 Jul 2023
+// Criação:		06 Jan 2020
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	A classe Input concentra todas as tarefas relacionadas
+// Descrição:	A classe Input concentra todas as tarefas relacionadas
 //              aos dispositivos de entrada do tipo teclado e mouse.
+//              No Windows os eventos chegam pela window procedure. Em
+//              qualquer plataforma outras threads podem postar eventos
+//              (entrada sintética), aplicados na drenagem do quadro.
 //
 **********************************************************************************/
 
 #include "Input.h"
+#include "Clock.h"
+#include <fstream>
+#include <filesystem>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+using std::ifstream;
+using std::ofstream;
+using std::ios;
 
 // -------------------------------------------------------------------------------
-// inicializao de membros estticos da classe
+// inicialização de membros estáticos da classe
 
 bool Input::keys[256] = { 0 };							// estado do teclado/mouse
-bool Input::ctrl[256] = { 0 };							// controle de liberao das teclas
+bool Input::ctrl[256] = { 0 };							// controle de liberação das teclas
 
-int	  Input::mouseX = 0;								// posio do mouse no eixo x
-int	  Input::mouseY = 0;								// posio do mouse no eixo y
+int	  Input::mouseX = 0;								// posição do mouse no eixo x
+int	  Input::mouseY = 0;								// posição do mouse no eixo y
 short Input::mouseWheel = 0;							// valor da roda do mouse
+
+bool  Input::recording = false;							// gravação da entrada ativa
+uint  Input::frame = 0;									// quadro atual da entrada
+uint  Input::recordStart = 0;							// quadro em que a gravação começou
+vector<InputEvent> Input::journal;						// eventos gravados
+vector<InputEvent> Input::batch;						// eventos do quadro atual
+
+// eventos postados por outras threads e ainda não aplicados
+static std::mutex postLock;
+static std::condition_variable postSignal;
+static vector<InputEvent> posted;
+static vector<InputEvent> polled;
 									
 // -------------------------------------------------------------------------------
 
 Input::Input()
 {
-	// supe que a janela j foi criada
+#ifdef _WIN32
+	// supõe que a janela já foi criada
 	// altera a window procedure da janela ativa para InputProc
 	SetWindowLongPtr(GetActiveWindow(), GWLP_WNDPROC, (LONG_PTR)Input::InputProc);
+#endif
 }
 
 // -------------------------------------------------------------------------------
@@ -70,66 +96,340 @@ short Input::MouseWheel()
 
 // -------------------------------------------------------------------------------
 
+void Input::Script(const InputEvent & event)
+{
+	switch (event.type)
+	{
+	case INPUT_KEY:
+		keys[event.vkcode & 0xff] = event.down;
+		break;
+
+	case INPUT_MOVE:
+		mouseX = event.x;
+		mouseY = event.y;
+		break;
+
+	case INPUT_WHEEL:
+		mouseWheel = short(event.x);
+		break;
+	}
+
+	// o quadro recebe todos os eventos, não apenas o estado final;
+	// eventos roteirizados são gerados no instante em que são aplicados
+	batch.push_back(event);
+	if (event.time == 0.0)
+		batch.back().time = Clock::Seconds();
+}
+
+// -------------------------------------------------------------------------------
+
+void Input::Dispatch(const InputEvent & event)
+{
+	Script(event);
+
+	// quadros gravados contam do início da gravação, como os do
+	// roteiro que a execução sem janela aplica a partir do quadro 0
+	if (recording)
+	{
+		journal.push_back(event);
+		journal.back().frame -= recordStart;
+	}
+}
+
+// -------------------------------------------------------------------------------
+
+void Input::Post(const InputEvent & event)
+{
+	{
+		std::lock_guard<std::mutex> guard(postLock);
+		posted.push_back(event);
+	}
+	postSignal.notify_one();
+}
+
+// -------------------------------------------------------------------------------
+
+bool Input::Wait(uint milliseconds)
+{
+	// 0xFFFFFFFF (INFINITE) espera sem prazo
+	std::unique_lock<std::mutex> guard(postLock);
+	auto ready = [] { return !posted.empty(); };
+
+	if (milliseconds == 0xFFFFFFFF)
+	{
+		postSignal.wait(guard, ready);
+		return true;
+	}
+
+	return postSignal.wait_for(guard, std::chrono::milliseconds(milliseconds), ready);
+}
+
+// -------------------------------------------------------------------------------
+
+uint Input::Poll()
+{
+	// troca as filas para aplicar os eventos fora da trava
+	{
+		std::lock_guard<std::mutex> guard(postLock);
+		if (posted.empty())
+			return 0;
+		posted.swap(polled);
+	}
+
+	// eventos postados pertencem ao quadro em que são aplicados
+	for (InputEvent & e : polled)
+	{
+		e.frame = frame;
+		Dispatch(e);
+	}
+
+	uint count = uint(polled.size());
+	polled.clear();
+	return count;
+}
+
+// -------------------------------------------------------------------------------
+
+void Input::Record(bool state)
+{
+	// nova gravação descarta a anterior
+	if (state && !recording)
+	{
+		journal.clear();
+		recordStart = frame;
+	}
+
+	recording = state;
+}
+
+// -------------------------------------------------------------------------------
+
+// grava inteiro sem sinal com 7 bits por byte
+static void WriteVarint(ofstream & fout, uint value)
+{
+	while (value >= 0x80)
+	{
+		fout.put(char((value & 0x7f) | 0x80));
+		value >>= 7;
+	}
+	fout.put(char(value));
+}
+
+// lê inteiro gravado por WriteVarint
+static bool ReadVarint(ifstream & fin, uint & value)
+{
+	value = 0;
+	for (uint shift = 0; shift < 35; shift += 7)
+	{
+		int c = fin.get();
+		if (c == EOF)
+			return false;
+
+		value |= uint(c & 0x7f) << shift;
+		if (!(c & 0x80))
+			return true;
+	}
+	return false;
+}
+
+// -------------------------------------------------------------------------------
+
+bool Input::Save(const string & fileName)
+{
+	ofstream fout(fileName, ios::out | ios::binary | ios::trunc);
+	if (!fout)
+		return false;
+
+	// cabeçalho: identificador, versão e número de eventos
+	const uint header[3] = { RecordMagic, RecordVersion, uint(journal.size()) };
+	fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+	// cada evento: distância em quadros do anterior, tipo e dados
+	uint last = 0;
+	for (const InputEvent & e : journal)
+	{
+		WriteVarint(fout, e.frame - last);
+		last = e.frame;
+
+		switch (e.type)
+		{
+		case INPUT_KEY:
+			fout.put(char(e.down ? INPUT_KEY | 0x80 : INPUT_KEY));
+			fout.put(char(e.vkcode));
+			break;
+
+		case INPUT_MOVE:
+			fout.put(char(INPUT_MOVE));
+			WriteVarint(fout, uint(e.x) & 0xffff);
+			WriteVarint(fout, uint(e.y) & 0xffff);
+			break;
+
+		case INPUT_WHEEL:
+			fout.put(char(INPUT_WHEEL));
+			WriteVarint(fout, uint(e.x) & 0xffff);
+			break;
+		}
+	}
+
+	return bool(fout);
+}
+
+// -------------------------------------------------------------------------------
+
+bool Input::Load(const string & fileName, vector<InputEvent> & events)
+{
+	ifstream fin(fileName, ios::in | ios::binary);
+
+	uint header[3] = { 0 };
+	if (!fin || !fin.read(reinterpret_cast<char*>(header), sizeof(header))
+		|| header[0] != RecordMagic || header[1] != RecordVersion)
+		return false;
+
+	// cada evento ocupa ao menos 2 bytes (quadro e tipo): contagens maiores
+	// que o restante do arquivo vêm de um cabeçalho corrompido
+	std::error_code ec;
+	ullong fileSize = std::filesystem::file_size(fileName, ec);
+	if (ec || header[2] > (fileSize - sizeof(header)) / 2)
+		return false;
+
+	events.clear();
+	events.reserve(header[2]);
+
+	uint frame = 0;
+	for (uint i = 0; i < header[2]; ++i)
+	{
+		InputEvent e = {};
+		uint delta, x, y;
+
+		if (!ReadVarint(fin, delta))
+			return false;
+
+		frame += delta;
+		e.frame = frame;
+
+		int type = fin.get();
+		if (type == EOF)
+			return false;
+
+		e.type = type & 0x7f;
+		switch (e.type)
+		{
+		case INPUT_KEY:
+			e.down = (type & 0x80) != 0;
+			e.vkcode = fin.get() & 0xff;
+			break;
+
+		case INPUT_MOVE:
+			if (!ReadVarint(fin, x) || !ReadVarint(fin, y))
+				return false;
+			e.x = short(x);
+			e.y = short(y);
+			break;
+
+		case INPUT_WHEEL:
+			if (!ReadVarint(fin, x))
+				return false;
+			e.x = short(x);
+			break;
+
+		default:
+			return false;
+		}
+
+		events.push_back(e);
+	}
+
+	return bool(fin);
+}
+
+// -------------------------------------------------------------------------------
+
+#ifdef _WIN32
+
+// instante em que a mensagem atual foi gerada, convertido para o Clock
+// (GetMessageTime tem a resolução do tick do sistema, de 10 a 16 ms)
+static double MessageTime()
+{
+	DWORD age = GetTickCount() - DWORD(GetMessageTime());
+	return Clock::Seconds() - age / 1000.0;
+}
+
+// instante guardado em wParam por Clock::Counter, mesmo se WPARAM tiver 32 bits
+static double CounterTime(WPARAM counter)
+{
+	llong now = Clock::Counter();
+	llong age = llong(WPARAM(now) - counter);
+	return double(now - age) / double(Clock::Frequency());
+}
+
+// -------------------------------------------------------------------------------
+
 LRESULT CALLBACK Input::InputProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
 	switch (msg)
 	{
 	// tecla pressionada
 	case WM_KEYDOWN:
-		keys[wParam] = true;
+		Dispatch({ frame, int(wParam), true, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
 	// tecla liberada
 	case WM_KEYUP:
-		keys[wParam] = false;
+		Dispatch({ frame, int(wParam), false, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 		
 	// movimento do mouse
 	case WM_MOUSEMOVE:			
-		mouseX = GET_X_LPARAM(lParam);
-		mouseY = GET_Y_LPARAM(lParam);
+		Dispatch({ frame, 0, false, INPUT_MOVE, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam), MessageTime() });
 		return 0;
 
 	// movimento da roda do mouse
 	case WM_MOUSEWHEEL:
-		mouseWheel = GET_WHEEL_DELTA_WPARAM(wParam);
+		Dispatch({ frame, 0, false, INPUT_WHEEL, GET_WHEEL_DELTA_WPARAM(wParam), 0, MessageTime() });
 		return 0;
 
-	// boto esquerdo do mouse pressionado
+	// movimento sintético: o gerador guarda o instante exato em wParam
+	case WM_SYNTHETIC_MOVE:
+		Dispatch({ frame, 0, false, INPUT_MOVE, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam), CounterTime(wParam) });
+		return 0;
+
+	// botão esquerdo do mouse pressionado
 	case WM_LBUTTONDOWN:		
 	case WM_LBUTTONDBLCLK:
-		keys[VK_LBUTTON] = true;
+		Dispatch({ frame, VK_LBUTTON, true, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
-	// boto do meio do mouse pressionado
+	// botão do meio do mouse pressionado
 	case WM_MBUTTONDOWN:		
 	case WM_MBUTTONDBLCLK:
-		keys[VK_MBUTTON] = true;
+		Dispatch({ frame, VK_MBUTTON, true, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
-	// boto direito do mouse pressionado
+	// botão direito do mouse pressionado
 	case WM_RBUTTONDOWN:		
 	case WM_RBUTTONDBLCLK:
-		keys[VK_RBUTTON] = true;
+		Dispatch({ frame, VK_RBUTTON, true, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
-	// boto esquerdo do mouse liberado
+	// botão esquerdo do mouse liberado
 	case WM_LBUTTONUP:			
-		keys[VK_LBUTTON] = false;
+		Dispatch({ frame, VK_LBUTTON, false, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
-	// boto do meio do mouse liberado
+	// botão do meio do mouse liberado
 	case WM_MBUTTONUP:			
-		keys[VK_MBUTTON] = false;
+		Dispatch({ frame, VK_MBUTTON, false, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 
-	// boto direito do mouse liberado
+	// botão direito do mouse liberado
 	case WM_RBUTTONUP:			
-		keys[VK_RBUTTON] = false;
+		Dispatch({ frame, VK_RBUTTON, false, INPUT_KEY, 0, 0, MessageTime() });
 		return 0;
 	}
 
 	return CallWindowProc(Window::WinProc, hWnd, msg, wParam, lParam);
 }
 
+#endif
+
 // -------------------------------------------------------------------------------
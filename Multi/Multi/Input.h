@@ -1,12 +1,15 @@
 /**********************************************************************************
-// Input (Arquivo de Cabealho)
+// Input (Arquivo de Cabeçalho)
 //
-// Criao:     06 Jan 2020
-// Atualizao:	08 Jul 2023
+// Criação:     06 Jan 2020
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	A classe Input concentra todas as tarefas relacionadas 
+// Descrição:	A classe Input concentra todas as tarefas relacionadas 
 //              aos dispositivos de entrada do tipo teclado e mouse.
+//              No Windows os eventos chegam pela window procedure. Em
+//              qualquer plataforma outras threads podem postar eventos
+//              (entrada sintética), aplicados na drenagem do quadro.
 //
 **********************************************************************************/
 
@@ -16,6 +19,48 @@
 // ---------------------------------------------------------------------------------
 
 #include "Window.h"
+#include <vector>
+using std::vector;
+
+// ---------------------------------------------------------------------------------
+
+#ifndef _WIN32
+// códigos virtuais das teclas usadas pelo motor, com os valores do Windows
+// para que roteiros e gravações sirvam nas duas plataformas
+enum VirtualKeys
+{
+	VK_LBUTTON = 0x01, VK_RBUTTON = 0x02, VK_MBUTTON = 0x04,
+	VK_BACK = 0x08, VK_TAB = 0x09, VK_RETURN = 0x0D,
+	VK_SHIFT = 0x10, VK_CONTROL = 0x11, VK_MENU = 0x12, VK_PAUSE = 0x13,
+	VK_ESCAPE = 0x1B, VK_SPACE = 0x20,
+	VK_LEFT = 0x25, VK_UP = 0x26, VK_RIGHT = 0x27, VK_DOWN = 0x28,
+	VK_DELETE = 0x2E,
+	VK_F1 = 0x70, VK_F2, VK_F3, VK_F4, VK_F5, VK_F6,
+	VK_F7, VK_F8, VK_F9, VK_F10, VK_F11, VK_F12,
+	VK_OEM_PLUS = 0xBB, VK_OEM_MINUS = 0xBD
+};
+#endif
+
+// ---------------------------------------------------------------------------------
+
+enum InputEventType { INPUT_KEY, INPUT_MOVE, INPUT_WHEEL };
+
+// evento de entrada gravado ou roteirizado
+struct InputEvent
+{
+	uint frame;							// quadro em que o evento ocorre
+	int  vkcode;						// tecla ou botão do mouse (INPUT_KEY)
+	bool down;							// pressionada ou liberada (INPUT_KEY)
+	uint type = INPUT_KEY;				// tipo do evento
+	int  x = 0;							// posição do mouse ou rotação da roda
+	int  y = 0;							// posição do mouse (INPUT_MOVE)
+	double time = 0.0;					// geração do evento em segundos (Clock, 0 = ao ser aplicado)
+};
+
+#ifdef _WIN32
+// movimento do mouse postado com o valor de Clock::Counter em wParam
+const UINT WM_SYNTHETIC_MOVE = WM_APP + 1;
+#endif
 
 // ---------------------------------------------------------------------------------
 
@@ -23,47 +68,84 @@ class Input
 {
 private:
 	static bool	keys[256];				// estado das teclas do teclado/mouse
-	static bool ctrl[256];				// controle da liberao de teclas
+	static bool ctrl[256];				// controle da liberação de teclas
 	
-	static int	 mouseX;			    // posio do mouse eixo x
-	static int	 mouseY;				// posio do mouse eixo y
+	static int	 mouseX;			    // posição do mouse eixo x
+	static int	 mouseY;				// posição do mouse eixo y
 	static short mouseWheel;			// valor da roda do mouse
 
+	static const uint RecordMagic = 0x52495844;	// "DXIR"
+	static const uint RecordVersion = 1;		// versão do arquivo de gravação
+
+	static bool recording;				// gravação da entrada ativa
+	static uint frame;					// quadro atual da entrada
+	static uint recordStart;			// quadro em que a gravação começou
+	static vector<InputEvent> journal;	// eventos gravados
+	static vector<InputEvent> batch;	// eventos do quadro atual
+
+	static void Dispatch(const InputEvent & event);	// aplica e grava evento
+
 public:
 	Input();							// construtor
 	~Input();							// destrutor
 
-	bool KeyDown(int vkcode);		    // retorna se tecla est pressionada
-	bool KeyUp(int vkcode);			    // retorna se tecla est liberada
-	bool KeyPress(int vkcode);		    // novo pressionamento somente aps liberao		
+	bool KeyDown(int vkcode);		    // retorna se tecla está pressionada
+	bool KeyUp(int vkcode);			    // retorna se tecla está liberada
+	bool KeyPress(int vkcode);		    // novo pressionamento somente após liberação		
 	
-	int   MouseX();						// retorna posio x do mouse
-	int   MouseY();						// retorna posio y do mouse
-	short MouseWheel();					// retorna rotao da roda do mouse
+	int   MouseX();						// retorna posição x do mouse
+	int   MouseY();						// retorna posição y do mouse
+	short MouseWheel();					// retorna rotação da roda do mouse
+	const vector<InputEvent> & Events();	// eventos do quadro atual em ordem de chegada
 
+	static void Script(const InputEvent & event);	// aplica evento roteirizado
+	static void Post(const InputEvent & event);		// entrega evento de outra thread
+	static uint Poll();								// aplica eventos postados (retorna quantos)
+	static bool Wait(uint milliseconds);			// espera evento postado (false = prazo esgotado)
+	static void Record(bool state);					// inicia/encerra gravação
+	static void NextFrame();						// avança quadro da entrada
+	static uint Frame();							// retorna quadro da entrada
+	static bool Save(const string & fileName);		// grava eventos em arquivo
+	static bool Load(const string & fileName, vector<InputEvent> & events);	// lê eventos de arquivo
+
+#ifdef _WIN32
 	// trata eventos do Windows
 	static LRESULT CALLBACK InputProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+#endif
 };
 
 // ---------------------------------------------------------------------------------
-// Funes Membro Inline
+// Funções Membro Inline
 
-// retorna verdadeiro se a tecla est pressionada
+// retorna verdadeiro se a tecla está pressionada
 inline bool Input::KeyDown(int vkcode)
 { return keys[vkcode]; }
 
-// retorna verdadeiro se a tecla est liberada
+// retorna verdadeiro se a tecla está liberada
 inline bool Input::KeyUp(int vkcode)
 { return !(keys[vkcode]); }
 
-// retorna a posio do mouse no eixo x
+// retorna a posição do mouse no eixo x
 inline int Input::MouseX()
 { return mouseX; }
 
-// retorna a posio do mouse no eixo y
+// retorna a posição do mouse no eixo y
 inline int Input::MouseY()
 { return mouseY; }
 
+// eventos recebidos desde o último quadro, com o instante de chegada
+// (inclui movimentos intermediários que MouseX e MouseY não guardam)
+inline const vector<InputEvent> & Input::Events()
+{ return batch; }
+
+// avança o quadro usado para marcar os eventos
+inline void Input::NextFrame()
+{ ++frame; batch.clear(); }
+
+// retorna quadro atual da entrada
+inline uint Input::Frame()
+{ return frame; }
+
 // ---------------------------------------------------------------------------------
 
 #endif
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Mesh (Cdigo Fonte)
+// Mesh (Código Fonte)
 //
-// Criao:     28 Abr 2016
-// Atualizao: 14 Set 2023
+// Criação:     28 Abr 2016
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Representa uma malha 3D
+// Descrição:   Representa uma malha 3D
 //
 **********************************************************************************/
 
@@ -21,11 +21,13 @@ Mesh::Mesh()
     ZeroMemory(&vertexBufferView, sizeof(D3D12_VERTEX_BUFFER_VIEW));
     vertexBufferSize = 0;
     vertexBufferStride = 0;
+    vertexBatch = 0;
 
     indexBufferUpload = nullptr;
     indexBufferGPU = nullptr;
     ZeroMemory(&indexBufferView, sizeof(D3D12_INDEX_BUFFER_VIEW));
     indexBufferSize = 0;
+    indexBatch = 0;
     ZeroMemory(&indexFormat, sizeof(DXGI_FORMAT));
 
     cbufferHeap = nullptr;
@@ -39,16 +41,28 @@ Mesh::Mesh()
 
 Mesh::~Mesh()
 {
-    if (vertexBufferUpload) vertexBufferUpload->Release();
-    if (vertexBufferGPU) vertexBufferGPU->Release();
-    if (indexBufferUpload) indexBufferUpload->Release();
-    if (indexBufferGPU) indexBufferGPU->Release();
+    // a GPU pode estar usando os buffers: a liberação
+    // é adiada até a barreira do último quadro que os usou
+    Engine::graphics->Retire(vertexBufferUpload);
+    Engine::graphics->Retire(vertexBufferGPU, vertexBatch);
+    Engine::graphics->Retire(indexBufferUpload);
+    Engine::graphics->Retire(indexBufferGPU, indexBatch);
+    ReleaseConstants();
+}
+
+// -------------------------------------------------------------------------------
 
+void Mesh::ReleaseConstants()
+{
     if (cbufferUpload)
     {
         cbufferUpload->Unmap(0, nullptr);
-        cbufferUpload->Release();
-        cbufferHeap->Release();
+        Engine::graphics->Retire(cbufferUpload);
+        Engine::graphics->Retire(cbufferHeap);
+
+        cbufferUpload = nullptr;
+        cbufferHeap = nullptr;
+        cbufferData = nullptr;
     }
 }
 
@@ -56,50 +70,83 @@ Mesh::~Mesh()
 
 void Mesh::VertexBuffer(const void* vb, uint vbSize, uint vbStride)
 {
-    // guarda tamanho do buffer e vrtice
+    PROFILE_SCOPE("Mesh::VertexBuffer");
+
+    // guarda tamanho do buffer e vértice
     vertexBufferSize = vbSize;
     vertexBufferStride = vbStride;
 
+    // buffers anteriores são liberados quando a GPU deixar de usá-los
+    Engine::graphics->Retire(vertexBufferGPU, vertexBatch);
+
     // aloca recursos para o vertex buffer
     Engine::graphics->Allocate(UPLOAD, vbSize, &vertexBufferUpload);
     Engine::graphics->Allocate(GPU, vbSize, &vertexBufferGPU);
 
-    // copia vrtices para o buffer da GPU usando o buffer de Upload
-    Engine::graphics->Copy(vb, vbSize, vertexBufferUpload, vertexBufferGPU);
+    // copia vértices para o buffer da GPU na fila de cópia
+    vertexBatch = Engine::graphics->Upload(vb, vbSize, vertexBufferUpload, vertexBufferGPU);
+
+    // o buffer de upload só é necessário até a cópia ser executada
+    Engine::graphics->Retire(vertexBufferUpload, vertexBatch);
+    vertexBufferUpload = nullptr;
+
+    // a view é montada uma única vez e lida pelas threads de gravação
+    vertexBufferView.BufferLocation = vertexBufferGPU->GetGPUVirtualAddress();
+    vertexBufferView.StrideInBytes = vertexBufferStride;
+    vertexBufferView.SizeInBytes = vertexBufferSize;
 }
 
 // -------------------------------------------------------------------------------
 
 void Mesh::IndexBuffer(const void* ib, uint ibSize, DXGI_FORMAT ibFormat)
 {
-    // guarda tamanho do buffer e formato dos ndices
+    PROFILE_SCOPE("Mesh::IndexBuffer");
+
+    // guarda tamanho do buffer e formato dos índices
     indexBufferSize = ibSize;
     indexFormat = ibFormat;
 
+    // buffers anteriores são liberados quando a GPU deixar de usá-los
+    Engine::graphics->Retire(indexBufferGPU, indexBatch);
+
     // aloca recursos para o index buffer
     Engine::graphics->Allocate(UPLOAD, ibSize, &indexBufferUpload);
     Engine::graphics->Allocate(GPU, ibSize, &indexBufferGPU);
 
-    // copia ndices para o buffer da GPU usando o buffer de Upload
-    Engine::graphics->Copy(ib, ibSize, indexBufferUpload, indexBufferGPU);
+    // copia índices para o buffer da GPU na fila de cópia
+    indexBatch = Engine::graphics->Upload(ib, ibSize, indexBufferUpload, indexBufferGPU);
+
+    // o buffer de upload só é necessário até a cópia ser executada
+    Engine::graphics->Retire(indexBufferUpload, indexBatch);
+    indexBufferUpload = nullptr;
+
+    // a view é montada uma única vez e lida pelas threads de gravação
+    indexBufferView.BufferLocation = indexBufferGPU->GetGPUVirtualAddress();
+    indexBufferView.Format = indexFormat;
+    indexBufferView.SizeInBytes = indexBufferSize;
 }
 
 // -------------------------------------------------------------------------------
 
 void Mesh::ConstantBuffer(uint objSize, uint objCount)
 {
+    PROFILE_SCOPE("Mesh::ConstantBuffer");
+
     // ---------------
     // Constant Buffer  
     // ---------------
 
-    // o tamanho dos constant buffers precisam ser mltiplos 
-    // do tamanho de alocao mnima do hardware (256 bytes)
+    // o tamanho dos constant buffers precisam ser múltiplos 
+    // do tamanho de alocação mínima do hardware (256 bytes)
     cbufferElementSize = (objSize + 255) & ~255;
 
+    // buffer e heap anteriores são liberados quando a GPU deixar de usá-los
+    ReleaseConstants();
+
     // aloca recursos para o constant buffer
     Engine::graphics->Allocate(CBUFFER, cbufferElementSize * objCount, &cbufferUpload);
 
-    // mapeia memria do upload buffer para um endereo acessvel pela CPU
+    // mapeia memória do upload buffer para um endereço acessível pela CPU
     cbufferUpload->Map(0, nullptr, reinterpret_cast<void**>(&cbufferData));
 
     // ----------------
@@ -125,15 +172,15 @@ void Mesh::ConstantBuffer(uint objSize, uint objCount)
     // precisa de um descritor para cada objeto
     for (uint i = 0; i < objCount; ++i)
     {
-        // desloca para o endereo do i-simo objeto no buffer constante
+        // desloca para o endereço do i-ésimo objeto no buffer constante
         D3D12_GPU_VIRTUAL_ADDRESS cbAddress = cbufferUpload->GetGPUVirtualAddress();
         cbAddress += i * cbufferElementSize;
 
-        // desloca para o endereo do i-simo objeto na heap de descritores
+        // desloca para o endereço do i-ésimo objeto na heap de descritores
         D3D12_CPU_DESCRIPTOR_HANDLE handle = cbufferHeap->GetCPUDescriptorHandleForHeapStart();
         handle.ptr += i * cbufferDescriptorSize;
 
-        // informaes do constant buffer
+        // informações do constant buffer
         D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc;
         cbvDesc.BufferLocation = cbAddress;
         cbvDesc.SizeInBytes = cbufferElementSize;
@@ -154,10 +201,8 @@ void Mesh::CopyConstants(const void* cbData, uint cbIndex)
 
 D3D12_VERTEX_BUFFER_VIEW* Mesh::VertexBufferView()
 {
-    vertexBufferView.BufferLocation = vertexBufferGPU->GetGPUVirtualAddress();
-    vertexBufferView.StrideInBytes = vertexBufferStride;
-    vertexBufferView.SizeInBytes = vertexBufferSize;
-
+    // o desenho só pode executar depois da cópia dos vértices
+    Engine::graphics->Require(vertexBatch);
     return &vertexBufferView;
 }
 
@@ -165,10 +210,8 @@ D3D12_VERTEX_BUFFER_VIEW* Mesh::VertexBufferView()
 
 D3D12_INDEX_BUFFER_VIEW * Mesh::IndexBufferView()
 {
-    indexBufferView.BufferLocation = indexBufferGPU->GetGPUVirtualAddress();
-    indexBufferView.Format = indexFormat;
-    indexBufferView.SizeInBytes = indexBufferSize;
-
+    // o desenho só pode executar depois da cópia dos índices
+    Engine::graphics->Require(indexBatch);
     return &indexBufferView;
 }
 
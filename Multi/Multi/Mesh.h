@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Mesh (Arquivo de Cabealho)
+// Mesh (Arquivo de Cabeçalho)
 //
-// Criao:     28 Abr 2016
-// Atualizao: 14 Set 2023
+// Criação:     28 Abr 2016
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Representa uma malha 3D
+// Descrição:   Representa uma malha 3D
 //
 **********************************************************************************/
 
@@ -37,30 +37,34 @@ class Mesh
 private:
     ID3D12Resource* vertexBufferUpload;                                     // buffer de Upload CPU -> GPU
     ID3D12Resource* vertexBufferGPU;                                        // buffer na GPU
-    D3D12_VERTEX_BUFFER_VIEW vertexBufferView;                              // descritor do buffer de vrtices
-    uint vertexBufferSize;                                                  // tamanho do buffer de vrtices
-    uint vertexBufferStride;                                                // tamanho de um vrtice
+    D3D12_VERTEX_BUFFER_VIEW vertexBufferView;                              // descritor do buffer de vértices
+    uint vertexBufferSize;                                                  // tamanho do buffer de vértices
+    uint vertexBufferStride;                                                // tamanho de um vértice
+    ullong vertexBatch;                                                     // lote de cópia dos vértices
                                                                             
     ID3D12Resource* indexBufferUpload;                                      // buffer de Upload CPU -> GPU
     ID3D12Resource* indexBufferGPU;                                         // buffers na GPU
-    D3D12_INDEX_BUFFER_VIEW indexBufferView;                                // descritor do buffer de ndices
-    uint indexBufferSize;                                                   // tamanho do buffer de ndices
-    DXGI_FORMAT indexFormat;                                                // formato do buffer de ndices
+    D3D12_INDEX_BUFFER_VIEW indexBufferView;                                // descritor do buffer de índices
+    uint indexBufferSize;                                                   // tamanho do buffer de índices
+    DXGI_FORMAT indexFormat;                                                // formato do buffer de índices
+    ullong indexBatch;                                                      // lote de cópia dos índices
                                                                             
     ID3D12DescriptorHeap* cbufferHeap;                                      // heap de descritores do buffer constante
     ID3D12Resource* cbufferUpload;                                          // buffer de Upload CPU -> GPU
     byte* cbufferData;                                                      // buffer na CPU
     uint cbufferDescriptorSize;                                             // tamanho do descritor 
     uint cbufferElementSize;                                                // tamanho de um elemento no buffer 
+
+    void ReleaseConstants();                                                // libera constant buffer e sua heap
                                                                             
 public:                                                                     
-    unordered_map<string, SubMesh> SubMesh;                                 // uma malha pode armazenar mltiplas sub-malhas
+    unordered_map<string, SubMesh> SubMesh;                                 // uma malha pode armazenar múltiplas sub-malhas
                                                                             
     Mesh();                                                                 // construtor
     ~Mesh();                                                                // destrutor
 
-    void VertexBuffer(const void* vb, uint vbSize, uint vbStride);          // aloca e copia vrtices para vertex buffer 
-    void IndexBuffer(const void* ib, uint ibSize, DXGI_FORMAT ibFormat);    // aloca e copia ndices para index buffer 
+    void VertexBuffer(const void* vb, uint vbSize, uint vbStride);          // aloca e copia vértices para vertex buffer 
+    void IndexBuffer(const void* ib, uint ibSize, DXGI_FORMAT ibFormat);    // aloca e copia índices para index buffer 
     void ConstantBuffer(uint objSize, uint objCount = 1);                   // aloca constant buffer com tamanho solicitado
     void CopyConstants(const void* cbData, uint cbIndex = 0);               // copia dados para o constant buffer
 
@@ -0,0 +1,74 @@
+/**********************************************************************************
+// Meshlet (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Descarte de grupos de triângulos na CPU. Cada grupo criado por
+//              Geometry::Clusterize é testado contra o volume de visão, pela
+//              esfera envolvente, e contra a posição da câmera, pelo cone das
+//              normais. Os grupos visíveis são emitidos como faixas contínuas
+//              de índices, unindo grupos vizinhos no buffer de índices.
+//
+**********************************************************************************/
+
+#ifndef DXUT_MESHLET_H_
+#define DXUT_MESHLET_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Geometry.h"
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// faixa contínua de índices de grupos visíveis
+struct MeshletRange
+{
+    uint startIndex;                                // primeiro índice da faixa
+    uint indexCount;                                // número de índices da faixa
+};
+
+// -------------------------------------------------------------------------------
+
+class MeshletCuller
+{
+private:
+    ullong tested;                                  // triângulos testados desde o início
+    ullong outside;                                 // triângulos fora do volume de visão
+    ullong backfacing;                              // triângulos de costas para a câmera
+
+public:
+    MeshletCuller();                                // construtor
+
+    // acrescenta a ranges as faixas visíveis e retorna os triângulos visíveis
+    // (matriz combinada transposta, como em RasterDraw, e câmera no espaço do objeto)
+    uint Cull(const Geometry & geometry, const XMFLOAT4X4 & worldViewProj,
+              const XMFLOAT3 & eye, vector<MeshletRange> & ranges);
+
+    ullong Tested() const;                          // triângulos testados desde o início
+    ullong Outside() const;                         // descartados pelo volume de visão
+    ullong Backfacing() const;                      // descartados pelo cone das normais
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// triângulos testados desde o início
+inline ullong MeshletCuller::Tested() const
+{ return tested; }
+
+// triângulos em grupos fora do volume de visão
+inline ullong MeshletCuller::Outside() const
+{ return outside; }
+
+// triângulos em grupos inteiramente de costas para a câmera
+inline ullong MeshletCuller::Backfacing() const
+{ return backfacing; }
+
+// -------------------------------------------------------------------------------
+
+#endif
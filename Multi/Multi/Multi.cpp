@@ -2,7 +2,7 @@
 // Multi (Código Fonte)
 //
 // Criação:     27 Abr 2016
-// Atualização: 15 Set 2023
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
 // Descrição:   Constrói cena usando vários buffers, um por objeto
@@ -17,8 +17,13 @@ using namespace std;
 
 #include <fstream>
 #include <sstream>
+#include <iomanip>
+#include <thread>
 #include <vector>
+#include <random>
+#include <algorithm>
 #include <DirectXMath.h>
+#include <DirectXCollision.h>
 // ------------------------------------------------------------------------------
 
 struct ObjData {
@@ -35,6 +40,48 @@ struct ObjectConstants
       0.0f, 0.0f, 0.0f, 1.0f };
 };
 
+// objeto como o desenho o enxerga: cópia feita em Update
+struct DrawItem
+{
+    Mesh * mesh;                                    // malha do objeto
+    SubMesh submesh;                                // sub-malha desenhada
+    ObjectConstants constants;                      // matriz combinada do quadro
+    bool lines;                                     // sub-malha é uma lista de linhas (arestas)
+};
+
+// imagem gerada pelo rasterizador por software no encerramento (vazio = nenhuma)
+static string rasterOutput;
+
+static bool occlusionCulling = false;   // descarta objetos escondidos antes do desenho
+static uint occlusionViews = 0;         // vistas aleatórias comparadas com a referência
+static uint scatterCount = 0;           // caixas espalhadas aleatoriamente na cena inicial
+static float lodPixels = 0.0f;          // desvio tolerado em pixels pelos níveis de detalhe (0 = sem LOD)
+static bool meshletCulling = false;     // descarta grupos de triângulos fora da vista ou de costas
+static bool tessellate = false;         // geometrias paramétricas na tesselação que a vista pede
+static float normalCrease = 0.0f;       // ângulo de vinco das normais geradas (0 = sem normais)
+static bool edgeLines = false;          // arame desenhado como lista de linhas com as arestas únicas
+
+// ------------------------------------------------------------------------------
+
+// interpola matrizes de mundo decompondo escala, rotação e translação
+static XMMATRIX Interpolate(const XMFLOAT4X4 & from, const XMFLOAT4X4 & to, float t)
+{
+    XMMATRIX b = XMLoadFloat4x4(&to);
+
+    // objetos parados não precisam de interpolação
+    if (t >= 1.0f || memcmp(&from, &to, sizeof(XMFLOAT4X4)) == 0)
+        return b;
+
+    XMVECTOR s0, r0, p0, s1, r1, p1;
+    if (!XMMatrixDecompose(&s0, &r0, &p0, XMLoadFloat4x4(&from)) || !XMMatrixDecompose(&s1, &r1, &p1, b))
+        return b;
+
+    return XMMatrixAffineTransformation(
+        XMVectorLerp(s0, s1, t), XMVectorZero(),
+        XMQuaternionSlerp(r0, r1, t),
+        XMVectorLerp(p0, p1, t));
+}
+
 // ------------------------------------------------------------------------------
 
 class Multi : public App
@@ -42,9 +89,63 @@ class Multi : public App
 private:
     ID3D12RootSignature* rootSignature = nullptr;
     ID3D12PipelineState* pipelineState = nullptr;
+    ID3D12PipelineState* linePipelineState = nullptr;
     vector<Object> scene;
     vector<Geometry> vertices;
 
+    // Update publica uma cópia da cena que Draw consome, mesmo
+    // quando Draw roda na thread de desenho (Engine::RenderThread)
+    TripleBuffer<vector<DrawItem>> frames;
+    vector<Mesh*> removed;
+
+    // descarte por oclusão: caixas locais paralelas a scene e dados do quadro
+    Occlusion * occlusion = nullptr;
+    vector<BoundingBox> bounds;
+    vector<XMFLOAT4X4> transforms;
+    vector<pair<float, uint>> occluders;
+    vector<bool> hidden;
+    double cullTime = 0;
+    ullong cullFrames = 0;
+    ullong occluderCount = 0;
+
+    // níveis de detalhe: sub-malha escolhida para cada objeto no quadro
+    vector<SubMesh> details;
+    double simplifyTime = 0;
+    ullong simplifyTriangles = 0;
+    ullong lodTriangles = 0;
+    ullong fullTriangles = 0;
+    ullong levelSwitches = 0;
+
+    // tesselação: níveis de cada conjunto de parâmetros e triângulos desenhados
+    ParametricCache parametric;
+    ullong tessellatedTriangles = 0;
+    ullong nominalTriangles = 0;
+    ullong finestTriangles = 0;
+
+    // normais geradas e desvio em relação às normais (vn) dos arquivos OBJ
+    double normalTime = 0;
+    ullong normalTriangles = 0;
+    ullong normalSplits = 0;
+    double normalError = 0;
+    double normalMaxError = 0;
+    ullong normalCorners = 0;
+
+    // grupos de triângulos: câmera no espaço de cada objeto e faixas visíveis
+    MeshletCuller meshletCuller;
+    vector<XMFLOAT3> eyes;
+    vector<MeshletRange> ranges;
+    double meshletTime = 0;
+    ullong meshletTriangles = 0;
+    ullong meshletCount = 0;
+    ullong meshletVertices = 0;
+
+    // arestas: custo da extração e primitivas desenhadas como linhas
+    double edgeTime = 0;
+    ullong edgeTriangles = 0;
+    ullong edgeCount = 0;
+    ullong lineCount = 0;
+    ullong lineTriangles = 0;
+
     Timer timer;
     bool spinning = true;
 
@@ -63,20 +164,32 @@ private:
 public:
     void Init();
     void Update();
+    void FixedUpdate();
     void Draw();
     void Finalize();
+    ullong Hash();
     Geometry LoadOBJ(const std::string& filename);
+    void BuildNormals(Geometry & geometry);
+    void BuildLods(Geometry & geometry);
+    void BuildMeshlets(Geometry & geometry);
+    void BuildEdges(Geometry & geometry);
+    SubMesh Detail(uint i, uint level) const;
+    void Rasterize(const string & fileName);
+    void Cull();
+    void CheckOcclusion(uint views);
     void BuildRootSignature();
     void BuildPipelineState();
 };
 
 Geometry Multi::LoadOBJ(const std::string& filename) {
+    PROFILE_SCOPE("LoadOBJ");
     Geometry objData;
     ifstream file(filename);
     string line;
 
     vector<XMFLOAT3> positions;
     vector<XMFLOAT3> normals;
+    vector<uint32_t> corners;   // normal (vn) de cada canto dos triângulos
 
     while (getline(file, line)) {
        istringstream iss(line);
@@ -121,6 +234,7 @@ Geometry Multi::LoadOBJ(const std::string& filename) {
                 objData.indices.push_back(v2 - 1);
                 objData.indices.push_back(v3 - 1);
             }
+            corners.insert(corners.end(), { n1 - 1, n2 - 1, n3 - 1 });
         }
     }
 
@@ -130,6 +244,29 @@ Geometry Multi::LoadOBJ(const std::string& filename) {
         vertex.color = XMFLOAT4(DirectX::Colors::DimGray);
         objData.vertices.push_back(vertex);
     }
+    BuildNormals(objData);
+
+    // compara com as normais do arquivo canto a canto (vértices divididos mantêm a ordem dos cantos)
+    if (!objData.normals.empty())
+    {
+        for (size_t c = 0; c < corners.size() && c < objData.indices.size(); ++c)
+        {
+            if (corners[c] >= normals.size())
+                continue;
+
+            XMVECTOR mine = XMLoadFloat3(&objData.normals[objData.indices[c]]);
+            XMVECTOR file = XMVector3Normalize(XMLoadFloat3(&normals[corners[c]]));
+            double error = XMConvertToDegrees(XMVectorGetX(XMVector3AngleBetweenNormals(mine, file)));
+            normalError += error;
+            if (error > normalMaxError)
+                normalMaxError = error;
+            ++normalCorners;
+        }
+    }
+
+    BuildLods(objData);
+    BuildMeshlets(objData);
+    BuildEdges(objData);
     vertices.push_back(objData);
     return objData;
 }
@@ -139,8 +276,6 @@ Geometry Multi::LoadOBJ(const std::string& filename) {
 
 void Multi::Init()
 {
-    graphics->ResetCommands();
-
     // -----------------------------
     // Parâmetros Iniciais da Câmera
     // -----------------------------
@@ -175,6 +310,7 @@ void Multi::Init()
 
     for (auto& v : grid.vertices) v.color = XMFLOAT4(DirectX::Colors::DimGray);
 
+    BuildEdges(grid);
     vertices.push_back(grid);
     // ---------------------------------------------------------------
     // Alocação e Cópia de Vertex, Index e Constant Buffers para a GPU
@@ -189,7 +325,39 @@ void Multi::Init()
     gridObj.mesh->IndexBuffer(grid.IndexData(), grid.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
     gridObj.mesh->ConstantBuffer(sizeof(ObjectConstants));
     gridObj.submesh.indexCount = grid.IndexCount();
+    gridObj.previous = gridObj.world;
     scene.push_back(gridObj);
+
+    // paredes e caixas pequenas em posições aleatórias: Multi.exe --scatter 300
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    for (uint i = 0; i < scatterCount; ++i)
+    {
+        bool wall = i % 30 == 0;
+        float width = wall ? 0.5f + 3.0f * unit(random) : 0.1f + 0.4f * unit(random);
+        float height = wall ? 0.5f + 2.0f * unit(random) : width;
+        float depth = wall ? 0.2f + unit(random) : width;
+
+        Box box(width, height, depth);
+        for (auto& v : box.vertices) v.color = XMFLOAT4(DirectX::Colors::DimGray);
+        BuildEdges(box);
+        vertices.push_back(box);
+
+        Object obj;
+        XMStoreFloat4x4(&obj.world, XMMatrixTranslation(6.0f * unit(random) - 3.0f, 0.5f * height, 6.0f * unit(random) - 3.0f));
+        obj.mesh = new Mesh();
+        obj.mesh->VertexBuffer(box.VertexData(), box.VertexCount() * sizeof(Vertex), sizeof(Vertex));
+        obj.mesh->IndexBuffer(box.IndexData(), box.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
+        obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
+        obj.submesh.indexCount = box.IndexCount();
+        obj.previous = obj.world;
+        scene.push_back(obj);
+    }
+
+    // buffer de oclusão com 1/4 da largura da janela
+    if (occlusionCulling)
+        occlusion = new Occlusion(256, uint(256 / window->AspectRatio()));
  
     // ---------------------------------------
 
@@ -197,7 +365,6 @@ void Multi::Init()
     BuildPipelineState();    
 
     // ---------------------------------------
-    graphics->SubmitCommands();
 
     timer.Start();
 }
@@ -206,17 +373,25 @@ void Multi::Init()
 
 void Multi::Update()
 {
+    // malhas removidas no quadro anterior: o desenho já não as usa
+    if (!removed.empty())
+    {
+        for (Mesh * mesh : removed)
+            delete mesh;
+        removed.clear();
+    }
+
     // sai com o pressionamento da tecla ESC
     if (input->KeyPress(VK_ESCAPE))
         window->Close();
 
     if (input->KeyPress('B')) {
         Box newBox(2.0f, 2.0f, 2.0f);
-        graphics->ResetCommands();
         //Colocando cor nos vertices
         for (auto& v : newBox.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildEdges(newBox);
         vertices.push_back(newBox);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -228,18 +403,24 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newBox.IndexData(), newBox.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newBox.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     //Tecla C para adicionar Cylinder
     if (input->KeyPress('C') ) {
-        Cylinder newCylinder(1.0f, 0.5f, 3.0f, 20, 10); //Cria novo Cylinder
-        graphics->ResetCommands();
+        // com --tessellate, todos os níveis vêm do cache de geometrias paramétricas
+        uint nominal = 0;
+        Geometry newCylinder = tessellate ?
+            parametric.Build({ PARAMETRIC_CYLINDER, 1.0f, 0.5f, 3.0f, 20, 10 }, nominal) :
+            Geometry(Cylinder(1.0f, 0.5f, 3.0f, 20, 10)); //Cria novo Cylinder
         //Colocando cor nos vertices
         for (auto& v : newCylinder.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildNormals(newCylinder);
+        BuildLods(newCylinder);
+        BuildMeshlets(newCylinder);
+        BuildEdges(newCylinder);
         vertices.push_back(newCylinder);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -251,19 +432,27 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newCylinder.IndexData(), newCylinder.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newCylinder.IndexCount();
+        obj.detail = nominal;
+        obj.nominal = nominal;
+        obj.parametric = tessellate;
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
 
     //Tecla S para adicionar Sphere
     if (input->KeyPress('S')) {
-        Sphere newSphere(1.0f, 20, 20); //Cria nova Sphere
-        graphics->ResetCommands();
+        uint nominal = 0;
+        Geometry newSphere = tessellate ?
+            parametric.Build({ PARAMETRIC_SPHERE, 1.0f, 0.0f, 0.0f, 20, 20 }, nominal) :
+            Geometry(Sphere(1.0f, 20, 20)); //Cria nova Sphere
         //Colocando cor nos vertices
         for (auto& v : newSphere.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildNormals(newSphere);
+        BuildLods(newSphere);
+        BuildMeshlets(newSphere);
+        BuildEdges(newSphere);
         vertices.push_back(newSphere);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -275,18 +464,26 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newSphere.IndexData(), newSphere.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newSphere.IndexCount();
+        obj.detail = nominal;
+        obj.nominal = nominal;
+        obj.parametric = tessellate;
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     //Tecla G para adicionar GeoSphere
     if (input->KeyPress('G')) {
-        GeoSphere newGeoSphere(1.0f, 20); //Cria nova GeoSphere
-        graphics->ResetCommands();
+        uint nominal = 0;
+        Geometry newGeoSphere = tessellate ?
+            parametric.Build({ PARAMETRIC_GEOSPHERE, 1.0f, 0.0f, 0.0f, 20, 0 }, nominal) :
+            Geometry(GeoSphere(1.0f, 20)); //Cria nova GeoSphere
         //Colocando cor nos vertices
         for (auto& v : newGeoSphere.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildNormals(newGeoSphere);
+        BuildLods(newGeoSphere);
+        BuildMeshlets(newGeoSphere);
+        BuildEdges(newGeoSphere);
         vertices.push_back(newGeoSphere);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -298,18 +495,20 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newGeoSphere.IndexData(), newGeoSphere.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newGeoSphere.IndexCount();
+        obj.detail = nominal;
+        obj.nominal = nominal;
+        obj.parametric = tessellate;
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     //Tecla P para adicionar Plane(Grid)
     if (input->KeyPress('P')) {
         Grid newGrid(3.0f, 3.0f, 20, 20); //Cria novo Grid
-        graphics->ResetCommands();
         //Colocando cor nos vertices
         for (auto& v : newGrid.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildEdges(newGrid);
         vertices.push_back(newGrid);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -321,18 +520,17 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newGrid.IndexData(), newGrid.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newGrid.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     //Tecla Q para adicionar Quad
     if (input->KeyPress('Q') ) {
         Quad newQuad(2.0f, 2.0f); //Cria novo Quad
-        graphics->ResetCommands();
         //Colocando cor nos vertices
         for (auto& v : newQuad.vertices) {
             v.color = XMFLOAT4(DirectX::Colors::DimGray);
         }
+        BuildEdges(newQuad);
         vertices.push_back(newQuad);
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
@@ -344,9 +542,8 @@ void Multi::Update()
         obj.mesh->IndexBuffer(newQuad.IndexData(), newQuad.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = newQuad.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     //Ball, Capsule, House, Monkey e Thorus
     else if (input->KeyPress('1')) {
@@ -355,8 +552,6 @@ void Multi::Update()
         // Carregar o arquivo .obj
         Geometry ballData = LoadOBJ("ball.obj");
 
-        graphics->ResetCommands();
-
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.5f, 0.5f, 0.5f) *
@@ -367,9 +562,8 @@ void Multi::Update()
         obj.mesh->IndexBuffer(ballData.IndexData(), ballData.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = ballData.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('2')) {
         OutputDebugString("Capsule\n");
@@ -377,8 +571,6 @@ void Multi::Update()
         // Carregar o arquivo .obj
         Geometry ballData = LoadOBJ("capsule.obj");
 
-        graphics->ResetCommands();
-
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.5f, 0.5f, 0.5f) *
@@ -389,9 +581,8 @@ void Multi::Update()
         obj.mesh->IndexBuffer(ballData.IndexData(), ballData.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = ballData.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('3')) {
         OutputDebugString("House\n");
@@ -399,8 +590,6 @@ void Multi::Update()
         // Carregar o arquivo .obj
         Geometry ballData = LoadOBJ("house.obj");
 
-        graphics->ResetCommands();
-
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.5f, 0.5f, 0.5f) *
@@ -411,9 +600,8 @@ void Multi::Update()
         obj.mesh->IndexBuffer(ballData.IndexData(), ballData.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = ballData.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('4')) {
         OutputDebugString("Monkey\n");
@@ -421,8 +609,6 @@ void Multi::Update()
         // Carregar o arquivo .obj
         Geometry ballData = LoadOBJ("monkey.obj");
 
-        graphics->ResetCommands();
-
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.5f, 0.5f, 0.5f) *
@@ -433,9 +619,8 @@ void Multi::Update()
         obj.mesh->IndexBuffer(ballData.IndexData(), ballData.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = ballData.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('5')) {
         OutputDebugString("Thorus\n");
@@ -443,8 +628,6 @@ void Multi::Update()
         // Carregar o arquivo .obj
         Geometry ballData = LoadOBJ("thorus.obj");
 
-        graphics->ResetCommands();
-
         Object obj; //Objeto
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.5f, 0.5f, 0.5f) *
@@ -455,14 +638,11 @@ void Multi::Update()
         obj.mesh->IndexBuffer(ballData.IndexData(), ballData.IndexCount() * sizeof(uint), DXGI_FORMAT_R32_UINT);
         obj.mesh->ConstantBuffer(sizeof(ObjectConstants));
         obj.submesh.indexCount = ballData.IndexCount();
+        obj.previous = obj.world;
         scene.push_back(obj);
-
-        graphics->SubmitCommands();
         }
     //Tab para selecionar figura
     if (input->KeyPress(VK_TAB)) {
-        graphics->ResetCommands();
-
         // Reverte a cor do objeto atual antes de selecionar o pr�ximo
         if (!scene.empty() && selecionado >= 0) {
             for (auto& v : vertices[selecionado].vertices) {
@@ -496,13 +676,10 @@ void Multi::Update()
             scene[selecionado].mesh->ConstantBuffer(sizeof(ObjectConstants));
             scene[selecionado].submesh.indexCount = vertices[selecionado].IndexCount();
         }
-
-        graphics->SubmitCommands();
     }
 
     if (input->KeyPress(VK_SHIFT)) {
         OutputDebugString("Remover select");
-        graphics->ResetCommands();
 
         if (!scene.empty() && selecionado >= 0) {
             // Reverte a cor do objeto selecionado para a cor padrão
@@ -518,7 +695,6 @@ void Multi::Update()
         }
 
         selecionado = -1; // Reseta o índice de seleção
-        graphics->SubmitCommands();
     
     }
 
@@ -526,12 +702,13 @@ void Multi::Update()
     if (input->KeyPress(VK_DELETE)) {
 
         if (selecionado >= 0) {
-            graphics->ResetCommands();
-
+            // o quadro em desenho ainda pode usar a malha
+            removed.push_back(scene[selecionado].mesh);
             scene.erase(scene.begin() + selecionado);
             vertices.erase(vertices.begin() + selecionado);
+            if (selecionado < int(bounds.size()))
+                bounds.erase(bounds.begin() + selecionado);
             selecionado = -1;
-            graphics->SubmitCommands();
         }
 
     }    // ativa ou desativa o giro do objeto
@@ -575,67 +752,11 @@ void Multi::Update()
         radius = radius < 3.0f ? 3.0f : (radius > 15.0f ? 15.0f : radius);
     }
 
-    if (input->KeyDown(VK_CONTROL) && ((input->KeyDown('E') || input->KeyDown('e')) && input->KeyDown(VK_OEM_PLUS))) {
-        OutputDebugString("Escala aumentar");
-
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
-
-            // Aplicando a escala diretamente
-            float scaleX = 1.1f;
-            float scaleY = 1.1f;
-            float scaleZ = 1.1f;
-
-            // Mudando a escala
-            XMMATRIX newWorld = XMMatrixScaling(scaleX, scaleY, scaleZ) * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
-
-            // Atualizando os constantes do objeto
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
-
-            graphics->SubmitCommands();
-        }
-    }
-
-    // Diminuir escala do objeto selecionado com a combinação de teclas
-    if (input->KeyDown(VK_CONTROL) && ((input->KeyDown('E') || input->KeyDown('e')) && input->KeyDown(VK_OEM_MINUS))) {
-        OutputDebugString("Diminuir a imagem");
-
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
-
-            // Aplicando a redução de escala diretamente
-            float scaleX = 0.9f;
-            float scaleY = 0.9f;
-            float scaleZ = 0.9f;
-
-            // Mudando a escala
-            XMMATRIX newWorld = XMMatrixScaling(scaleX, scaleY, scaleZ) * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
-
-            // Atualizando os constantes do objeto
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
-
-            graphics->SubmitCommands();
-        }
-    }
-
-
-
-
     // Rodar no eixo X
     if (input->KeyDown(VK_CONTROL) && (input->KeyDown('X') || input->KeyDown('x')) && (input->KeyPress('R') || input->KeyPress('r'))) {
         OutputDebugString("Rodando no eixo X");
 
         if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
-
             // Convertendo para radianos
             float rotX = XMConvertToRadians(-0.1f);
             float rotY = 0.0f;
@@ -645,15 +766,8 @@ void Multi::Update()
             XMMATRIX w = XMLoadFloat4x4(&scene[selecionado].world);
             w = XMMatrixRotationX(rotX) * XMMatrixRotationY(rotY) * XMMatrixRotationZ(rotZ) * w;
 
+            // as constantes saem da cópia da cena publicada no fim de Update
             XMStoreFloat4x4(&scene[selecionado].world, w);
-
-            // Atualizando o buffer de constantes
-            XMMATRIX wvp = w * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            ObjectConstants constants;
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
-
-            graphics->SubmitCommands();
         }
     }
 
@@ -663,8 +777,6 @@ void Multi::Update()
         OutputDebugString("Rodando no eixo Y");
 
         if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
-
             // Convertendo para radianos
             float rotX = 0.0f;
             float rotY = XMConvertToRadians(-0.1f);
@@ -674,15 +786,8 @@ void Multi::Update()
             XMMATRIX w = XMLoadFloat4x4(&scene[selecionado].world);
             w = XMMatrixRotationX(rotX) * XMMatrixRotationY(rotY) * XMMatrixRotationZ(rotZ) * w;
 
+            // as constantes saem da cópia da cena publicada no fim de Update
             XMStoreFloat4x4(&scene[selecionado].world, w);
-
-            // Atualizando o buffer de constantes
-            XMMATRIX wvp = w * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            ObjectConstants constants;
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
-
-            graphics->SubmitCommands();
         }
     }
 
@@ -692,8 +797,6 @@ void Multi::Update()
         OutputDebugString("Rodando no eixo Z");
 
         if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
-
             // Convertendo para radianos
             float rotX = 0.0f;
             float rotY = 0.0f;
@@ -703,231 +806,659 @@ void Multi::Update()
             XMMATRIX w = XMLoadFloat4x4(&scene[selecionado].world);
             w = XMMatrixRotationX(rotX) * XMMatrixRotationY(rotY) * XMMatrixRotationZ(rotZ) * w;
 
+            // as constantes saem da cópia da cena publicada no fim de Update
             XMStoreFloat4x4(&scene[selecionado].world, w);
+        }
+    }
+
+    lastMousePosX = mousePosX;
+    lastMousePosY = mousePosY;
+
+    // converte coordenadas esféricas para cartesianas
+    float x = radius * sinf(phi) * cosf(theta);
+    float z = radius * sinf(phi) * sinf(theta);
+    float y = radius * cosf(phi);
+
+    // constrói a matriz da câmera (view matrix)
+    XMVECTOR pos = XMVectorSet(x, y, z, 1.0f);
+    XMVECTOR target = XMVectorZero();
+    XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+    XMMATRIX view = XMMatrixLookAtLH(pos, target, up);
+    XMStoreFloat4x4(&View, view);
+
+    // carrega matriz de projeção em uma XMMATRIX
+    XMMATRIX proj = XMLoadFloat4x4(&Proj);
+
+    // ajusta o buffer constante de cada objeto
+    PROFILE_SCOPE("WVP");
 
-            // Atualizando o buffer de constantes
-            XMMATRIX wvp = w * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            ObjectConstants constants;
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+    transforms.resize(scene.size());
+    details.resize(scene.size());
+    eyes.resize(scene.size());
 
-            graphics->SubmitCommands();
+    // pixels por unidade de mundo a uma unidade de distância da câmera
+    float pixelsPerUnit = Proj._22 * 0.5f * window->Height();
+
+    for (uint i = 0; i < scene.size(); ++i)
+    {
+        const Object & obj = scene[i];
+
+        // interpola entre os dois últimos passos da simulação
+        XMMATRIX world = Interpolate(obj.previous, obj.world, float(interpolation));
+
+        // nível mais simples cujo desvio projetado cabe na tolerância, partindo
+        // do nível do quadro anterior para não alternar perto do limite
+        details[i] = Detail(i, obj.nominal);
+        if (lodPixels > 0.0f && i < vertices.size() && vertices[i].lods.size() > 1)
+        {
+            float scale = XMVectorGetX(XMVectorMax(XMVector3Length(world.r[0]),
+                XMVectorMax(XMVector3Length(world.r[1]), XMVector3Length(world.r[2]))));
+            float distance = XMVectorGetX(XMVector3Length(XMVectorSubtract(world.r[3], pos)));
+            float pixels = distance > 0.0f ? scale * pixelsPerUnit / distance : 1e30f;
+
+            uint level = vertices[i].Select(obj.detail, pixels, lodPixels);
+            if (level != obj.detail)
+                ++levelSwitches;
+            scene[i].detail = level;
+            details[i] = Detail(i, level);
         }
+
+        // continua desenhando até o objeto alcançar o último passo
+        if (memcmp(&obj.previous, &obj.world, sizeof(XMFLOAT4X4)) != 0)
+            Engine::Invalidate();
+
+        // constrói matriz combinada (world x view x proj)
+        XMMATRIX WorldViewProj = world * view * proj;        
+
+        // cone das normais dos grupos é testado no espaço do objeto
+        if (i < vertices.size() && !vertices[i].meshlets.empty())
+            XMStoreFloat3(&eyes[i], XMVector3TransformCoord(pos, XMMatrixInverse(nullptr, world)));
+        XMStoreFloat4x4(&transforms[i], XMMatrixTranspose(WorldViewProj));
+    }
+
+    // objetos escondidos atrás dos maiores não são desenhados
+    hidden.assign(scene.size(), false);
+    if (occlusion)
+    {
+        Timer watch;
+        watch.Start();
+        Cull();
+        cullTime += watch.Elapsed();
+        ++cullFrames;
     }
 
-    // Translação para a direita (eixo X positivo)
-    if (input->KeyDown('T') && input->KeyDown(VK_RIGHT)) {
-        OutputDebugString("Translação no eixo direita");
+    // guarda as matrizes combinadas para o desenho
+    vector<DrawItem> & items = frames.Write();
+    items.clear();
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+    for (uint i = 0; i < scene.size(); ++i)
+    {
+        if (hidden[i])
+            continue;
 
-            // Translação no eixo X (direita)
-            XMMATRIX translation = XMMatrixTranslation(0.1f, 0.0f, 0.0f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+        lodTriangles += details[i].indexCount / 3;
+        fullTriangles += Detail(i, scene[i].nominal).indexCount / 3;
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+        if (scene[i].parametric)
+        {
+            tessellatedTriangles += details[i].indexCount / 3;
+            nominalTriangles += Detail(i, scene[i].nominal).indexCount / 3;
+            finestTriangles += Detail(i, 0).indexCount / 3;
+        }
 
-            graphics->SubmitCommands();
+        DrawItem item = { scene[i].mesh, details[i] };
+        item.constants.WorldViewProj = transforms[i];
+
+        // no nível original, cada aresta é desenhada uma única vez como linha
+        if (edgeLines && i < vertices.size() && vertices[i].edges.indexCount && details[i].startIndex == 0)
+        {
+            lineTriangles += details[i].indexCount / 3;
+            lineCount += vertices[i].edges.indexCount / 2;
+            item.submesh.startIndex = vertices[i].edges.startIndex;
+            item.submesh.indexCount = vertices[i].edges.indexCount;
+            item.lines = true;
+            items.push_back(item);
+            continue;
         }
+
+        // no nível original, um desenho por faixa de grupos visíveis
+        if (i < vertices.size() && !vertices[i].meshlets.empty() && details[i].startIndex == 0)
+        {
+            ranges.clear();
+            meshletCuller.Cull(vertices[i], transforms[i], eyes[i], ranges);
+            for (const MeshletRange & range : ranges)
+            {
+                item.submesh.startIndex = range.startIndex;
+                item.submesh.indexCount = range.indexCount;
+                items.push_back(item);
+            }
+            continue;
+        }
+
+        items.push_back(item);
     }
 
-    // Translação para a esquerda (eixo X negativo)
-    if (input->KeyDown('T') && input->KeyDown(VK_LEFT)) {
-        OutputDebugString("Tranlação no eixo da esquerda");
+    frames.Publish();
+}
+
+// ------------------------------------------------------------------------------
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+void Multi::FixedUpdate()
+{
+    // guarda o passo anterior para interpolar o desenho
+    for (auto & obj : scene)
+        obj.previous = obj.world;
 
-            // Translação no eixo X (esquerda)
-            XMMATRIX translation = XMMatrixTranslation(-0.1f, 0.0f, 0.0f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+    if (selecionado < 0 || selecionado >= int(scene.size()))
+        return;
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+    // teclas mantidas pressionadas alteram o objeto selecionado
+    // a cada passo, com a mesma velocidade em qualquer taxa de quadros
+    XMMATRIX world = XMLoadFloat4x4(&scene[selecionado].world);
 
-            graphics->SubmitCommands();
-        }
+    // aumenta ou diminui a escala (Ctrl + E + / -)
+    if (input->KeyDown(VK_CONTROL) && (input->KeyDown('E') || input->KeyDown('e')))
+    {
+        if (input->KeyDown(VK_OEM_PLUS))
+            world = XMMatrixScaling(1.1f, 1.1f, 1.1f) * world;
+
+        if (input->KeyDown(VK_OEM_MINUS))
+            world = XMMatrixScaling(0.9f, 0.9f, 0.9f) * world;
+    }
+
+    // translada com T + setas (eixos X e Y) ou T + W / S (eixo Z)
+    if (input->KeyDown('T'))
+    {
+        float dx = 0.0f;
+        float dy = 0.0f;
+        float dz = 0.0f;
+
+        if (input->KeyDown(VK_RIGHT)) dx += 0.1f;
+        if (input->KeyDown(VK_LEFT))  dx -= 0.1f;
+        if (input->KeyDown(VK_UP))    dy += 0.1f;
+        if (input->KeyDown(VK_DOWN))  dy -= 0.1f;
+        if (input->KeyDown('W'))      dz += 0.1f;
+        if (input->KeyDown('S'))      dz -= 0.1f;
+
+        world = XMMatrixTranslation(dx, dy, dz) * world;
     }
 
-    // Translação para cima (eixo Y positivo)
-    if (input->KeyDown('T') && input->KeyDown(VK_UP)) {
-        OutputDebugString("Translação para cima");
+    XMStoreFloat4x4(&scene[selecionado].world, world);
+}
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+// ------------------------------------------------------------------------------
+
+void Multi::Draw()
+{
+    // limpa o backbuffer
+    graphics->Clear(pipelineState);
 
-            // Translação no eixo Y (cima)
-            XMMATRIX translation = XMMatrixTranslation(0.0f, 0.1f, 0.0f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+    // cena publicada por Update mais recente (a GPU está ociosa
+    // depois do último Present, então as constantes podem ser trocadas)
+    frames.Acquire();
+    const vector<DrawItem> & items = frames.Read();
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+    for (const DrawItem & item : items)
+        item.mesh->CopyConstants(&item.constants);
+    
+    // desenha objetos da cena (cenas grandes são gravadas em paralelo)
+    graphics->Record(uint(items.size()), [&](ID3D12GraphicsCommandList* cmdList, uint first, uint last)
+    {
+        cmdList->SetGraphicsRootSignature(rootSignature);
+        cmdList->SetPipelineState(pipelineState);
+        cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        bool lines = false;
+
+        for (uint i = first; i < last; ++i)
+        {
+            const DrawItem& obj = items[i];
+
+            // troca pipeline e topologia apenas quando o tipo de primitiva muda
+            if (obj.lines != lines)
+            {
+                lines = obj.lines;
+                cmdList->SetPipelineState(lines ? linePipelineState : pipelineState);
+                cmdList->IASetPrimitiveTopology(lines ? D3D_PRIMITIVE_TOPOLOGY_LINELIST : D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+            }
 
-            graphics->SubmitCommands();
+            // comandos de configuração do pipeline
+            ID3D12DescriptorHeap* descriptorHeap = obj.mesh->ConstantBufferHeap();
+            cmdList->SetDescriptorHeaps(1, &descriptorHeap);
+            cmdList->IASetVertexBuffers(0, 1, obj.mesh->VertexBufferView());
+            cmdList->IASetIndexBuffer(obj.mesh->IndexBufferView());
+
+            // ajusta o buffer constante associado ao vertex shader
+            cmdList->SetGraphicsRootDescriptorTable(0, obj.mesh->ConstantBufferHandle(0));
+
+            // desenha objeto
+            cmdList->DrawIndexedInstanced(
+                obj.submesh.indexCount, 1,
+                obj.submesh.startIndex,
+                obj.submesh.baseVertex,
+                0);
         }
+    });
+ 
+    // apresenta o backbuffer na tela
+    graphics->Present();    
+}
+
+// ------------------------------------------------------------------------------
+
+void Multi::Finalize()
+{
+    // grupos criados e triângulos descartados pelo teste dos grupos
+    if (meshletCulling)
+    {
+        ullong tested = meshletCuller.Tested();
+        char text[320];
+        snprintf(text, sizeof(text),
+            "---> Meshlets: %llu grupos (%.1f vértices e %.1f triângulos em média)  Construção: %.2f Mtri/s  "
+            "Descartados: %.1f%% fora da vista, %.1f%% de costas\n",
+            meshletCount,
+            meshletCount ? double(meshletVertices) / meshletCount : 0.0,
+            meshletCount ? double(meshletTriangles) / meshletCount : 0.0,
+            meshletTime > 0.0 ? meshletTriangles / meshletTime / 1e6 : 0.0,
+            tested ? 100.0 * meshletCuller.Outside() / tested : 0.0,
+            tested ? 100.0 * meshletCuller.Backfacing() / tested : 0.0);
+        Engine::Print(text);
     }
 
-    // Translação para baixo (eixo Y negativo)
-    if (input->KeyDown('T') && input->KeyDown(VK_DOWN)) {
-        OutputDebugString("Translação para Baixo");
+    // triângulos desenhados com e sem níveis de detalhe
+    if (lodPixels > 0.0f)
+    {
+        char text[256];
+        snprintf(text, sizeof(text),
+            "---> LOD: %llu triângulos desenhados (sem LOD: %llu, %.1f%%)  Trocas de nível: %llu  Simplificação: %llu triângulos em %.1f ms (%.2f Mtri/s)\n",
+            lodTriangles, fullTriangles,
+            fullTriangles ? 100.0 * lodTriangles / fullTriangles : 0.0,
+            levelSwitches,
+            simplifyTriangles, simplifyTime * 1000.0,
+            simplifyTime > 0.0 ? simplifyTriangles / simplifyTime / 1e6 : 0.0);
+        Engine::Print(text);
+    }
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+    // custo das normais e desvio em relação às normais dos arquivos OBJ
+    if (normalCrease > 0.0f)
+    {
+        char text[256];
+        snprintf(text, sizeof(text),
+            "---> Normais: %llu triângulos em %.2f ms (%.2f Mtri/s), %llu vértices divididos  "
+            "Desvio dos vn: média %.2f graus, máximo %.2f graus em %llu cantos\n",
+            normalTriangles, normalTime * 1000.0,
+            normalTime > 0.0 ? normalTriangles / normalTime / 1e6 : 0.0,
+            normalSplits,
+            normalCorners ? normalError / normalCorners : 0.0,
+            normalMaxError, normalCorners);
+        Engine::Print(text);
+    }
 
-            // Translação no eixo Y (baixo)
-            XMMATRIX translation = XMMatrixTranslation(0.0f, -0.1f, 0.0f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+    // linhas desenhadas no lugar dos triângulos em arame e custo da extração
+    if (edgeLines)
+    {
+        char text[256];
+        snprintf(text, sizeof(text),
+            "---> Arestas: %llu linhas no lugar de %llu triângulos (%llu segmentos em arame, %.1f%% a menos)  "
+            "Extração: %llu arestas de %llu triângulos em %.2f ms (%.2f Mtri/s)\n",
+            lineCount, lineTriangles, 3 * lineTriangles,
+            lineTriangles ? 100.0 * (1.0 - double(lineCount) / (3 * lineTriangles)) : 0.0,
+            edgeCount, edgeTriangles, edgeTime * 1000.0,
+            edgeTime > 0.0 ? edgeTriangles / edgeTime / 1e6 : 0.0);
+        Engine::Print(text);
+    }
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+    // triângulos das geometrias paramétricas comparados às tesselações fixas
+    if (tessellate)
+    {
+        char text[256];
+        snprintf(text, sizeof(text),
+            "---> Tesselação: %llu triângulos desenhados (fixa: %llu, %.1f%%; mais detalhada: %llu, %.1f%%)  "
+            "Cache: %u conjuntos, %llu acertos\n",
+            tessellatedTriangles,
+            nominalTriangles, nominalTriangles ? 100.0 * tessellatedTriangles / nominalTriangles : 0.0,
+            finestTriangles, finestTriangles ? 100.0 * tessellatedTriangles / finestTriangles : 0.0,
+            parametric.Size(), parametric.Hits());
+        Engine::Print(text);
+    }
 
-            graphics->SubmitCommands();
-        }
+    // desenhos descartados e custo do descarte por quadro
+    if (occlusion)
+    {
+        char text[256];
+        snprintf(text, sizeof(text),
+            "---> Oclusão: %llu de %llu desenhos descartados (%.1f%%)  Custo: %.3f ms/quadro  Oclusores: %.1f/quadro\n",
+            occlusion->Culled(), occlusion->Tested(),
+            occlusion->Tested() ? 100.0 * occlusion->Culled() / occlusion->Tested() : 0.0,
+            cullFrames ? cullTime / cullFrames * 1000.0 : 0.0,
+            cullFrames ? double(occluderCount) / cullFrames : 0.0);
+        Engine::Print(text);
+
+        // compara com a visibilidade exata: Multi.exe --headless --occlusion 20
+        if (occlusionViews > 0)
+            CheckOcclusion(occlusionViews);
+
+        delete occlusion;
     }
 
-    // Translação para frente (eixo Z positivo)
-    if (input->KeyDown('T') && input->KeyDown('W')) {
-        OutputDebugString("Entrei - Frente");
+    // cena final desenhada na CPU: Multi.exe --headless --raster cena.png
+    if (!rasterOutput.empty())
+        Rasterize(rasterOutput);
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+    rootSignature->Release();
+    pipelineState->Release();
+    if (linePipelineState)
+        linePipelineState->Release();
 
-            // Translação no eixo Z (frente)
-            XMMATRIX translation = XMMatrixTranslation(0.0f, 0.0f, 0.1f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+    for (auto& obj : scene)
+        delete obj.mesh;
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+    for (Mesh * mesh : removed)
+        delete mesh;
+}
 
-            graphics->SubmitCommands();
-        }
+// ------------------------------------------------------------------------------
+
+void Multi::BuildNormals(Geometry & geometry)
+{
+    // níveis paramétricos têm vértices próprios, fora do original
+    if (normalCrease <= 0.0f || !geometry.lods.empty())
+        return;
+
+    // pesos pelo ângulo de cada canto, com vincos acima de normalCrease graus
+    uint before = geometry.VertexCount();
+    Timer watch;
+    watch.Start();
+    geometry.ComputeNormals(NORMALS_ANGLE, normalCrease);
+    normalTime += watch.Elapsed();
+    normalTriangles += geometry.OriginalCount() / 3;
+    normalSplits += geometry.VertexCount() - before;
+}
+
+// ------------------------------------------------------------------------------
+
+void Multi::BuildLods(Geometry & geometry)
+{
+    // geometrias paramétricas já trazem suas tesselações como níveis
+    if (lodPixels <= 0.0f || !geometry.lods.empty())
+        return;
+
+    // cada nível com metade dos triângulos do anterior
+    Timer watch;
+    watch.Start();
+    geometry.Simplify(5, 0.5f);
+    simplifyTime += watch.Elapsed();
+    simplifyTriangles += geometry.lods[0].indexCount / 3;
+}
+
+// ------------------------------------------------------------------------------
+
+void Multi::BuildMeshlets(Geometry & geometry)
+{
+    if (!meshletCulling)
+        return;
+
+    // até 64 vértices e 124 triângulos por grupo
+    Timer watch;
+    watch.Start();
+    geometry.Clusterize(64, 124);
+    meshletTime += watch.Elapsed();
+    meshletTriangles += geometry.OriginalCount() / 3;
+    meshletCount += geometry.meshlets.size();
+
+    for (const Meshlet & meshlet : geometry.meshlets)
+        meshletVertices += meshlet.vertexCount;
+}
+
+// ------------------------------------------------------------------------------
+
+void Multi::BuildEdges(Geometry & geometry)
+{
+    if (!edgeLines)
+        return;
+
+    // arestas únicas do original, acrescentadas depois dos níveis e grupos
+    Timer watch;
+    watch.Start();
+    geometry.ExtractEdges();
+    edgeTime += watch.Elapsed();
+    edgeTriangles += geometry.OriginalCount() / 3;
+    edgeCount += geometry.edges.indexCount / 2;
+}
+
+// ------------------------------------------------------------------------------
+
+SubMesh Multi::Detail(uint i, uint level) const
+{
+    // objetos sem níveis de detalhe usam a própria sub-malha
+    if (i >= vertices.size() || (vertices[i].lods.empty() && vertices[i].meshlets.empty() && !vertices[i].edges.indexCount))
+        return scene[i].submesh;
+
+    // sem os índices dos grupos e das arestas, acrescentados depois do original
+    if (vertices[i].lods.empty())
+    {
+        SubMesh submesh = scene[i].submesh;
+        submesh.startIndex = 0;
+        submesh.indexCount = vertices[i].OriginalCount();
+        return submesh;
     }
 
-    // Translação para trás (eixo Z negativo)
-    if (input->KeyDown('T') && input->KeyDown('S')) {
-        OutputDebugString("Translação para trás");
+    const vector<LevelOfDetail> & lods = vertices[i].lods;
+    const LevelOfDetail & lod = lods[level < lods.size() ? level : lods.size() - 1];
 
-        if (selecionado > -1 && selecionado < scene.size()) {
-            graphics->ResetCommands();
+    SubMesh submesh;
+    submesh.indexCount = lod.indexCount;
+    submesh.startIndex = lod.startIndex;
+    submesh.baseVertex = scene[i].submesh.baseVertex;
+    return submesh;
+}
 
-            // Translação no eixo Z (trás)
-            XMMATRIX translation = XMMatrixTranslation(0.0f, 0.0f, -0.1f);
-            XMMATRIX newWorld = translation * XMLoadFloat4x4(&scene[selecionado].world);
-            XMStoreFloat4x4(&scene[selecionado].world, newWorld);
+// ------------------------------------------------------------------------------
 
-            // Atualizando o buffer de constantes
-            ObjectConstants constants;
-            XMMATRIX wvp = newWorld * XMLoadFloat4x4(&View) * XMLoadFloat4x4(&Proj);
-            XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(wvp));
-            scene[selecionado].mesh->CopyConstants(&constants);
+void Multi::Rasterize(const string & fileName)
+{
+    XMMATRIX view = XMLoadFloat4x4(&View);
+    XMMATRIX proj = XMLoadFloat4x4(&Proj);
 
-            graphics->SubmitCommands();
-        }
+    // mesmos vértices, sub-malhas e matrizes usados pela GPU
+    vector<RasterDraw> draws;
+    for (uint i = 0; i < scene.size() && i < vertices.size(); ++i)
+    {
+        SubMesh submesh = Detail(i, 0);
+        RasterDraw draw = { vertices[i].VertexData(), vertices[i].IndexData(),
+            submesh.indexCount, submesh.startIndex, submesh.baseVertex };
+        XMMATRIX world = XMLoadFloat4x4(&scene[i].world);
+        XMStoreFloat4x4(&draw.worldViewProj, XMMatrixTranspose(world * view * proj));
+        draws.push_back(draw);
     }
 
+    COLORREF background = window->Color();
+    auto render = [&](Rasterizer & rasterizer)
+    {
+        rasterizer.Fill(occlusionCulling ? RASTER_SOLID : RASTER_WIREFRAME);
+        rasterizer.Clear(GetRValue(background) / 255.0f, GetGValue(background) / 255.0f, GetBValue(background) / 255.0f);
+        for (const RasterDraw & draw : draws)
+            rasterizer.Draw(draw);
+        rasterizer.Finish();
+    };
 
+    // imagem com todos os núcleos
+    Rasterizer image(uint(window->Width()), uint(window->Height()));
+    render(image);
+    if (!image.Save(fileName))
+        OutputDebugString("---> Falha ao gravar a imagem rasterizada\n");
 
+    // vazão com 1, 2, 4... threads até todos os núcleos
+    uint cores = std::thread::hardware_concurrency();
+    if (cores == 0)
+        cores = 1;
+    stringstream text;
+    text << "---> Rasterizador: " << image.Triangles() << " triângulos";
 
+    for (uint threads = 1; ; threads = threads * 2 < cores ? threads * 2 : cores)
+    {
+        Rasterizer rasterizer(image.Width(), image.Height(), threads);
+        Timer watch;
+        watch.Start();
 
+        do
+            render(rasterizer);
+        while (watch.Elapsed() < 0.5);
 
-    lastMousePosX = mousePosX;
-    lastMousePosY = mousePosY;
+        double rate = rasterizer.Triangles() / watch.Elapsed();
+        text << "  " << threads << (threads == 1 ? " thread: " : " threads: ")
+             << std::fixed << std::setprecision(2) << rate / 1e6 << " Mtri/s";
 
-    // converte coordenadas esféricas para cartesianas
-    float x = radius * sinf(phi) * cosf(theta);
-    float z = radius * sinf(phi) * sinf(theta);
-    float y = radius * cosf(phi);
+        if (threads == cores)
+            break;
+    }
 
-    // constrói a matriz da câmera (view matrix)
-    XMVECTOR pos = XMVectorSet(x, y, z, 1.0f);
-    XMVECTOR target = XMVectorZero();
-    XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
-    XMMATRIX view = XMMatrixLookAtLH(pos, target, up);
-    XMStoreFloat4x4(&View, view);
+    text << '\n';
+    Engine::Print(text.str().c_str());
+}
 
-    // carrega matriz de projeção em uma XMMATRIX
-    XMMATRIX proj = XMLoadFloat4x4(&Proj);
+// ------------------------------------------------------------------------------
 
-    // ajusta o buffer constante de cada objeto
-    for (auto & obj : scene)
+void Multi::Cull()
+{
+    // caixas envolventes das geometrias ainda não medidas
+    for (uint i = uint(bounds.size()); i < vertices.size(); ++i)
     {
-        // carrega matriz de mundo em uma XMMATRIX
-        XMMATRIX world = XMLoadFloat4x4(&obj.world);      
+        BoundingBox box;
+        if (vertices[i].VertexCount() > 0)
+            BoundingBox::CreateFromPoints(box, vertices[i].VertexCount(), &vertices[i].VertexData()->pos, sizeof(Vertex));
+        bounds.push_back(box);
+    }
 
-        // constrói matriz combinada (world x view x proj)
-        XMMATRIX WorldViewProj = world * view * proj;        
+    uint count = uint(scene.size());
+    if (count > bounds.size())
+        count = uint(bounds.size());
+
+    // oclusores: os objetos que cobrem mais tela, no máximo 16
+    occluders.clear();
+    for (uint i = 0; i < count; ++i)
+    {
+        float coverage = occlusion->Coverage(bounds[i].Center, bounds[i].Extents, transforms[i]);
+        if (coverage >= 0.01f)
+            occluders.push_back({ coverage, i });
+    }
+
+    std::sort(occluders.begin(), occluders.end(), std::greater<pair<float, uint>>());
+    if (occluders.size() > 16)
+        occluders.resize(16);
 
-        // atualiza o buffer constante com a matriz combinada
-        ObjectConstants constants;
-        XMStoreFloat4x4(&constants.WorldViewProj, XMMatrixTranspose(WorldViewProj));
-        obj.mesh->CopyConstants(&constants);
+    // oclusores usam a malha original: um nível simplificado pode cobrir
+    // pixels que o objeto desenhado não cobre e esconder objetos visíveis
+    occlusion->Clear();
+    for (const auto & occluder : occluders)
+    {
+        uint i = occluder.second;
+        SubMesh submesh = Detail(i, 0);
+        RasterDraw draw = { vertices[i].VertexData(), vertices[i].IndexData(),
+            submesh.indexCount, submesh.startIndex, submesh.baseVertex };
+        draw.worldViewProj = transforms[i];
+        occlusion->Occluder(draw);
     }
+    occluderCount += occluders.size();
+
+    // caixa inteira atrás dos oclusores
+    for (uint i = 0; i < count; ++i)
+        hidden[i] = !occlusion->Visible(bounds[i].Center, bounds[i].Extents, transforms[i]);
 }
 
 // ------------------------------------------------------------------------------
 
-void Multi::Draw()
+void Multi::CheckOcclusion(uint views)
 {
-    // limpa o backbuffer
-    graphics->Clear(pipelineState);
-    
-    // desenha objetos da cena
-    for (auto& obj : scene)
+    // geometrias com a cor identificando cada objeto
+    vector<vector<Vertex>> painted(scene.size());
+    for (uint i = 0; i < scene.size() && i < vertices.size(); ++i)
     {
-        // comandos de configuração do pipeline
-        ID3D12DescriptorHeap* descriptorHeap = obj.mesh->ConstantBufferHeap();
-        graphics->CommandList()->SetDescriptorHeaps(1, &descriptorHeap);
-        graphics->CommandList()->SetGraphicsRootSignature(rootSignature);
-        graphics->CommandList()->IASetVertexBuffers(0, 1, obj.mesh->VertexBufferView());
-        graphics->CommandList()->IASetIndexBuffer(obj.mesh->IndexBufferView());
-        graphics->CommandList()->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-
-        // ajusta o buffer constante associado ao vertex shader
-        graphics->CommandList()->SetGraphicsRootDescriptorTable(0, obj.mesh->ConstantBufferHandle(0));
-
-        // desenha objeto
-        graphics->CommandList()->DrawIndexedInstanced(
-            obj.submesh.indexCount, 1,
-            obj.submesh.startIndex,
-            obj.submesh.baseVertex,
-            0);
+        uint id = i + 1;
+        painted[i] = vertices[i].vertices;
+        for (Vertex & v : painted[i])
+            v.color = XMFLOAT4((id & 0xff) / 255.0f, (id >> 8 & 0xff) / 255.0f, (id >> 16 & 0xff) / 255.0f, 1.0f);
     }
- 
-    // apresenta o backbuffer na tela
-    graphics->Present();    
+
+    XMMATRIX proj = XMLoadFloat4x4(&Proj);
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    Rasterizer reference(uint(window->Width()), uint(window->Height()));
+    vector<bool> seen;
+    ullong culled = 0;
+    ullong wrong = 0;
+
+    for (uint view = 0; view < views; ++view)
+    {
+        // câmera orbital em posição aleatória
+        float t = XM_2PI * unit(random);
+        float p = 0.3f + 1.2f * unit(random);
+        float r = 3.0f + 9.0f * unit(random);
+        XMMATRIX camera = XMMatrixLookAtLH(
+            XMVectorSet(r * sinf(p) * cosf(t), r * cosf(p), r * sinf(p) * sinf(t), 1.0f),
+            XMVectorZero(), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+
+        for (uint i = 0; i < scene.size(); ++i)
+            XMStoreFloat4x4(&transforms[i], XMMatrixTranspose(XMLoadFloat4x4(&scene[i].world) * camera * proj));
+
+        hidden.assign(scene.size(), false);
+        for (uint i = 0; i < scene.size(); ++i)
+            details[i] = Detail(i, 0);
+        Cull();
+
+        // referência: todos os objetos sólidos em resolução cheia
+        reference.Clear(0.0f, 0.0f, 0.0f);
+        for (uint i = 0; i < scene.size() && i < vertices.size(); ++i)
+        {
+            SubMesh submesh = Detail(i, 0);
+            RasterDraw draw = { painted[i].data(), vertices[i].IndexData(),
+                submesh.indexCount, submesh.startIndex, submesh.baseVertex };
+            draw.worldViewProj = transforms[i];
+            reference.Draw(draw);
+        }
+        reference.Finish();
+
+        seen.assign(scene.size(), false);
+        for (uint y = 0; y < reference.Height(); ++y)
+            for (uint x = 0; x < reference.Width(); ++x)
+            {
+                uint id = reference.Pixel(x, y) & 0xffffff;
+                if (id > 0 && id <= seen.size())
+                    seen[id - 1] = true;
+            }
+
+        // descartes de objetos com algum pixel visível na referência
+        for (uint i = 0; i < scene.size(); ++i)
+            if (hidden[i])
+            {
+                ++culled;
+                if (seen[i])
+                    ++wrong;
+            }
+    }
+
+    char text[256];
+    snprintf(text, sizeof(text),
+        "---> Referência: %u vistas  Descartes: %llu  Incorretos: %llu (%.3f%%)\n",
+        views, culled, wrong, culled ? 100.0 * wrong / culled : 0.0);
+    Engine::Print(text);
 }
 
 // ------------------------------------------------------------------------------
 
-void Multi::Finalize()
+ullong Multi::Hash()
 {
-    rootSignature->Release();
-    pipelineState->Release();
+    // objetos, suas geometrias e a câmera determinam o que é desenhado
+    ullong hash = PipelineCache::Hash(&View, sizeof(View));
 
-    for (auto& obj : scene)
-        delete obj.mesh;
+    for (uint i = 0; i < scene.size() && i < vertices.size(); ++i)
+    {
+        uint counts[2] = { uint(vertices[i].VertexCount()), uint(vertices[i].IndexCount()) };
+        hash = PipelineCache::Hash(&scene[i].world, sizeof(scene[i].world), hash);
+        hash = PipelineCache::Hash(counts, sizeof(counts), hash);
+    }
+
+    return hash;
 }
 
 
@@ -960,28 +1491,10 @@ void Multi::BuildRootSignature()
     rootSigDesc.pStaticSamplers = nullptr;
     rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
-    // serializa assinatura raiz
-    ID3DBlob* serializedRootSig = nullptr;
-    ID3DBlob* error = nullptr;
-
-    ThrowIfFailed(D3D12SerializeRootSignature(
-        &rootSigDesc,
-        D3D_ROOT_SIGNATURE_VERSION_1,
-        &serializedRootSig,
-        &error));
-
-    if (error != nullptr)
-    {
-        OutputDebugString((char*)error->GetBufferPointer());
-    }
-
     // cria uma assinatura raiz com um único slot que aponta para  
     // uma faixa de descritores consistindo de um único buffer constante
-    ThrowIfFailed(graphics->Device()->CreateRootSignature(
-        0,
-        serializedRootSig->GetBufferPointer(),
-        serializedRootSig->GetBufferSize(),
-        IID_PPV_ARGS(&rootSignature)));
+    // (a versão serializada é reaproveitada do cache em disco)
+    graphics->CreateRootSignature(&rootSigDesc, &rootSignature);
 }
 
 // ------------------------------------------------------------------------------
@@ -1012,9 +1525,10 @@ void Multi::BuildPipelineState()
     // ---- Rasterizer ----
     // --------------------
 
+    // em arame os objetos de trás aparecem pelos vãos da malha: com o
+    // descarte por oclusão a cena é sólida, como a referência de CheckOcclusion
     D3D12_RASTERIZER_DESC rasterizer = {};
-    //rasterizer.FillMode = D3D12_FILL_MODE_SOLID;
-    rasterizer.FillMode = D3D12_FILL_MODE_WIREFRAME;
+    rasterizer.FillMode = occlusionCulling ? D3D12_FILL_MODE_SOLID : D3D12_FILL_MODE_WIREFRAME;
     rasterizer.CullMode = D3D12_CULL_MODE_BACK;
     rasterizer.FrontCounterClockwise = FALSE;
     rasterizer.DepthBias = D3D12_DEFAULT_DEPTH_BIAS;
@@ -1079,7 +1593,14 @@ void Multi::BuildPipelineState()
     pso.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
     pso.SampleDesc.Count = graphics->Antialiasing();
     pso.SampleDesc.Quality = graphics->Quality();
-    graphics->Device()->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&pipelineState));
+    graphics->CreatePipelineState(&pso, &pipelineState);
+
+    // variante para as arestas: mesmos shaders e estados, com linhas
+    if (edgeLines)
+    {
+        pso.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE;
+        graphics->CreatePipelineState(&pso, &linePipelineState);
+    }
 
     vertexShader->Release();
     pixelShader->Release();
@@ -1108,8 +1629,168 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance,
         engine->window->LostFocus(Engine::Pause);
         engine->window->InFocus(Engine::Resume);
 
-        // cria e executa a aplicação
-        engine->Start(new Multi());
+        // descarta objetos escondidos por oclusores grandes e desenha a cena
+        // sólida em vez de em arame: Multi.exe --occlusion
+        occlusionCulling = strstr(lpCmdLine, "--occlusion") != nullptr;
+
+        // cena inicial com caixas espalhadas: Multi.exe --scatter 300
+        string scatter = Engine::Option(lpCmdLine, "--scatter");
+        scatterCount = uint(atoi(scatter.c_str()));
+
+        // níveis de detalhe com desvio de até 1 pixel na tela: Multi.exe --lod [pixels]
+        if (strstr(lpCmdLine, "--lod"))
+        {
+            lodPixels = float(atof(Engine::Option(lpCmdLine, "--lod").c_str()));
+            if (lodPixels <= 0.0f)
+                lodPixels = 1.0f;
+        }
+
+        // modelos divididos em grupos descartados na CPU: Multi.exe --meshlets
+        meshletCulling = strstr(lpCmdLine, "--meshlets") != nullptr;
+
+        // normais suaves com vincos onde as faces se dobram mais que o ângulo (180 = sem vincos): Multi.exe --normals [graus]
+        if (strstr(lpCmdLine, "--normals"))
+        {
+            normalCrease = float(atof(Engine::Option(lpCmdLine, "--normals").c_str()));
+            if (normalCrease <= 0.0f)
+                normalCrease = 180.0f;
+        }
+
+        // arame desenhado com cada aresta uma única vez, como lista de linhas: Multi.exe --edges
+        // (ignorado com --occlusion, que desenha a cena sólida e precisa dos triângulos)
+        edgeLines = strstr(lpCmdLine, "--edges") != nullptr && !occlusionCulling;
+
+        // esferas e cilindros na tesselação com desvio de até 1 pixel: Multi.exe --tessellate [pixels]
+        if (strstr(lpCmdLine, "--tessellate"))
+        {
+            tessellate = true;
+            string pixels = Engine::Option(lpCmdLine, "--tessellate");
+            if (!pixels.empty() && atof(pixels.c_str()) > 0.0)
+                lodPixels = float(atof(pixels.c_str()));
+            else if (lodPixels <= 0.0f)
+                lodPixels = 1.0f;
+        }
+
+        // desenha apenas quando algo muda: Multi.exe --ondemand
+        Engine::OnDemand(strstr(lpCmdLine, "--ondemand") != nullptr);
+
+        // sem vsync, com a taxa limitada pelo motor: Multi.exe --fps 144
+        string fps = Engine::Option(lpCmdLine, "--fps");
+        if (!fps.empty())
+        {
+            engine->graphics->VSync(false);
+            Engine::FrameRate(atof(fps.c_str()));
+        }
+
+        // simulação em passos de 60 Hz, no máximo 5 por quadro
+        Engine::FixedStep(1.0 / 60.0, 5);
+
+        // Draw do quadro N roda junto com Update do quadro N+1: Multi.exe --threaded
+        Engine::RenderThread(strstr(lpCmdLine, "--threaded") != nullptr);
+
+        // execução sem janela visível para medições automatizadas:
+        // Multi.exe --headless [quadros] [--seconds s] [--synthetic hz] [--workload ms] [--warp] [--replay arquivo] [--frametime ms] [--raster arquivo] [--occlusion vistas] [--scatter n] [--lod pixels] [--meshlets] [--tessellate pixels] [--normals graus]
+        // gravação da entrada de uma sessão interativa:
+        // Multi.exe --record arquivo
+        const char * headless = strstr(lpCmdLine, "--headless");
+        if (headless)
+        {
+            uint frames = 1000;
+            int given = sscanf_s(headless, "--headless %u", &frames);
+            engine->graphics->Software(strstr(lpCmdLine, "--warp") != nullptr);
+
+            // limite de tempo sem número de quadros: executa até o fim do prazo
+            string seconds = Engine::Option(lpCmdLine, "--seconds");
+            double secs = seconds.empty() ? 0.0 : atof(seconds.c_str());
+            if (secs > 0.0 && given != 1)
+                frames = 0;
+
+            // custo artificial de Update e Draw (cada um) para medir a vazão
+            string workload = Engine::Option(lpCmdLine, "--workload");
+            if (!workload.empty())
+                Engine::Workload(atof(workload.c_str()) / 1000.0);
+
+            // movimentos sintéticos do mouse para medir a latência da entrada
+            string synthetic = Engine::Option(lpCmdLine, "--synthetic");
+            if (!synthetic.empty())
+                engine->Synthetic(uint(atoi(synthetic.c_str())));
+
+            // reproduz uma sessão gravada ou usa o roteiro padrão
+            vector<InputEvent> events;
+            string replay = Engine::Option(lpCmdLine, "--replay");
+
+            if (!replay.empty())
+            {
+                if (!Input::Load(replay, events))
+                    OutputDebugString("---> Falha ao ler a entrada gravada\n");
+            }
+            else
+            {
+                // roteiro de entrada: cria uma geometria de cada tipo
+                uint frame = 1;
+                for (int key : { 'B', 'C', 'G', 'P', 'Q' })
+                {
+                    events.push_back({ frame, key, true });
+                    events.push_back({ frame + 1, key, false });
+                    frame += 2;
+                }
+
+                // com grupos de triângulos, normais ou arestas, também os modelos que acompanham o projeto
+                if (meshletCulling || normalCrease > 0.0f || edgeLines)
+                    for (int key : { '1', '2', '3', '4', '5' })
+                    {
+                        events.push_back({ frame, key, true });
+                        events.push_back({ frame + 1, key, false });
+                        frame += 2;
+                    }
+
+                // com tesselação, também uma esfera e uma volta da câmera seguida
+                // de afastamento e aproximação (botão esquerdo gira, direito afasta)
+                if (tessellate)
+                {
+                    events.push_back({ frame, 'S', true });
+                    events.push_back({ frame + 1, 'S', false });
+                    frame += 2;
+
+                    events.push_back({ frame, 0, false, INPUT_MOVE, 0, 0 });
+                    events.push_back({ frame + 1, VK_LBUTTON, true });
+                    frame += 2;
+                    for (int x = 4; x <= 1440; x += 4)
+                        events.push_back({ frame++, 0, false, INPUT_MOVE, x, 0 });
+                    events.push_back({ frame++, VK_LBUTTON, false });
+
+                    events.push_back({ frame++, VK_RBUTTON, true });
+                    for (int step = 1; step <= 240; ++step)
+                        events.push_back({ frame++, 0, false, INPUT_MOVE, 1440 + (step <= 120 ? step : 240 - step) * 2, 0 });
+                    events.push_back({ frame++, VK_RBUTTON, false });
+                }
+            }
+
+            // quadros mais longos que o passo exercitam a recuperação da simulação
+            string frameTime = Engine::Option(lpCmdLine, "--frametime");
+            double dt = frameTime.empty() ? 1.0 / 60.0 : atof(frameTime.c_str()) / 1000.0;
+
+            // desenha a cena final também na CPU e mede a vazão do rasterizador
+            rasterOutput = Engine::Option(lpCmdLine, "--raster");
+
+            // compara o descarte com a visibilidade exata em vistas aleatórias
+            occlusionViews = uint(atoi(Engine::Option(lpCmdLine, "--occlusion").c_str()));
+
+            engine->Script(events);
+            engine->Headless(new Multi(), frames, secs, dt);
+        }
+        else
+        {
+            // grava a entrada da sessão se solicitado
+            string record = Engine::Option(lpCmdLine, "--record");
+            Input::Record(!record.empty());
+
+            // cria e executa a aplicação
+            engine->Start(new Multi());
+
+            if (!record.empty())
+                Input::Save(record);
+        }
 
         // finaliza execução
         delete engine;
@@ -0,0 +1,184 @@
+/**********************************************************************************
+// NullGraphics (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Dispositivo gráfico nulo usado fora do Windows. Oferece a
+//              parte da interface de Graphics que o motor e as aplicações
+//              usam para desenhar: aceita os comandos gravados, copia seus
+//              argumentos, conta comandos e bytes e os descarta. Permite
+//              rodar Update e Draw de uma aplicação sem GPU e sem janela.
+//
+**********************************************************************************/
+
+#ifndef DXUT_NULLGRAPHICS_H_
+#define DXUT_NULLGRAPHICS_H_
+
+// --------------------------------------------------------------------------------
+// Inclusões
+
+#include "Window.h"              // superfície fora da tela
+#include "Types.h"               // tipos específicos da engine
+#include "ThreadPool.h"          // threads para gravação paralela
+#include "Profiler.h"            // faixas de tempo da CPU
+#include <vector>                 // argumentos dos comandos gravados
+
+// --------------------------------------------------------------------------------
+
+// lista de comandos nula: copia os argumentos de cada comando para
+// um bloco de memória, como o alocador de comandos do Direct3D 12,
+// e os descarta quando a lista é executada
+class NullCommandList
+{
+private:
+    vector<unsigned char> stream;                           // argumentos gravados
+    ullong commands;                                        // comandos gravados
+
+    // copia bytes para o fim da lista
+    void Append(const void * data, size_t size)
+    {
+        const unsigned char * bytes = static_cast<const unsigned char *>(data);
+        stream.insert(stream.end(), bytes, bytes + size);
+    }
+
+public:
+    NullCommandList() : commands(0) {}
+
+    // grava um comando com os argumentos passados por valor
+    template<class... Args>
+    void Command(const Args &... args) { ++commands; (Append(&args, sizeof(args)), ...); }
+
+    void Reset() { stream.clear(); commands = 0; }          // descarta os comandos gravados
+    ullong Commands() const { return commands; }            // retorna comandos gravados
+    ullong Bytes() const { return stream.size(); }          // retorna bytes gravados
+
+    // comandos de desenho usados pelas aplicações
+    void SetPipelineState(const void * pso) { Command(pso); }
+    void SetGraphicsRootSignature(const void * root) { Command(root); }
+    void IASetPrimitiveTopology(uint topology) { Command(topology); }
+    void IASetVertexBuffers(uint slot, uint views, const void * data) { Command(slot, views, data); }
+    void IASetIndexBuffer(const void * view) { Command(view); }
+    void SetGraphicsRootDescriptorTable(uint index, ullong handle) { Command(index, handle); }
+    void DrawIndexedInstanced(uint indices, uint instances, uint start, int base, uint first)
+    { Command(indices, instances, start, base, first); }
+    void DrawInstanced(uint vertices, uint instances, uint start, uint first)
+    { Command(vertices, instances, start, first); }
+
+    // as constantes são copiadas para a lista, como no Direct3D
+    void SetGraphicsRoot32BitConstants(uint index, uint values, const void * data, uint offset)
+    { Command(index, values, offset); Append(data, 4 * size_t(values)); }
+};
+
+// grava os desenhos [first, last) em uma lista de comandos
+using RecordFunc = function<void(NullCommandList* cmdList, uint first, uint last)>;
+
+// --------------------------------------------------------------------------------
+
+class Graphics
+{
+private:
+    // gravação paralela (mesma divisão do dispositivo Direct3D)
+    static const uint            MaxRecorders = 8;          // máximo de listas gravadas em paralelo
+    ThreadPool                 * workers;                   // threads que gravam comandos
+    NullCommandList              commandList;               // lista de comandos principal
+    NullCommandList              recorderList[MaxRecorders];    // uma lista de comandos por thread
+    uint                         recorderCount;             // número de listas de gravação
+    uint                         recorderPending;           // listas gravadas no quadro atual
+    float                        viewport[6];               // área de desenho (x, y, largura, altura, zmin, zmax)
+    int                          scissor[4];                // retângulo de corte
+
+    // medição
+    Profiler                   * profiler;                  // linha do tempo da CPU
+    double                       presentTime;               // tempo de CPU gasto em Present no quadro
+    ullong                       frames;                    // quadros apresentados
+    ullong                       commands;                  // comandos apresentados
+    ullong                       bytes;                     // bytes de comandos apresentados
+
+    // posse da lista de comandos principal (como no dispositivo Direct3D)
+    mutex                        commandLock;               // protege a lista de comandos principal
+    atomic<std::thread::id>      commandOwner;              // thread que possui a lista
+
+    void AcquireCommands();                                 // toma posse da lista de comandos principal
+    void ReleaseCommands();                                 // devolve a lista de comandos principal
+    void ExecuteCommands();                                 // soma e descarta os comandos gravados
+
+public:
+    Graphics();                                             // constructor
+    ~Graphics();                                            // destructor
+
+    void VSync(bool state);                                 // sem efeito: nada é exibido
+    void Software(bool state);                              // sem efeito: não há adaptador
+    void Initialize(Window * window);                       // cria listas e threads de gravação
+    void Clear(const void * pso = nullptr);                 // inicia o quadro
+    void Record(uint drawCount, const RecordFunc & record); // grava desenhos em paralelo
+    void Present();                                         // conclui o quadro
+
+    void ResetCommands();                                   // reinicia lista para receber novos comandos
+    void SubmitCommands();                                  // descarta os comandos pendentes
+    void Collect();                                         // sem efeito: nada aguarda a GPU
+
+    NullCommandList* CommandList();                         // retorna lista de comandos
+    uint Recorders();                                       // retorna número de listas de gravação
+    uint LiveResources();                                   // retorna recursos alocados (sempre 0)
+    ullong LiveBytes();                                     // retorna memória alocada (sempre 0)
+    uint PendingReleases();                                 // retorna objetos aguardando (sempre 0)
+    Profiler * Profile();                                   // retorna linha do tempo de desempenho
+    double PresentTime();                                   // retorna tempo de CPU gasto em Present
+
+    ullong Frames();                                        // retorna quadros apresentados
+    ullong Commands();                                      // retorna comandos apresentados
+    ullong Bytes();                                         // retorna bytes de comandos apresentados
+};
+
+// --------------------------------------------------------------------------------
+// Métodos Inline
+
+inline void Graphics::VSync(bool)
+{}
+
+inline void Graphics::Software(bool)
+{}
+
+// retorna lista de comandos principal
+inline NullCommandList* Graphics::CommandList()
+{ return &commandList; }
+
+// retorna número de listas de gravação paralela
+inline uint Graphics::Recorders()
+{ return recorderCount; }
+
+// não há recursos da GPU
+inline uint Graphics::LiveResources()
+{ return 0; }
+
+inline ullong Graphics::LiveBytes()
+{ return 0; }
+
+inline uint Graphics::PendingReleases()
+{ return 0; }
+
+// retorna linha do tempo de desempenho da CPU
+inline Profiler * Graphics::Profile()
+{ return profiler; }
+
+// retorna tempo de CPU gasto em Present no quadro atual (em segundos)
+inline double Graphics::PresentTime()
+{ return presentTime; }
+
+// retorna quadros apresentados
+inline ullong Graphics::Frames()
+{ return frames; }
+
+// retorna comandos apresentados em todos os quadros
+inline ullong Graphics::Commands()
+{ return commands; }
+
+// retorna bytes de comandos apresentados em todos os quadros
+inline ullong Graphics::Bytes()
+{ return bytes; }
+
+// --------------------------------------------------------------------------------
+
+#endif
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Object (Arquivo de Cabealho)
+// Object (Arquivo de Cabeçalho)
 //
-// Criao:     14 Out 2022
-// Atualizao: 15 Set 2023
+// Criação:     14 Out 2022
+// Atualização: 19 Out 2026
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Define armazenamento para objeto de uma cena
+// Descrição:   Define armazenamento para objeto de uma cena
 //
 **********************************************************************************/
 
@@ -25,9 +25,18 @@ struct Object
 		0.0f, 0.0f, 1.0f, 0.0f,
 		0.0f, 0.0f, 0.0f, 1.0f };
 
-	uint cbIndex = -1;			    // ndice para o constant buffer
-	Mesh * mesh = nullptr;			// malha de vrtices
-	SubMesh submesh {};	            // informaes da sub-malha
+	XMFLOAT4X4 previous = {         // matriz de mundo no passo anterior
+		1.0f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, 1.0f, 0.0f,
+		0.0f, 0.0f, 0.0f, 1.0f };
+
+	uint cbIndex = -1;			    // índice para o constant buffer
+	Mesh * mesh = nullptr;			// malha de vértices
+	SubMesh submesh {};	            // informações da sub-malha
+	uint detail = 0;				// nível de detalhe escolhido no último quadro
+	uint nominal = 0;				// nível com a tesselação fixa da geometria
+	bool parametric = false;		// níveis gerados por ParametricCache
 };
 
 #endif
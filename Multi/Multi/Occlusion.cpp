@@ -0,0 +1,256 @@
+/**********************************************************************************
+// Occlusion (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Descarte por oclusão na CPU. Oclusores grandes são rasterizados
+//              com SSE2 em um buffer de profundidade de baixa resolução que
+//              guarda, em cada pixel, a profundidade mais distante que os
+//              oclusores podem ter ali. A caixa envolvente de cada objeto é
+//              projetada na tela e o objeto é descartado quando todo o seu
+//              retângulo está atrás dos oclusores.
+//
+**********************************************************************************/
+
+#include "Occlusion.h"
+#include <algorithm>
+#include <cmath>
+#include <emmintrin.h>
+
+// -------------------------------------------------------------------------------
+
+Occlusion::Occlusion(uint width, uint height)
+{
+    this->width = width;
+    this->height = height;
+    stride = (width + 3) & ~3u;
+    depth.resize(size_t(stride) * height);
+    tested = 0;
+    culled = 0;
+    Clear();
+}
+
+// -------------------------------------------------------------------------------
+
+void Occlusion::Clear()
+{
+    std::fill(depth.begin(), depth.end(), 1.0f);
+}
+
+// -------------------------------------------------------------------------------
+
+void Occlusion::Occluder(const RasterDraw & draw)
+{
+    const XMFLOAT4X4 & m = draw.worldViewProj;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 lanes = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+
+    for (uint t = 0; t + 3 <= draw.indexCount; t += 3)
+    {
+        const uint * index = draw.indices + draw.startIndex + t;
+        float x[3], y[3], z[3];
+        bool clipped = false;
+
+        for (uint i = 0; i < 3; ++i)
+        {
+            const XMFLOAT3 & p = draw.vertices[index[i] + draw.baseVertex].pos;
+
+            // a matriz está transposta, como o vertex shader a recebe
+            float cx = m.m[0][0] * p.x + m.m[0][1] * p.y + m.m[0][2] * p.z + m.m[0][3];
+            float cy = m.m[1][0] * p.x + m.m[1][1] * p.y + m.m[1][2] * p.z + m.m[1][3];
+            float cz = m.m[2][0] * p.x + m.m[2][1] * p.y + m.m[2][2] * p.z + m.m[2][3];
+            float cw = m.m[3][0] * p.x + m.m[3][1] * p.y + m.m[3][2] * p.z + m.m[3][3];
+
+            // triângulos que cruzam o plano próximo apenas deixam de ocultar
+            if (cz < 0.0f || cw <= 0.0f)
+            {
+                clipped = true;
+                break;
+            }
+
+            x[i] = (cx / cw * 0.5f + 0.5f) * width;
+            y[i] = (0.5f - cy / cw * 0.5f) * height;
+            z[i] = cz / cw;
+        }
+
+        if (clipped)
+            continue;
+
+        // triângulos de costas ficam atrás dos de frente em malhas fechadas
+        float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if (area <= 0.0f)
+            continue;
+
+        int minX = int(std::max(std::ceil(std::min({ x[0], x[1], x[2] }) - 0.5f), 0.0f));
+        int minY = int(std::max(std::ceil(std::min({ y[0], y[1], y[2] }) - 0.5f), 0.0f));
+        int maxX = int(std::min(std::floor(std::max({ x[0], x[1], x[2] }) - 0.5f), float(width) - 1.0f));
+        int maxY = int(std::min(std::floor(std::max({ y[0], y[1], y[2] }) - 0.5f), float(height) - 1.0f));
+
+        if (minX > maxX || minY > maxY)
+            continue;
+
+        // arestas opostas a cada vértice: a*x + b*y + c >= 0 do lado interno
+        float a[3], b[3], c[3];
+        for (uint i = 0; i < 3; ++i)
+        {
+            uint j = (i + 1) % 3;
+            uint k = (i + 2) % 3;
+            a[i] = y[j] - y[k];
+            b[i] = x[k] - x[j];
+            c[i] = -(a[i] * x[j] + b[i] * y[j]);
+        }
+
+        // plano da profundidade mais o quanto ela cresce até o canto
+        // do pixel: nenhum ponto do pixel fica atrás do valor gravado
+        float dzdx = (a[1] * (z[1] - z[0]) + a[2] * (z[2] - z[0])) / area;
+        float dzdy = (b[1] * (z[1] - z[0]) + b[2] * (z[2] - z[0])) / area;
+        float farthest = std::max({ z[0], z[1], z[2] });
+        float bias = z[0] - dzdx * x[0] - dzdy * y[0] + 0.5f * (std::fabs(dzdx) + std::fabs(dzdy));
+
+        __m128 ea[3], eb[3], ec[3];
+        for (uint i = 0; i < 3; ++i)
+        {
+            ea[i] = _mm_set1_ps(a[i]);
+            eb[i] = _mm_set1_ps(b[i]);
+            ec[i] = _mm_set1_ps(c[i]);
+        }
+        __m128 zx = _mm_set1_ps(dzdx);
+        __m128 limit = _mm_set1_ps(farthest);
+
+        for (int py = minY; py <= maxY; ++py)
+        {
+            __m128 cy = _mm_set1_ps(float(py) + 0.5f);
+            __m128 zrow = _mm_set1_ps(bias + dzdy * (float(py) + 0.5f));
+            __m128 row[3];
+            for (uint i = 0; i < 3; ++i)
+                row[i] = _mm_add_ps(_mm_mul_ps(eb[i], cy), ec[i]);
+
+            float * line = &depth[size_t(py) * stride];
+
+            for (int px = minX & ~3; px <= maxX; px += 4)
+            {
+                __m128 cx = _mm_add_ps(_mm_set1_ps(float(px)), lanes);
+
+                // pixels com o centro dentro do triângulo
+                __m128 mask = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(ea[0], cx), row[0]), zero);
+                mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(ea[1], cx), row[1]), zero));
+                mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(ea[2], cx), row[2]), zero));
+
+                if (!_mm_movemask_ps(mask))
+                    continue;
+
+                // guarda o oclusor mais próximo em cada pixel
+                __m128 z = _mm_min_ps(_mm_add_ps(_mm_mul_ps(zx, cx), zrow), limit);
+                __m128 stored = _mm_loadu_ps(line + px);
+                __m128 merged = _mm_min_ps(stored, z);
+                _mm_storeu_ps(line + px, _mm_or_ps(_mm_and_ps(mask, merged), _mm_andnot_ps(mask, stored)));
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+bool Occlusion::Project(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                        const XMFLOAT4X4 & worldViewProj, float rect[4], float & nearest) const
+{
+    const XMFLOAT4X4 & m = worldViewProj;
+    rect[0] = rect[1] = 1e30f;
+    rect[2] = rect[3] = -1e30f;
+    nearest = 1.0f;
+
+    for (uint corner = 0; corner < 8; ++corner)
+    {
+        float px = center.x + (corner & 1 ? extents.x : -extents.x);
+        float py = center.y + (corner & 2 ? extents.y : -extents.y);
+        float pz = center.z + (corner & 4 ? extents.z : -extents.z);
+
+        float cx = m.m[0][0] * px + m.m[0][1] * py + m.m[0][2] * pz + m.m[0][3];
+        float cy = m.m[1][0] * px + m.m[1][1] * py + m.m[1][2] * pz + m.m[1][3];
+        float cz = m.m[2][0] * px + m.m[2][1] * py + m.m[2][2] * pz + m.m[2][3];
+        float cw = m.m[3][0] * px + m.m[3][1] * py + m.m[3][2] * pz + m.m[3][3];
+
+        // caixa cruza o plano próximo: o retângulo não a limita
+        if (cz < 0.0f || cw <= 0.0f)
+            return false;
+
+        float sx = (cx / cw * 0.5f + 0.5f) * width;
+        float sy = (0.5f - cy / cw * 0.5f) * height;
+
+        rect[0] = std::min(rect[0], sx);
+        rect[1] = std::min(rect[1], sy);
+        rect[2] = std::max(rect[2], sx);
+        rect[3] = std::max(rect[3], sy);
+        nearest = std::min(nearest, cz / cw);
+    }
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------
+
+float Occlusion::Coverage(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                          const XMFLOAT4X4 & worldViewProj) const
+{
+    float rect[4], nearest;
+    if (!Project(center, extents, worldViewProj, rect, nearest))
+        return 0.0f;
+
+    float w = std::min(rect[2], float(width)) - std::max(rect[0], 0.0f);
+    float h = std::min(rect[3], float(height)) - std::max(rect[1], 0.0f);
+    return w > 0.0f && h > 0.0f ? w * h / (float(width) * height) : 0.0f;
+}
+
+// -------------------------------------------------------------------------------
+
+bool Occlusion::Visible(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                        const XMFLOAT4X4 & worldViewProj)
+{
+    ++tested;
+
+    // perto demais para ser limitado pelo retângulo
+    float rect[4], nearest;
+    if (!Project(center, extents, worldViewProj, rect, nearest))
+        return true;
+
+    // todos os pixels que o retângulo toca, mais um de cada lado: um oclusor
+    // marca pixels com o centro coberto, mesmo que parte deles fique de fora
+    int minX = std::max(int(std::floor(rect[0])) - 1, 0);
+    int minY = std::max(int(std::floor(rect[1])) - 1, 0);
+    int maxX = std::min(int(std::ceil(rect[2])), int(width) - 1);
+    int maxY = std::min(int(std::ceil(rect[3])), int(height) - 1);
+
+    // fora da tela não é oclusão: fica para o recorte da GPU
+    if (minX > maxX || minY > maxY)
+        return true;
+
+    const __m128i first = _mm_set1_epi32(minX - 1);
+    const __m128i last = _mm_set1_epi32(maxX + 1);
+    const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128 limit = _mm_set1_ps(nearest);
+
+    for (int py = minY; py <= maxY; ++py)
+    {
+        const float * line = &depth[size_t(py) * stride];
+
+        for (int px = minX & ~3; px <= maxX; px += 4)
+        {
+            // colunas do grupo dentro do retângulo
+            __m128i column = _mm_add_epi32(_mm_set1_epi32(px), lanes);
+            __m128 inside = _mm_castsi128_ps(_mm_and_si128(
+                _mm_cmpgt_epi32(column, first), _mm_cmplt_epi32(column, last)));
+
+            // algum pixel sem oclusor à frente da caixa
+            __m128 open = _mm_cmpge_ps(_mm_loadu_ps(line + px), limit);
+            if (_mm_movemask_ps(_mm_and_ps(inside, open)))
+                return true;
+        }
+    }
+
+    ++culled;
+    return false;
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,152 @@
+/**********************************************************************************
+// Parametric (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Geometrias definidas por parâmetros (esfera, cilindro e esfera
+//              geodésica) regeneradas em várias tesselações. Todos os níveis
+//              de um conjunto de parâmetros ficam em uma única geometria, do
+//              mais detalhado ao mais simples, com o desvio de cada nível em
+//              Geometry::lods. Conjuntos repetidos reaproveitam a geometria
+//              já gerada.
+//
+**********************************************************************************/
+
+#include "Parametric.h"
+#include <algorithm>
+#include <cmath>
+
+// -------------------------------------------------------------------------------
+
+bool Parametric::operator==(const Parametric & other) const
+{
+    return shape == other.shape && radius == other.radius && top == other.top &&
+           height == other.height && slices == other.slices && stacks == other.stacks;
+}
+
+// -------------------------------------------------------------------------------
+
+ParametricCache::ParametricCache() : hits(0), misses(0)
+{}
+
+// -------------------------------------------------------------------------------
+
+ParametricCache::~ParametricCache()
+{
+    for (Entry * entry : entries)
+        delete entry;
+}
+
+// -------------------------------------------------------------------------------
+
+const Geometry & ParametricCache::Build(const Parametric & params, uint & nominal)
+{
+    for (Entry * entry : entries)
+    {
+        if (entry->params == params)
+        {
+            ++hits;
+            nominal = entry->nominal;
+            return entry->geometry;
+        }
+    }
+
+    ++misses;
+    Entry * entry = new Entry{ params, Geometry(), 0 };
+    Generate(params, *entry);
+    entries.push_back(entry);
+
+    nominal = entry->nominal;
+    return entry->geometry;
+}
+
+// -------------------------------------------------------------------------------
+
+void ParametricCache::Generate(const Parametric & params, Entry & entry)
+{
+    Geometry & result = entry.geometry;
+
+    // tesselações dos níveis: o dobro da pedida, a pedida, metade e um quarto
+    // (a esfera geodésica troca o fator 2 por uma subdivisão a mais ou a menos)
+    uint slices[Levels], stacks[Levels];
+    uint count = 0;
+
+    for (uint level = 0; level < Levels; ++level)
+    {
+        uint s, t;
+        if (params.shape == PARAMETRIC_GEOSPHERE)
+        {
+            int subdivisions = int(std::min(params.slices, 6u)) + 1 - int(level);
+            s = uint(std::max(std::min(subdivisions, 6), 0));
+            t = 0;
+        }
+        else
+        {
+            uint minStacks = params.shape == PARAMETRIC_SPHERE ? 2 : 1;
+            s = std::max(level == 0 ? params.slices * 2 : params.slices >> (level - 1), 3u);
+            t = std::max(level == 0 ? params.stacks * 2 : params.stacks >> (level - 1), minStacks);
+        }
+
+        // limites mínimos repetem o nível anterior
+        if (count > 0 && slices[count - 1] == s && stacks[count - 1] == t)
+            continue;
+
+        // nível que reproduz a geometria fixa
+        if (level == 1 || (params.shape == PARAMETRIC_GEOSPHERE && s == std::min(params.slices, 6u)))
+            entry.nominal = count;
+
+        slices[count] = s;
+        stacks[count] = t;
+        ++count;
+    }
+
+    for (uint level = 0; level < count; ++level)
+    {
+        Geometry shape;
+        float error;
+
+        // desvio máximo entre a superfície e os triângulos do nível
+        switch (params.shape)
+        {
+        case PARAMETRIC_SPHERE:
+            shape = Sphere(params.radius, slices[level], stacks[level]);
+            error = params.radius * (1.0f - std::cos(XM_PI / slices[level]) * std::cos(XM_PIDIV2 / stacks[level]));
+            break;
+
+        case PARAMETRIC_CYLINDER:
+            shape = Cylinder(params.radius, params.top, params.height, slices[level], stacks[level]);
+            error = std::max(params.radius, params.top) * (1.0f - std::cos(XM_PI / slices[level]));
+            break;
+
+        default:
+            // triângulos projetados na esfera têm tamanhos diferentes: o desvio
+            // é medido pelo plano de cada triângulo mais próximo do centro
+            shape = GeoSphere(params.radius, slices[level]);
+            error = 0.0f;
+            for (uint t = 0; t + 3 <= shape.indices.size(); t += 3)
+            {
+                XMVECTOR a = XMLoadFloat3(&shape.vertices[shape.indices[t]].pos);
+                XMVECTOR b = XMLoadFloat3(&shape.vertices[shape.indices[t + 1]].pos);
+                XMVECTOR c = XMLoadFloat3(&shape.vertices[shape.indices[t + 2]].pos);
+                XMVECTOR n = XMVector3Normalize(XMVector3Cross(XMVectorSubtract(b, a), XMVectorSubtract(c, a)));
+                error = std::max(error, params.radius - std::fabs(XMVectorGetX(XMVector3Dot(n, a))));
+            }
+            break;
+        }
+
+        // níveis são acrescentados com índices absolutos
+        uint baseVertex = uint(result.vertices.size());
+        uint startIndex = uint(result.indices.size());
+
+        result.vertices.insert(result.vertices.end(), shape.vertices.begin(), shape.vertices.end());
+        result.indices.reserve(startIndex + shape.indices.size());
+        for (uint index : shape.indices)
+            result.indices.push_back(index + baseVertex);
+
+        result.lods.push_back({ startIndex, uint(shape.indices.size()), error });
+    }
+}
+
+// -------------------------------------------------------------------------------
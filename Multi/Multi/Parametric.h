@@ -0,0 +1,94 @@
+/**********************************************************************************
+// Parametric (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Geometrias definidas por parâmetros (esfera, cilindro e esfera
+//              geodésica) regeneradas em várias tesselações. Todos os níveis
+//              de um conjunto de parâmetros ficam em uma única geometria, do
+//              mais detalhado ao mais simples, com o desvio de cada nível em
+//              Geometry::lods. Conjuntos repetidos reaproveitam a geometria
+//              já gerada.
+//
+**********************************************************************************/
+
+#ifndef DXUT_PARAMETRIC_H_
+#define DXUT_PARAMETRIC_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Geometry.h"
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+enum ParametricShape { PARAMETRIC_SPHERE, PARAMETRIC_CYLINDER, PARAMETRIC_GEOSPHERE };
+
+// parâmetros de geração, como nos construtores das geometrias
+struct Parametric
+{
+    uint  shape;                                    // forma (ParametricShape)
+    float radius;                                   // raio (base do cilindro)
+    float top;                                      // raio do topo do cilindro
+    float height;                                   // altura do cilindro
+    uint  slices;                                   // fatias (subdivisões da esfera geodésica)
+    uint  stacks;                                   // camadas
+
+    bool operator==(const Parametric & other) const;
+};
+
+// -------------------------------------------------------------------------------
+
+class ParametricCache
+{
+private:
+    // geometria gerada para um conjunto de parâmetros
+    struct Entry
+    {
+        Parametric params;                          // parâmetros de geração
+        Geometry geometry;                          // todos os níveis de detalhe
+        uint nominal;                               // nível com a tesselação pedida
+    };
+
+    vector<Entry*> entries;                         // geometrias já geradas
+    ullong hits;                                    // pedidos atendidos pelo cache
+    ullong misses;                                  // pedidos que geraram geometria
+
+    static void Generate(const Parametric & params, Entry & entry);  // gera os níveis
+
+public:
+    static const uint Levels = 4;                   // níveis gerados por conjunto
+
+    ParametricCache();                              // construtor
+    ~ParametricCache();                             // destrutor
+
+    // geometria com todos os níveis e o índice do nível pedido
+    const Geometry & Build(const Parametric & params, uint & nominal);
+
+    uint Size() const;                              // conjuntos de parâmetros gerados
+    ullong Hits() const;                            // pedidos atendidos pelo cache
+    ullong Misses() const;                          // pedidos que geraram geometria
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// conjuntos de parâmetros gerados
+inline uint ParametricCache::Size() const
+{ return uint(entries.size()); }
+
+// pedidos atendidos pelo cache
+inline ullong ParametricCache::Hits() const
+{ return hits; }
+
+// pedidos que geraram geometria
+inline ullong ParametricCache::Misses() const
+{ return misses; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -1,12 +1,12 @@
 /**********************************************************************************
 // Pixel (Arquivo de Sombreamento)
 //
-// Criao:     22 Jul 2020
-// Atualizao: 08 Set 2023
+// Criação:     22 Jul 2020
+// Atualização: 08 Set 2023
 // Compilador:  Direct3D Shader Compiler (FXC)
 //
-// Descrio:   Um pixel shader simples que apenas passa a cor do pixel
-//              para frente sem realizar nenhuma modificao.
+// Descrição:   Um pixel shader simples que apenas passa a cor do pixel
+//              para frente sem realizar nenhuma modificação.
 //
 **********************************************************************************/
 
@@ -0,0 +1,304 @@
+/**********************************************************************************
+// Profiler (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Registra faixas de tempo nomeadas da CPU e da GPU em uma
+//              única linha do tempo (segundos desde a criação do profiler).
+//              Guarda as faixas mais recentes, responde consultas e exporta
+//              no formato de trace do Chrome (chrome://tracing). Não depende
+//              do Direct3D: os tempos da GPU chegam já convertidos.
+//
+**********************************************************************************/
+
+#include "Profiler.h"
+#include "Clock.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <atomic>
+using std::lock_guard;
+using std::ofstream;
+using std::stringstream;
+
+// -------------------------------------------------------------------------------
+
+Profiler * Profiler::active = nullptr;
+
+// faixas medidas por cada thread, entregues ao profiler
+// quando o escopo mais externo da thread termina
+namespace
+{
+    struct ThreadRanges
+    {
+        vector<ProfileRange> pending;               // faixas ainda não entregues
+        uint depth = 0;                             // escopos abertos
+        uint id = 0;                                // número da thread
+        ThreadRanges();
+    };
+
+    std::atomic<uint> threadCount{ 0 };
+
+    ThreadRanges::ThreadRanges() : id(threadCount++) { pending.reserve(64); }
+
+    thread_local ThreadRanges threadRanges;
+}
+
+// -------------------------------------------------------------------------------
+
+Profiler::Profiler(TimeSource source)
+{
+    // contador de alta precisão da plataforma
+    if (!source)
+        source = Clock::Seconds;
+
+    clock = source;
+    origin = clock();
+    head = 0;
+    count = 0;
+    frame = 0;
+    ranges.resize(MaxRanges);
+}
+
+// -------------------------------------------------------------------------------
+
+void Profiler::EndCpu(const ProfileMark & mark)
+{
+    ProfileRange range = {};
+    range.name = mark.name;
+    range.track = CPU_TRACK;
+    range.thread = threadRanges.id;
+    range.frame = frame;
+    range.start = mark.start;
+    range.end = Now();
+    Add(range);
+}
+
+// -------------------------------------------------------------------------------
+
+void Profiler::Add(const ProfileRange & range)
+{
+    // faixas podem chegar de várias threads de gravação
+    lock_guard<mutex> guard(lock);
+
+    // sobrescreve a faixa mais antiga quando o histórico está cheio
+    ranges[head] = range;
+    head = (head + 1) % MaxRanges;
+    if (count < MaxRanges)
+        ++count;
+}
+
+// -------------------------------------------------------------------------------
+
+void Profiler::Add(const vector<ProfileRange> & batch)
+{
+    lock_guard<mutex> guard(lock);
+
+    for (const ProfileRange & range : batch)
+    {
+        ranges[head] = range;
+        head = (head + 1) % MaxRanges;
+        if (count < MaxRanges)
+            ++count;
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+ProfileScope::ProfileScope(const char * name) : name(name)
+{
+    profiler = Profiler::Active();
+    start = profiler ? profiler->Now() : 0.0;
+    ++threadRanges.depth;
+}
+
+// -------------------------------------------------------------------------------
+
+ProfileScope::~ProfileScope()
+{
+    ThreadRanges & local = threadRanges;
+    --local.depth;
+
+    // faixas pendentes de um profiler desativado no meio
+    // do escopo são descartadas, não entregues ao próximo
+    Profiler * current = Profiler::Active();
+    if (!current)
+    {
+        if (local.depth == 0)
+            local.pending.clear();
+        return;
+    }
+
+    // o escopo só é medido se começou no mesmo profiler
+    if (profiler == current)
+    {
+        ProfileRange range = {};
+        range.name = name;
+        range.track = CPU_TRACK;
+        range.thread = local.id;
+        range.depth = local.depth;
+        range.frame = current->Frame();
+        range.start = start;
+        range.end = current->Now();
+        local.pending.push_back(range);
+    }
+
+    // entrega as faixas ao fechar o escopo mais externo
+    // (ou antes, se um escopo longo acumular muitas faixas)
+    if (local.depth == 0 || local.pending.size() >= 256)
+    {
+        current->Add(local.pending);
+        local.pending.clear();
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+uint Profiler::Count() const
+{
+    lock_guard<mutex> guard(lock);
+    return count;
+}
+
+// -------------------------------------------------------------------------------
+
+ProfileRange Profiler::Range(uint index) const
+{
+    lock_guard<mutex> guard(lock);
+    return ranges[(head + MaxRanges - count + index) % MaxRanges];
+}
+
+// -------------------------------------------------------------------------------
+
+bool Profiler::Last(const string & name, ProfileRange & range) const
+{
+    lock_guard<mutex> guard(lock);
+
+    // percorre do mais recente para o mais antigo
+    for (uint i = 1; i <= count; ++i)
+    {
+        const ProfileRange & r = ranges[(head + MaxRanges - i) % MaxRanges];
+        if (r.name == name)
+        {
+            range = r;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// -------------------------------------------------------------------------------
+
+double Profiler::Average(const string & name) const
+{
+    lock_guard<mutex> guard(lock);
+
+    double total = 0.0;
+    uint found = 0;
+
+    for (uint i = 1; i <= count; ++i)
+    {
+        const ProfileRange & r = ranges[(head + MaxRanges - i) % MaxRanges];
+        if (r.name == name)
+        {
+            total += r.Duration();
+            ++found;
+        }
+    }
+
+    return found ? total / found : 0.0;
+}
+
+// -------------------------------------------------------------------------------
+
+void Profiler::Clear()
+{
+    lock_guard<mutex> guard(lock);
+    head = 0;
+    count = 0;
+}
+
+// -------------------------------------------------------------------------------
+
+string Profiler::ChromeTrace() const
+{
+    lock_guard<mutex> guard(lock);
+
+    // eventos completos ("ph": "X") com tempos em microssegundos,
+    // uma thread do trace para a GPU e uma para cada thread da CPU
+    stringstream text;
+    text << std::fixed;
+    text.precision(3);
+    text << "{\"traceEvents\":[\n";
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const ProfileRange & r = ranges[(head + MaxRanges - count + i) % MaxRanges];
+
+        // escapa aspas, barras e caracteres de controle do nome
+        string name;
+        for (char c : r.name)
+        {
+            if (c == '"' || c == '\\')
+            {
+                name += '\\';
+                name += c;
+            }
+            else if (byte(c) < 0x20)
+            {
+                char code[8];
+                snprintf(code, sizeof(code), "\\u%04x", uint(byte(c)));
+                name += code;
+            }
+            else
+            {
+                name += c;
+            }
+        }
+
+        text << (i ? ",\n" : "")
+             << "{\"name\":\"" << name << "\",\"ph\":\"X\",\"pid\":0"
+             << ",\"tid\":" << (r.track == GPU_TRACK ? 0 : r.thread + 1)
+             << ",\"ts\":" << r.start * 1e6
+             << ",\"dur\":" << r.Duration() * 1e6
+             << ",\"args\":{\"frame\":" << r.frame;
+
+        if (r.hasStats)
+        {
+            text << ",\"vertices\":" << r.vertices
+                 << ",\"primitives\":" << r.primitives
+                 << ",\"pixels\":" << r.pixels;
+        }
+
+        text << "}}";
+    }
+
+    // nomes das threads no visualizador
+    text << (count ? ",\n" : "")
+         << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"GPU\"}}";
+
+    for (uint i = 0; i < threadCount; ++i)
+        text << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i + 1
+             << ",\"args\":{\"name\":\"CPU " << i << "\"}}";
+
+    text << "\n]}\n";
+
+    return text.str();
+}
+
+// -------------------------------------------------------------------------------
+
+bool Profiler::Export(const string & fileName) const
+{
+    ofstream fout(fileName, std::ios::out | std::ios::trunc);
+    if (!fout)
+        return false;
+
+    fout << ChromeTrace();
+    return bool(fout);
+}
+
+// -------------------------------------------------------------------------------
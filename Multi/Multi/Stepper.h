@@ -0,0 +1,113 @@
+/**********************************************************************************
+// Stepper (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Acumulador da simulação em passos fixos: consome o tempo de
+//              cada quadro em passos de mesma duração, limita os passos de
+//              recuperação por quadro (descartando o atraso restante) e
+//              informa a fração do passo já transcorrida para a interpolação
+//              do desenho. Não depende da Engine: quem usa executa os passos.
+//
+**********************************************************************************/
+
+#ifndef DXUT_STEPPER_H_
+#define DXUT_STEPPER_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <cmath>
+
+// -------------------------------------------------------------------------------
+
+class Stepper
+{
+private:
+    double step;                                    // duração do passo (0 = um passo por quadro)
+    uint   limit;                                   // limite de passos por quadro
+    double accumulator;                             // tempo ainda não simulado
+    double interpolation;                           // fração do passo já transcorrida
+    ullong steps;                                   // passos executados
+    ullong skipped;                                 // passos descartados pelo limite
+
+public:
+    Stepper();                                      // construtor
+
+    void Fixed(double duration, uint maxSteps = 5); // define passo fixo (0 = desativado)
+    double Step() const;                            // duração do passo
+
+    // consome o tempo do quadro chamando fixedUpdate a cada passo (retorna passos)
+    template<class FixedUpdate>
+    uint Advance(double frameTime, FixedUpdate fixedUpdate);
+
+    double Interpolation() const;                   // fração do passo já transcorrida
+    ullong Steps() const;                           // passos executados
+    ullong Skipped() const;                         // passos descartados pelo limite
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+inline Stepper::Stepper()
+    : step(0.0), limit(5), accumulator(0.0), interpolation(1.0), steps(0), skipped(0)
+{}
+
+// reinicia o acumulador: o tempo pendente do passo anterior é descartado
+inline void Stepper::Fixed(double duration, uint maxSteps)
+{ step = duration; limit = maxSteps; accumulator = 0.0; interpolation = duration > 0.0 ? 0.0 : 1.0; }
+
+inline double Stepper::Step() const
+{ return step; }
+
+template<class FixedUpdate>
+inline uint Stepper::Advance(double frameTime, FixedUpdate fixedUpdate)
+{
+    // sem passo fixo: um passo de simulação por quadro
+    if (step <= 0.0)
+    {
+        fixedUpdate();
+        interpolation = 1.0;
+        ++steps;
+        return 1;
+    }
+
+    // consome o tempo do quadro em passos de duração fixa
+    accumulator += frameTime;
+
+    uint count = 0;
+    while (accumulator >= step && count < limit)
+    {
+        fixedUpdate();
+        accumulator -= step;
+        ++count;
+    }
+
+    // quadro longo demais: descarta o atraso em vez de tentar
+    // recuperá-lo nos próximos quadros (que ficariam ainda mais longos)
+    if (accumulator >= step)
+    {
+        double rest = std::fmod(accumulator, step);
+        skipped += ullong((accumulator - rest) / step + 0.5);
+        accumulator = rest;
+    }
+
+    steps += count;
+    interpolation = accumulator / step;
+    return count;
+}
+
+inline double Stepper::Interpolation() const
+{ return interpolation; }
+
+inline ullong Stepper::Steps() const
+{ return steps; }
+
+inline ullong Stepper::Skipped() const
+{ return skipped; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,185 @@
+/**********************************************************************************
+// Telemetry (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Guarda os tempos de CPU dos quadros mais recentes (Update,
+//              Draw e Present) em um buffer circular sem travas, calcula
+//              percentis e conta engasgos. Fica ativa em todas as
+//              configurações e exporta os dados em CSV ou JSON.
+//
+**********************************************************************************/
+
+#include "Telemetry.h"
+#include <algorithm>
+#include <fstream>
+#include <vector>
+using std::ofstream;
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+Telemetry::Telemetry()
+{
+    written = 0;
+    started = 0;
+    hitches = 0;
+    average = 0.0;
+    hitchFactor = 2.0;
+}
+
+// -------------------------------------------------------------------------------
+
+void Telemetry::Add(double update, double draw, double present)
+{
+    // apenas a thread principal grava: a posição é publicada
+    // depois do quadro, para que leitores nunca vejam dados parciais
+    ullong n = written.load(std::memory_order_relaxed);
+
+    // anuncia o quadro antes de sobrescrever a posição
+    started.store(n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    FrameSample s;
+    s.update  = float(update * 1000.0);
+    s.draw    = float(draw * 1000.0);
+    s.present = float(present * 1000.0);
+    s.total   = s.update + s.draw + s.present;
+
+    Slot & slot = samples[n & (Capacity - 1)];
+    slot.update.store(s.update, std::memory_order_relaxed);
+    slot.draw.store(s.draw, std::memory_order_relaxed);
+    slot.present.store(s.present, std::memory_order_relaxed);
+    slot.total.store(s.total, std::memory_order_relaxed);
+
+    written.store(n + 1, std::memory_order_release);
+
+    // engasgo: quadro muito acima da média recente
+    if (n >= Warmup && s.total > hitchFactor * average)
+        ++hitches;
+
+    average = (n == 0) ? s.total : average + (s.total - average) / 32.0;
+}
+
+// -------------------------------------------------------------------------------
+
+uint Telemetry::Snapshot(FrameSample * copy, ullong & first) const
+{
+    ullong end = written.load(std::memory_order_acquire);
+    uint count = uint(std::min<ullong>(end, Capacity));
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const Slot & slot = samples[(end - count + i) & (Capacity - 1)];
+        copy[i].update  = slot.update.load(std::memory_order_relaxed);
+        copy[i].draw    = slot.draw.load(std::memory_order_relaxed);
+        copy[i].present = slot.present.load(std::memory_order_relaxed);
+        copy[i].total   = slot.total.load(std::memory_order_relaxed);
+    }
+
+    // descarta os quadros mais antigos se o gravador pode tê-los
+    // sobrescrito durante a cópia (inclui o quadro sendo gravado)
+    std::atomic_thread_fence(std::memory_order_acquire);
+    ullong pending = started.load(std::memory_order_relaxed) - end;
+    ullong free = Capacity - count;
+    uint lost = pending > free ? uint(std::min<ullong>(pending - free, count)) : 0;
+
+    if (lost)
+        std::copy(copy + lost, copy + count, copy);
+
+    // número do quadro mais antigo copiado
+    first = end - count + lost;
+    return count - lost;
+}
+
+// -------------------------------------------------------------------------------
+
+FrameStats Telemetry::Stats(uint field) const
+{
+    FrameStats stats = {};
+
+    vector<FrameSample> copy(Capacity);
+    ullong first;
+    uint count = Snapshot(copy.data(), first);
+    if (count == 0)
+        return stats;
+
+    // extrai o campo pedido
+    vector<float> values(count);
+    for (uint i = 0; i < count; ++i)
+    {
+        switch (field)
+        {
+        case FRAME_UPDATE:  values[i] = copy[i].update; break;
+        case FRAME_DRAW:    values[i] = copy[i].draw; break;
+        case FRAME_PRESENT: values[i] = copy[i].present; break;
+        default:            values[i] = copy[i].total; break;
+        }
+    }
+
+    double sum = 0.0;
+    for (float v : values)
+        sum += v;
+
+    std::sort(values.begin(), values.end());
+
+    stats.frames = count;
+    stats.average = sum / count;
+    stats.p50 = values[size_t(0.50 * (count - 1))];
+    stats.p95 = values[size_t(0.95 * (count - 1))];
+    stats.p99 = values[size_t(0.99 * (count - 1))];
+    stats.max = values.back();
+    return stats;
+}
+
+// -------------------------------------------------------------------------------
+
+bool Telemetry::Export(const string & fileName) const
+{
+    ofstream fout(fileName, std::ios::out | std::ios::trunc);
+    if (!fout)
+        return false;
+
+    // o gravador pode avançar durante a exportação: a numeração
+    // vem da mesma cópia que os tempos
+    vector<FrameSample> copy(Capacity);
+    ullong first;
+    uint count = Snapshot(copy.data(), first);
+
+    bool json = fileName.size() >= 5 && fileName.compare(fileName.size() - 5, 5, ".json") == 0;
+
+    if (json)
+    {
+        FrameStats total = Stats(FRAME_TOTAL);
+        fout << "{\"hitches\":" << hitches
+             << ",\"p50\":" << total.p50 << ",\"p95\":" << total.p95
+             << ",\"p99\":" << total.p99 << ",\"max\":" << total.max
+             << ",\"frames\":[\n";
+
+        for (uint i = 0; i < count; ++i)
+            fout << (i ? ",\n" : "")
+                 << "{\"frame\":" << first + i
+                 << ",\"update\":" << copy[i].update
+                 << ",\"draw\":" << copy[i].draw
+                 << ",\"present\":" << copy[i].present
+                 << ",\"total\":" << copy[i].total << "}";
+
+        fout << "\n]}\n";
+    }
+    else
+    {
+        fout << "frame,update_ms,draw_ms,present_ms,total_ms\n";
+        for (uint i = 0; i < count; ++i)
+            fout << first + i << ','
+                 << copy[i].update << ','
+                 << copy[i].draw << ','
+                 << copy[i].present << ','
+                 << copy[i].total << '\n';
+    }
+
+    return bool(fout);
+}
+
+// -------------------------------------------------------------------------------
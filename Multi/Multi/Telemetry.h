@@ -0,0 +1,115 @@
+/**********************************************************************************
+// Telemetry (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Guarda os tempos de CPU dos quadros mais recentes (Update,
+//              Draw e Present) em um buffer circular sem travas, calcula
+//              percentis e conta engasgos. Fica ativa em todas as
+//              configurações e exporta os dados em CSV ou JSON.
+//
+**********************************************************************************/
+
+#ifndef DXUT_TELEMETRY_H_
+#define DXUT_TELEMETRY_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <atomic>
+#include <string>
+using std::atomic;
+using std::string;
+
+// -------------------------------------------------------------------------------
+
+enum FrameField { FRAME_UPDATE, FRAME_DRAW, FRAME_PRESENT, FRAME_TOTAL };
+
+// tempos de um quadro em milissegundos
+struct FrameSample
+{
+    float update;                                   // atualização da aplicação
+    float draw;                                     // gravação dos desenhos
+    float present;                                  // submissão e apresentação
+    float total;                                    // soma das etapas
+};
+
+// estatísticas da janela de quadros recentes
+struct FrameStats
+{
+    uint   frames;                                  // quadros considerados
+    double average;                                 // média em milissegundos
+    double p50;                                     // mediana
+    double p95;                                     // percentil 95
+    double p99;                                     // percentil 99
+    double max;                                     // pior quadro
+};
+
+// -------------------------------------------------------------------------------
+
+class Telemetry
+{
+private:
+    static const uint Capacity = 1024;              // quadros guardados (potência de 2)
+    static const uint Warmup = 30;                  // quadros antes de contar engasgos
+
+    // posição do buffer: leitores podem copiá-la enquanto o gravador
+    // a sobrescreve (a cópia é descartada), por isso os campos são atômicos
+    struct Slot
+    {
+        atomic<float> update, draw, present, total;
+    };
+
+    Slot samples[Capacity];                         // buffer circular
+    atomic<ullong> written;                         // quadros gravados desde o início
+    atomic<ullong> started;                         // quadros iniciados (gravado ou em gravação)
+    ullong hitches;                                 // quadros muito acima da média
+    double average;                                 // média móvel exponencial do quadro
+    double hitchFactor;                             // limite de engasgo (múltiplo da média)
+    string output;                                  // arquivo gravado no encerramento
+
+    uint Snapshot(FrameSample * copy, ullong & first) const;    // copia quadros válidos (do mais antigo)
+
+public:
+    Telemetry();                                    // construtor
+
+    void Add(double update, double draw, double present);  // registra um quadro (em segundos)
+
+    ullong Frames() const;                          // quadros registrados desde o início
+    ullong Hitches() const;                         // engasgos registrados desde o início
+    void HitchFactor(double factor);                // define limite de engasgo
+    FrameStats Stats(uint field = FRAME_TOTAL) const;   // estatísticas da janela recente
+
+    void Output(const string & fileName);           // arquivo gravado no encerramento
+    const string & Output() const;                  // retorna arquivo do encerramento
+    bool Export(const string & fileName) const;     // grava CSV (ou JSON se .json)
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// quadros registrados desde o início
+inline ullong Telemetry::Frames() const
+{ return written.load(std::memory_order_acquire); }
+
+// engasgos registrados desde o início
+inline ullong Telemetry::Hitches() const
+{ return hitches; }
+
+// quadros acima de factor vezes a média contam como engasgo
+inline void Telemetry::HitchFactor(double factor)
+{ hitchFactor = factor; }
+
+// define arquivo gravado no encerramento (vazio = nenhum)
+inline void Telemetry::Output(const string & fileName)
+{ output = fileName; }
+
+// retorna arquivo gravado no encerramento
+inline const string & Telemetry::Output() const
+{ return output; }
+
+// -------------------------------------------------------------------------------
+
+#endif
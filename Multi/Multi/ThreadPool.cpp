@@ -0,0 +1,158 @@
+/**********************************************************************************
+// ThreadPool (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Mantém um conjunto de threads persistentes que executam
+//              um trabalho dividido em faixas contíguas de elementos.
+//              A thread que dispara o trabalho também participa dele.
+//              Um trabalho disparado com o conjunto ocupado, por outra
+//              thread ou de dentro de um bloco, executa na thread atual.
+//
+**********************************************************************************/
+
+#include "ThreadPool.h"
+using std::unique_lock;
+using std::lock_guard;
+
+// -------------------------------------------------------------------------------
+
+ThreadPool::ThreadPool(uint threads)
+{
+    task = nullptr;
+    taskChunks = 0;
+    taskCount = 0;
+    nextChunk = 0;
+    remaining = 0;
+    busy = false;
+    active = 0;
+    generation = 0;
+    quit = false;
+
+    // usa todos os núcleos disponíveis (a thread chamadora é um deles)
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    for (uint i = 1; i < threads; ++i)
+        workers.emplace_back(&ThreadPool::Worker, this);
+}
+
+// -------------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        quit = true;
+    }
+    wake.notify_all();
+
+    for (thread & t : workers)
+        t.join();
+}
+
+// -------------------------------------------------------------------------------
+
+void ThreadPool::Execute()
+{
+    uint chunk;
+    while ((chunk = nextChunk.fetch_add(1)) < taskChunks)
+    {
+        // faixa contígua de elementos do bloco
+        uint first = uint(ullong(chunk) * taskCount / taskChunks);
+        uint last = uint(ullong(chunk + 1) * taskCount / taskChunks);
+
+        (*task)(chunk, first, last);
+
+        // o último bloco concluído avisa a thread chamadora
+        if (remaining.fetch_sub(1) == 1)
+        {
+            lock_guard<mutex> guard(lock);
+            done.notify_all();
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+void ThreadPool::Worker()
+{
+    ullong seen = 0;
+
+    while (true)
+    {
+        {
+            unique_lock<mutex> guard(lock);
+            wake.wait(guard, [&] { return quit || generation != seen; });
+
+            if (quit)
+                return;
+
+            seen = generation;
+
+            // o trabalho pode ter sido concluído antes desta thread acordar
+            if (remaining == 0)
+                continue;
+
+            ++active;
+        }
+
+        Execute();
+
+        {
+            lock_guard<mutex> guard(lock);
+            if (--active == 0 && remaining == 0)
+                done.notify_all();
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+void ThreadPool::Run(uint chunks, uint count, const Task & func)
+{
+    if (chunks == 0)
+        return;
+
+    // sem threads auxiliares, sem divisão ou com outro trabalho em execução,
+    // executa na thread atual (um só trabalho usa as threads de cada vez)
+    if (chunks == 1 || workers.empty() || busy.exchange(true))
+    {
+        for (uint i = 0; i < chunks; ++i)
+            func(i, uint(ullong(i) * count / chunks), uint(ullong(i + 1) * count / chunks));
+        return;
+    }
+
+    {
+        lock_guard<mutex> guard(lock);
+        task = &func;
+        taskChunks = chunks;
+        taskCount = count;
+        nextChunk = 0;
+        remaining = chunks;
+        ++generation;
+    }
+    wake.notify_all();
+
+    // a thread chamadora também executa blocos
+    Execute();
+
+    // espera todos os blocos e todas as threads saírem do trabalho
+    unique_lock<mutex> guard(lock);
+    done.wait(guard, [this] { return remaining == 0 && active == 0; });
+    task = nullptr;
+    busy = false;
+}
+
+// -------------------------------------------------------------------------------
+
+ThreadPool & ThreadPool::Shared()
+{
+    // criado no primeiro uso e compartilhado por Geometry e HalfEdgeMesh
+    static ThreadPool pool;
+    return pool;
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,82 @@
+/**********************************************************************************
+// ThreadPool (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Mantém um conjunto de threads persistentes que executam
+//              um trabalho dividido em faixas contíguas de elementos.
+//              A thread que dispara o trabalho também participa dele.
+//              Um trabalho disparado com o conjunto ocupado, por outra
+//              thread ou de dentro de um bloco, executa na thread atual.
+//
+**********************************************************************************/
+
+#ifndef DXUT_THREADPOOL_H_
+#define DXUT_THREADPOOL_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <condition_variable>
+using std::vector;
+using std::thread;
+using std::mutex;
+using std::atomic;
+using std::function;
+using std::condition_variable;
+
+// -------------------------------------------------------------------------------
+
+// trabalho executado sobre a faixa [first, last) do bloco chunk
+using Task = function<void(uint chunk, uint first, uint last)>;
+
+// -------------------------------------------------------------------------------
+
+class ThreadPool
+{
+private:
+    vector<thread> workers;                         // threads de trabalho
+    mutex lock;                                     // protege o estado do trabalho
+    condition_variable wake;                        // acorda as threads de trabalho
+    condition_variable done;                        // sinaliza fim do trabalho
+
+    const Task * task;                              // trabalho em execução
+    uint taskChunks;                                // número de blocos do trabalho
+    uint taskCount;                                 // número de elementos do trabalho
+    atomic<uint> nextChunk;                         // próximo bloco a executar
+    atomic<uint> remaining;                         // blocos ainda não concluídos
+    atomic<bool> busy;                              // um trabalho já está em execução
+    uint active;                                    // threads participando do trabalho
+    ullong generation;                              // identifica cada trabalho disparado
+    bool quit;                                      // encerra as threads de trabalho
+
+    void Execute();                                 // executa blocos até esgotar o trabalho
+    void Worker();                                  // laço das threads de trabalho
+
+public:
+    ThreadPool(uint threads = 0);                   // construtor (0 = núcleos disponíveis)
+    ~ThreadPool();                                  // destrutor
+
+    uint Size() const;                              // número de threads (inclui a chamadora)
+    void Run(uint chunks, uint count, const Task & func);   // divide count elementos em blocos
+
+    static ThreadPool & Shared();                   // conjunto usado pelos algoritmos de geometria
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// número de threads que podem executar blocos ao mesmo tempo
+inline uint ThreadPool::Size() const
+{ return uint(workers.size()) + 1; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -1,21 +1,24 @@
 /**********************************************************************************
-// Window (Cdigo Fonte)
+// Window (Código Fonte)
 // 
-// Criao:     19 Mai 2007
-// Atualizao:	26 Jul 2023
+// Criação:     19 Mai 2007
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:   Abstrai os detalhes de configurao de uma janela
+// Descrição:   Abstrai os detalhes de configuração de uma janela
+//              No Windows cria uma janela Win32. Nas demais plataformas
+//              a janela é uma superfície fora da tela: guarda apenas o
+//              tamanho e o pedido de fechamento, sem sistema de janelas.
 //
 **********************************************************************************/
 
 #include "Window.h"
 
 // -------------------------------------------------------------------------------
-// inicializao de membros estticos da classe
+// inicialização de membros estáticos da classe
 
-void (*Window::inFocus)()     = nullptr;                            // nenhuma ao ao ganhar foco
-void (*Window::lostFocus)()   = nullptr;                            // nenhuma ao ao perder foco
+void (*Window::inFocus)()     = nullptr;                            // nenhuma ação ao ganhar foco
+void (*Window::lostFocus)()   = nullptr;                            // nenhuma ação ao perder foco
 int Window::screenWidth       = 0;                                  // largura da tela
 int Window::screenHeight      = 0;                                  // altura da tela
 
@@ -24,23 +27,29 @@ int Window::screenHeight      = 0;                                  // altura da
 
 Window::Window()
 {
-    windowId          = 0;                                           // id nulo porque a janela ainda no existe
+#ifdef _WIN32
+    windowId          = 0;                                           // id nulo porque a janela ainda não existe
     screenWidth       = GetSystemMetrics(SM_CXSCREEN);               // largura da tela
     screenHeight      = GetSystemMetrics(SM_CYSCREEN);               // altura da tela
+    windowIcon        = LoadIcon(NULL, IDI_APPLICATION);             // ícone padrão de uma aplicação
+    windowCursor      = LoadCursor(NULL, IDC_ARROW);                 // cursor padrão de uma aplicação
+    windowColor       = RGB(0,0,0);                                  // cor de fundo padrão é preta
+    windowStyle       = WS_POPUP | WS_VISIBLE;                       // estilo para tela cheia
+    windowHdc         = { 0 };                                       // contexto do dispositivo
+    windowRect        = { 0, 0, 0, 0 };                              // área cliente da janela
+#else
+    windowClosed      = false;                                       // nenhum fechamento pedido
+    screenWidth       = 1920;                                        // sem monitor: tela virtual Full HD
+    screenHeight      = 1080;                                        // sem monitor: tela virtual Full HD
+#endif
     windowWidth       = screenWidth;                                 // janela ocupa toda a tela (tela cheia)
     windowHeight      = screenHeight;                                // janela ocupa toda a tela (tela cheia)
-    windowIcon        = LoadIcon(NULL, IDI_APPLICATION);             // cone padro de uma aplicao
-    windowCursor      = LoadCursor(NULL, IDC_ARROW);                 // cursor padro de uma aplicao
-    windowColor       = RGB(0,0,0);                                  // cor de fundo padro  preta
-    windowTitle       = string("Windows App");                       // ttulo padro da janela
-    windowStyle       = WS_POPUP | WS_VISIBLE;                       // estilo para tela cheia
-    windowMode        = FULLSCREEN;                                  // modo padro  tela cheia
-    windowPosX        = 0;                                           // posio inicial da janela no eixo x
-    windowPosY        = 0;                                           // posio inicial da janela no eixo y
+    windowTitle       = string("Windows App");                       // título padrão da janela
+    windowMode        = FULLSCREEN;                                  // modo padrão é tela cheia
+    windowPosX        = 0;                                           // posição inicial da janela no eixo x
+    windowPosY        = 0;                                           // posição inicial da janela no eixo y
     windowCenterX     = windowWidth/2;                               // centro da janela no eixo x
     windowCenterY     = windowHeight/2;                              // centro da janela no eixo y
-    windowHdc         = { 0 };                                       // contexto do dispositivo
-    windowRect        = { 0, 0, 0, 0 };                              // rea cliente da janela
     windowAspectRatio = windowWidth / float(windowHeight);           // aspect ratio da janela
     fullWidth         = windowWidth;                                 // largura da janela incluindo bordas
     fullHeight        = windowHeight;                                // altura da janela incluindo barras e bordas
@@ -48,16 +57,18 @@ Window::Window()
     resizeMode        = UNLOCKED;                                    // janela pode ser redimensionada livremente
     styleWidth        = 0;                                           // largura devido a bordas e barras da janela
     styleHeight       = 0;                                           // altura devido a bordas e barras da janela
-    windowMinWidth    = 0;                                           // largura mnima da janela
-    windowMinHeight   = 0;                                           // altura mnima da janela
+    windowMinWidth    = 0;                                           // largura mínima da janela
+    windowMinHeight   = 0;                                           // altura mínima da janela
 }
 
 // -------------------------------------------------------------------------------
 
 Window::~Window()
 {
+#ifdef _WIN32
     // libera contexto do dispositivo
     if (windowHdc) ReleaseDC(windowId, windowHdc);
+#endif
 }
 
 // -------------------------------------------------------------------------------
@@ -66,6 +77,8 @@ void Window::Mode(int mode)
 {
     windowMode = mode;
 
+#ifdef _WIN32
+
     if (windowMode == WINDOWED)
     {
         // modo em janela
@@ -88,6 +101,7 @@ void Window::Mode(int mode)
         // modo em tela cheia ou janela sem bordas
         windowStyle = WS_EX_TOPMOST | WS_POPUP | WS_VISIBLE; 
     } 
+#endif
 }
 
 // -------------------------------------------------------------------------------
@@ -110,7 +124,7 @@ void Window::Size(int width, int height)
     fullWidth = windowWidth = width;
     fullHeight = windowHeight = height;
 
-    // tamanho mnimo da janela
+    // tamanho mínimo da janela
     windowMinWidth = windowWidth / 2;
     windowMinHeight = windowHeight / 2;
 
@@ -120,11 +134,11 @@ void Window::Size(int width, int height)
     // aspect ratio da janela
     windowAspectRatio = windowWidth / float(windowHeight);
 
-    // posio do centro da janela
+    // posição do centro da janela
     windowCenterX = windowWidth/2;
     windowCenterY = windowHeight/2;
 
-    // ajusta a posio da janela para o centro da tela
+    // ajusta a posição da janela para o centro da tela
     windowPosX = (screenWidth/2) - (windowWidth/2);
     windowPosY = (screenHeight/2) - (windowHeight/2);
 }
@@ -133,7 +147,7 @@ void Window::Size(int width, int height)
 
 void Window::Resize(int width, int height)
 {
-    // tamanho da rea cliente da janela
+    // tamanho da área cliente da janela
     windowWidth = width;
     windowHeight = height;
 
@@ -147,11 +161,11 @@ void Window::Resize(int width, int height)
     // aspect ratio da janela com bordas e barras
     fullAspectRatio = fullWidth / float(fullHeight);
 
-    // posio do centro da janela
+    // posição do centro da janela
     windowCenterX = windowWidth / 2;
     windowCenterY = windowHeight / 2;
 
-    // ajusta a posio da janela para o centro da tela
+    // ajusta a posição da janela para o centro da tela
     windowPosX = (screenWidth / 2) - (windowWidth / 2);
     windowPosY = (screenHeight / 2) - (windowHeight / 2);
 }
@@ -164,27 +178,29 @@ void Window::FullResize(int width, int height)
     fullWidth = width;
     fullHeight = height;
 
-    // tamanho da rea cliente da janela
+    // tamanho da área cliente da janela
     windowWidth = width - styleWidth;
     windowHeight = height - styleHeight;
 
     // aspect ratio da janela
     windowAspectRatio = windowWidth / float(windowHeight);
 
-    // posio do centro da janela
+    // posição do centro da janela
     windowCenterX = windowWidth / 2;
     windowCenterY = windowHeight / 2;
 
-    // ajusta a posio da janela para o centro da tela
+    // ajusta a posição da janela para o centro da tela
     windowPosX = (screenWidth / 2) - (windowWidth / 2);
     windowPosY = (screenHeight / 2) - (windowHeight / 2);
 }
 
 // -------------------------------------------------------------------------------
 
+#ifdef _WIN32
+
 bool Window::Create()
 {
-    // identificador da aplicao
+    // identificador da aplicação
     HINSTANCE appId = GetModuleHandle(NULL);
     
     // definindo uma classe de janela
@@ -210,40 +226,40 @@ bool Window::Create()
     windowId = CreateWindowEx(
         NULL,                           // estilos extras
         "AppWindow",                    // nome da classe da janela
-        windowTitle.c_str(),            // ttulo da janela
+        windowTitle.c_str(),            // título da janela
         windowStyle,                    // estilo da janela
-        windowPosX, windowPosY,         // posio (x,y) inicial
+        windowPosX, windowPosY,         // posição (x,y) inicial
         windowWidth, windowHeight,      // largura e altura da janela
         NULL,                           // identificador da janela pai
         NULL,                           // identificador do menu
-        appId,                          // identificador da aplicao
-        NULL);                          // parmetros de criao
+        appId,                          // identificador da aplicação
+        NULL);                          // parâmetros de criação
 
-    // Ao usar o modo em janela  preciso levar em conta que as barras 
-    // e bordas ocupam espao na janela. O cdigo abaixo ajusta o tamanho
-    // da janela de forma que a rea cliente fique com tamanho 
+    // Ao usar o modo em janela é preciso levar em conta que as barras 
+    // e bordas ocupam espaço na janela. O código abaixo ajusta o tamanho
+    // da janela de forma que a área cliente fique com tamanho 
     // (windowWidth x windowHeight)
 
     if (windowMode == WINDOWED)
     {
-        // retngulo com o tamanho da rea cliente desejada
+        // retângulo com o tamanho da área cliente desejada
         RECT rect = {0, 0, windowWidth, windowHeight};
 
-        // ajusta o tamanho do retngulo
+        // ajusta o tamanho do retângulo
         AdjustWindowRectEx(&rect,
             GetWindowStyle(windowId),
             GetMenu(windowId) != NULL,
             GetWindowExStyle(windowId));
 
-        // novas dimenses da janela
+        // novas dimensões da janela
         fullWidth = rect.right - rect.left;
         fullHeight = rect.bottom - rect.top;
 
-        // dimenses dos estilos da janela
+        // dimensões dos estilos da janela
         styleWidth = fullWidth - windowWidth;
         styleHeight = fullHeight - windowHeight;
 
-        // ajusta a posio da janela para o centro da tela
+        // ajusta a posição da janela para o centro da tela
         windowPosX = (screenWidth/2) - (fullWidth/2);
         windowPosY = (screenHeight/2) - (fullHeight/2);
 
@@ -253,8 +269,8 @@ bool Window::Create()
         // redimensiona janela com uma chamada a MoveWindow
         MoveWindow(
             windowId,       // identificador da janela
-            windowPosX,     // posio x
-            windowPosY,     // posio y
+            windowPosX,     // posição x
+            windowPosY,     // posição y
             fullWidth,      // largura
             fullHeight,     // altura
             TRUE);          // repintar
@@ -263,10 +279,10 @@ bool Window::Create()
     // captura contexto do dispositivo
     windowHdc = GetDC(windowId);
 
-    // pega tamanho da rea cliente
+    // pega tamanho da área cliente
     GetClientRect(windowId, &windowRect);
 
-    // retorna estado da inicializao (bem sucedida ou no)
+    // retorna estado da inicialização (bem sucedida ou não)
     return (windowId ? true : false);
 }
 
@@ -297,4 +313,20 @@ LRESULT CALLBACK Window::WinProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lPar
     return DefWindowProc(hWnd, msg, wParam, lParam);
 }
 
+#else
+
+bool Window::Create()
+{
+    // a superfície fora da tela não tem bordas: a área cliente é a janela inteira
+    styleWidth = 0;
+    styleHeight = 0;
+    fullWidth = windowWidth;
+    fullHeight = windowHeight;
+    fullAspectRatio = windowAspectRatio;
+    windowClosed = false;
+    return true;
+}
+
+#endif
+
 // -----------------------------------------------------------------------------
@@ -1,13 +1,13 @@
 /**********************************************************************************
-// App (Cdigo Fonte)
+// App (Código Fonte)
 //
-// Criao:     11 Jan 2020
-// Atualizao:	09 Jul 2023
+// Criação:     11 Jan 2020
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:   Uma classe abstrata para representar uma aplicao
-//              Todas as aplicaes derivadas da classe App devem
-//              sobrescrever os mtodos Init, Update e Finalize.
+// Descrição:   Uma classe abstrata para representar uma aplicação
+//              Todas as aplicações derivadas da classe App devem
+//              sobrescrever os métodos Init, Update e Finalize.
 //
 **********************************************************************************/
 
@@ -15,17 +15,19 @@
 #include "Engine.h"
 
 // -------------------------------------------------------------------------------
-// Inicializao de membros estticos da classe
+// Inicialização de membros estáticos da classe
 
-// As referncias fazem com que no seja necessrio verificar
+// As referências fazem com que não seja necessário verificar
 // se os ponteiros de Engine foram inicializados. Sendo uma
-// referncia, os atributos de App sero atualizados to logo
+// referência, os atributos de App serão atualizados tão logo
 // os atributos de Engine recebam valores
 
-Graphics*& App::graphics = Engine::graphics;    // componente grfico 
-Window*& App::window = Engine::window;          // janela da aplicao
+Graphics*& App::graphics = Engine::graphics;    // componente gráfico 
+Window*& App::window = Engine::window;          // janela da aplicação
 Input*& App::input = Engine::input;             // dispositivos de entrada
-double& App::frameTime = Engine::frameTime;     // tempo do ltimo quadro
+double& App::frameTime = Engine::frameTime;     // tempo do último quadro
+double& App::fixedTime = Engine::fixedTime;     // duração do passo fixo
+double& App::interpolation = Engine::interpolation; // fração do passo fixo
 
 // -------------------------------------------------------------------------------
 
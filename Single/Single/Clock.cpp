@@ -0,0 +1,57 @@
+/**********************************************************************************
+// Clock (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Isola o contador de alta precisão da plataforma. No Windows
+//              usa QueryPerformanceCounter e nas demais plataformas usa o
+//              relógio monotônico (clock_gettime), permitindo que Timer e
+//              o código da CPU compilem fora do Windows.
+//
+**********************************************************************************/
+
+#include "Clock.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// -------------------------------------------------------------------------------
+
+llong Clock::Counter()
+{
+#ifdef _WIN32
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+    return count.QuadPart;
+#else
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return llong(now.tv_sec) * 1000000000LL + now.tv_nsec;
+#endif
+}
+
+// -------------------------------------------------------------------------------
+
+llong Clock::Frequency()
+{
+#ifdef _WIN32
+    static llong freq = 0;
+    if (!freq)
+    {
+        LARGE_INTEGER value;
+        QueryPerformanceFrequency(&value);
+        freq = value.QuadPart;
+    }
+    return freq;
+#else
+    // clock_gettime conta nanossegundos
+    return 1000000000LL;
+#endif
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,269 @@
+/**********************************************************************************
+// HalfEdge (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Estrutura de semi-arestas para consultas de vizinhança em malhas
+//              de triângulos. A semi-aresta 3t+k é o k-ésimo lado do triângulo
+//              t, de modo que próxima, anterior, face e origem saem dos próprios
+//              índices; apenas a semi-aresta oposta e uma semi-aresta de saída
+//              por vértice são guardadas. A construção é linear no número de
+//              triângulos e o pareamento das semi-arestas roda em paralelo.
+//
+**********************************************************************************/
+
+#include "HalfEdge.h"
+#include "ThreadPool.h"
+#include "Profiler.h"
+#include <algorithm>
+
+// -------------------------------------------------------------------------------
+
+HalfEdgeMesh::HalfEdgeMesh() : boundary(0), nonManifold(0)
+{}
+
+// -------------------------------------------------------------------------------
+
+HalfEdgeMesh::HalfEdgeMesh(const Geometry & geometry) : boundary(0), nonManifold(0)
+{
+    Build(geometry);
+}
+
+// -------------------------------------------------------------------------------
+
+void HalfEdgeMesh::Build(const Geometry & geometry)
+{
+    PROFILE_SCOPE("HalfEdge");
+
+    // apenas o original: níveis de detalhe e grupos ficam de fora
+    uint count = geometry.OriginalCount() / 3 * 3;
+    uint vertCount = uint(geometry.vertices.size());
+
+    vertices = geometry.vertices;
+    origins.assign(geometry.indices.begin(), geometry.indices.begin() + count);
+    twins.assign(count, Invalid);
+    edges.assign(vertCount, Invalid);
+
+    // semi-arestas que saem de cada vértice (listas compactas)
+    vector<uint> offsets(size_t(vertCount) + 1, 0);
+    for (uint h = 0; h < count; ++h)
+        ++offsets[origins[h] + 1];
+    for (uint v = 0; v < vertCount; ++v)
+        offsets[v + 1] += offsets[v];
+
+    // destino de cada semi-aresta de saída ao lado dela, para varrer listas contíguas
+    vector<uint> outgoing(count);
+    vector<uint> targets(count);
+    vector<uint> fill(offsets.begin(), offsets.end() - 1);
+    for (uint h = 0; h < count; ++h)
+    {
+        uint i = fill[origins[h]]++;
+        outgoing[i] = h;
+        targets[i] = origins[Next(h)];
+    }
+
+    // listas longas (polos de esferas, centros de leques) são ordenadas pelo
+    // destino e consultadas por busca binária, sem varreduras quadráticas
+    const uint Scan = 16;
+    vector<uint64_t> keys;
+    for (uint v = 0; v < vertCount; ++v)
+    {
+        uint first = offsets[v];
+        uint last = offsets[v + 1];
+        if (last - first <= Scan)
+            continue;
+
+        keys.resize(last - first);
+        for (uint i = first; i < last; ++i)
+            keys[i - first] = uint64_t(targets[i]) << 32 | outgoing[i];
+        std::sort(keys.begin(), keys.end());
+        for (uint i = first; i < last; ++i)
+        {
+            targets[i] = uint(keys[i - first] >> 32);
+            outgoing[i] = uint(keys[i - first]);
+        }
+    }
+
+    // semi-arestas de v até target: a última encontrada e quantas são
+    auto find = [&](uint v, uint target, uint & found) -> uint
+    {
+        uint first = offsets[v];
+        uint last = offsets[v + 1];
+        uint h = Invalid;
+        found = 0;
+
+        if (last - first > Scan)
+        {
+            auto range = std::equal_range(targets.begin() + first, targets.begin() + last, target);
+            found = uint(range.second - range.first);
+            if (found)
+                h = outgoing[range.second - targets.begin() - 1];
+            return h;
+        }
+
+        for (uint i = first; i < last; ++i)
+        {
+            if (targets[i] == target)
+            {
+                h = outgoing[i];
+                ++found;
+            }
+        }
+        return h;
+    };
+
+    // a oposta de a->b é a única b->a; arestas repetidas ou com mais de
+    // dois triângulos ficam sem par, dos dois lados, e viram bordas
+    const uint Chunks = 64;
+    uint boundaries[Chunks] = {};
+    uint conflicts[Chunks] = {};
+
+    auto match = [&](uint chunk, uint first, uint last)
+    {
+        uint open = 0;
+        uint conflict = 0;
+
+        for (uint h = first; h < last; ++h)
+        {
+            uint a = origins[h];
+            uint b = origins[Next(h)];
+            uint back = 0;
+            uint same = 0;
+            uint twin = Invalid;
+
+            if (a != b)
+            {
+                twin = find(b, a, back);
+                find(a, b, same);
+            }
+
+            if (a == b || back > 1 || same > 1)
+            {
+                twin = Invalid;
+                ++conflict;
+            }
+
+            twins[h] = twin;
+            open += twin == Invalid;
+        }
+
+        // contadores somados por bloco, sem disputa entre threads
+        boundaries[chunk] += open;
+        conflicts[chunk] += conflict;
+    };
+
+    // semi-arestas de saída começam pela borda, para que Rotate percorra todo o leque
+    auto start = [&](uint first, uint last)
+    {
+        for (uint v = first; v < last; ++v)
+        {
+            for (uint i = offsets[v]; i < offsets[v + 1]; ++i)
+            {
+                edges[v] = outgoing[i];
+                if (twins[outgoing[i]] == Invalid)
+                    break;
+            }
+        }
+    };
+
+    // malhas grandes são pareadas em blocos paralelos
+    if (count >= (1u << 16))
+    {
+        ThreadPool & pool = ThreadPool::Shared();
+        pool.Run(Chunks, count, match);
+        pool.Run(Chunks, vertCount, [&](uint, uint first, uint last) { start(first, last); });
+    }
+    else
+    {
+        match(0, 0, count);
+        start(0, vertCount);
+    }
+
+    boundary = 0;
+    nonManifold = 0;
+    for (uint chunk = 0; chunk < Chunks; ++chunk)
+    {
+        boundary += boundaries[chunk];
+        nonManifold += conflicts[chunk];
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+Geometry HalfEdgeMesh::ToGeometry() const
+{
+    // a origem de cada semi-aresta é o índice de onde ela veio
+    Geometry geometry;
+    geometry.vertices = vertices;
+    geometry.indices = origins;
+    return geometry;
+}
+
+// -------------------------------------------------------------------------------
+
+uint HalfEdgeMesh::NextBoundary(uint h) const
+{
+    // gira em torno do destino até a semi-aresta de saída sem oposta
+    uint next = Next(h);
+    while (twins[next] != Invalid)
+    {
+        next = Next(twins[next]);
+        if (next == Next(h))
+            return Invalid;
+    }
+    return next;
+}
+
+// -------------------------------------------------------------------------------
+
+uint HalfEdgeMesh::Valence(uint v) const
+{
+    uint h = edges[v];
+    if (h == Invalid)
+        return 0;
+
+    // na borda, o último vizinho só é alcançado pela semi-aresta de chegada
+    uint valence = 0;
+    uint first = h;
+    do
+    {
+        ++valence;
+        uint next = Rotate(h);
+        if (next == Invalid)
+            return valence + 1;
+        h = next;
+    }
+    while (h != first);
+
+    return valence;
+}
+
+// -------------------------------------------------------------------------------
+
+void HalfEdgeMesh::Ring(uint v, vector<uint> & neighbors) const
+{
+    // onde vários leques se tocam no mesmo vértice, apenas o leque de Edge(v) é visitado
+    neighbors.clear();
+
+    uint h = edges[v];
+    if (h == Invalid)
+        return;
+
+    uint first = h;
+    do
+    {
+        neighbors.push_back(Target(h));
+        uint next = Rotate(h);
+        if (next == Invalid)
+        {
+            neighbors.push_back(Origin(Prev(h)));
+            return;
+        }
+        h = next;
+    }
+    while (h != first);
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,135 @@
+/**********************************************************************************
+// HalfEdge (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Estrutura de semi-arestas para consultas de vizinhança em malhas
+//              de triângulos. A semi-aresta 3t+k é o k-ésimo lado do triângulo
+//              t, de modo que próxima, anterior, face e origem saem dos próprios
+//              índices; apenas a semi-aresta oposta e uma semi-aresta de saída
+//              por vértice são guardadas. A construção é linear no número de
+//              triângulos e o pareamento das semi-arestas roda em paralelo.
+//
+**********************************************************************************/
+
+#ifndef DXUT_HALFEDGE_H_
+#define DXUT_HALFEDGE_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Geometry.h"
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+class HalfEdgeMesh
+{
+private:
+    vector<Vertex> vertices;                        // vértices da geometria
+    vector<uint> origins;                           // vértice de origem de cada semi-aresta
+    vector<uint> twins;                             // semi-aresta oposta (Invalid = borda)
+    vector<uint> edges;                             // semi-aresta de saída de cada vértice
+    uint boundary;                                  // semi-arestas sem oposta
+    uint nonManifold;                               // semi-arestas sem par único
+
+public:
+    static constexpr uint Invalid = 0xFFFFFFFF;     // semi-aresta ou vértice inexistente
+
+    HalfEdgeMesh();                                 // construtor
+    HalfEdgeMesh(const Geometry & geometry);        // constrói a partir do original
+
+    void Build(const Geometry & geometry);          // reconstrói a partir do original
+    Geometry ToGeometry() const;                    // vértices e triângulos de volta
+
+    uint VertexCount() const;                       // número de vértices
+    uint FaceCount() const;                         // número de triângulos
+    uint HalfEdgeCount() const;                     // número de semi-arestas
+    uint BoundaryCount() const;                     // semi-arestas sem oposta
+    uint NonManifoldCount() const;                  // semi-arestas sem par único
+
+    uint Origin(uint h) const;                      // vértice de onde a semi-aresta sai
+    uint Target(uint h) const;                      // vértice aonde a semi-aresta chega
+    uint Face(uint h) const;                        // triângulo da semi-aresta
+    uint Next(uint h) const;                        // próxima semi-aresta do triângulo
+    uint Prev(uint h) const;                        // semi-aresta anterior do triângulo
+    uint Twin(uint h) const;                        // semi-aresta oposta (Invalid = borda)
+    uint Edge(uint v) const;                        // semi-aresta que sai do vértice
+    bool Boundary(uint h) const;                    // semi-aresta na borda
+    bool BoundaryVertex(uint v) const;              // vértice na borda
+
+    uint Rotate(uint h) const;                      // próxima semi-aresta com a mesma origem
+    uint NextBoundary(uint h) const;                // próxima semi-aresta do contorno
+    uint Valence(uint v) const;                     // número de vizinhos do vértice
+    void Ring(uint v, vector<uint> & neighbors) const;  // vizinhos do vértice em ordem
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// número de vértices
+inline uint HalfEdgeMesh::VertexCount() const
+{ return uint(vertices.size()); }
+
+// número de triângulos
+inline uint HalfEdgeMesh::FaceCount() const
+{ return uint(origins.size() / 3); }
+
+// número de semi-arestas
+inline uint HalfEdgeMesh::HalfEdgeCount() const
+{ return uint(origins.size()); }
+
+// semi-arestas sem oposta
+inline uint HalfEdgeMesh::BoundaryCount() const
+{ return boundary; }
+
+// semi-arestas degeneradas ou compartilhadas por mais de dois triângulos
+inline uint HalfEdgeMesh::NonManifoldCount() const
+{ return nonManifold; }
+
+// vértice de onde a semi-aresta sai
+inline uint HalfEdgeMesh::Origin(uint h) const
+{ return origins[h]; }
+
+// vértice aonde a semi-aresta chega
+inline uint HalfEdgeMesh::Target(uint h) const
+{ return origins[Next(h)]; }
+
+// triângulo da semi-aresta
+inline uint HalfEdgeMesh::Face(uint h) const
+{ return h / 3; }
+
+// próxima semi-aresta do triângulo
+inline uint HalfEdgeMesh::Next(uint h) const
+{ return h % 3 == 2 ? h - 2 : h + 1; }
+
+// semi-aresta anterior do triângulo
+inline uint HalfEdgeMesh::Prev(uint h) const
+{ return h % 3 == 0 ? h + 2 : h - 1; }
+
+// semi-aresta oposta (Invalid = borda)
+inline uint HalfEdgeMesh::Twin(uint h) const
+{ return twins[h]; }
+
+// semi-aresta que sai do vértice (de borda, se houver; Invalid = vértice isolado)
+inline uint HalfEdgeMesh::Edge(uint v) const
+{ return edges[v]; }
+
+// semi-aresta sem triângulo do outro lado
+inline bool HalfEdgeMesh::Boundary(uint h) const
+{ return twins[h] == Invalid; }
+
+// vértice com uma semi-aresta de saída na borda
+inline bool HalfEdgeMesh::BoundaryVertex(uint v) const
+{ return edges[v] != Invalid && twins[edges[v]] == Invalid; }
+
+// gira em torno da origem (Invalid ao alcançar a borda)
+inline uint HalfEdgeMesh::Rotate(uint h) const
+{ return twins[Prev(h)]; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,96 @@
+/**********************************************************************************
+// Meshlet (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Descarte de grupos de triângulos na CPU. Cada grupo criado por
+//              Geometry::Clusterize é testado contra o volume de visão, pela
+//              esfera envolvente, e contra a posição da câmera, pelo cone das
+//              normais. Os grupos visíveis são emitidos como faixas contínuas
+//              de índices, unindo grupos vizinhos no buffer de índices.
+//
+**********************************************************************************/
+
+#include "Meshlet.h"
+#include <cmath>
+
+// -------------------------------------------------------------------------------
+
+MeshletCuller::MeshletCuller()
+{
+    tested = 0;
+    outside = 0;
+    backfacing = 0;
+}
+
+// -------------------------------------------------------------------------------
+
+uint MeshletCuller::Cull(const Geometry & geometry, const XMFLOAT4X4 & worldViewProj,
+                         const XMFLOAT3 & eye, vector<MeshletRange> & ranges)
+{
+    // planos do volume de visão no espaço do objeto: esquerda, direita,
+    // baixo, cima, perto e longe (a matriz está transposta, cada linha
+    // dá uma coordenada de recorte)
+    const XMFLOAT4X4 & m = worldViewProj;
+    float planes[6][4];
+    for (uint j = 0; j < 4; ++j)
+    {
+        planes[0][j] = m.m[3][j] + m.m[0][j];
+        planes[1][j] = m.m[3][j] - m.m[0][j];
+        planes[2][j] = m.m[3][j] + m.m[1][j];
+        planes[3][j] = m.m[3][j] - m.m[1][j];
+        planes[4][j] = m.m[2][j];
+        planes[5][j] = m.m[3][j] - m.m[2][j];
+    }
+
+    // normaliza para comparar distâncias com o raio
+    for (uint i = 0; i < 6; ++i)
+    {
+        float length = std::sqrt(planes[i][0] * planes[i][0] + planes[i][1] * planes[i][1] + planes[i][2] * planes[i][2]);
+        if (length > 0.0f)
+            for (uint j = 0; j < 4; ++j)
+                planes[i][j] /= length;
+    }
+
+    uint visible = 0;
+    for (const Meshlet & meshlet : geometry.meshlets)
+    {
+        uint triangles = meshlet.indexCount / 3;
+        tested += triangles;
+
+        const XMFLOAT3 & c = meshlet.center;
+        bool inside = true;
+        for (uint i = 0; i < 6 && inside; ++i)
+            inside = planes[i][0] * c.x + planes[i][1] * c.y + planes[i][2] * c.z + planes[i][3] >= -meshlet.radius;
+
+        if (!inside)
+        {
+            outside += triangles;
+            continue;
+        }
+
+        // todas as normais do cone apontam para longe da câmera
+        float dx = c.x - eye.x, dy = c.y - eye.y, dz = c.z - eye.z;
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const XMFLOAT3 & axis = meshlet.coneAxis;
+        if (dx * axis.x + dy * axis.y + dz * axis.z >= meshlet.coneCutoff * distance + meshlet.radius)
+        {
+            backfacing += triangles;
+            continue;
+        }
+
+        // grupos seguidos no buffer de índices formam uma só faixa
+        if (!ranges.empty() && ranges.back().startIndex + ranges.back().indexCount == meshlet.startIndex && visible > 0)
+            ranges.back().indexCount += meshlet.indexCount;
+        else
+            ranges.push_back({ meshlet.startIndex, meshlet.indexCount });
+
+        visible += triangles;
+    }
+
+    return visible;
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,204 @@
+/**********************************************************************************
+// NullGraphics (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Dispositivo gráfico nulo usado fora do Windows. Oferece a
+//              parte da interface de Graphics que o motor e as aplicações
+//              usam para desenhar: aceita os comandos gravados, copia seus
+//              argumentos, conta comandos e bytes e os descarta. Permite
+//              rodar Update e Draw de uma aplicação sem GPU e sem janela.
+//
+**********************************************************************************/
+
+#include "Graphics.h"
+#include "Clock.h"
+
+// ------------------------------------------------------------------------------
+
+Graphics::Graphics()
+{
+    workers         = nullptr;
+    recorderCount   = 0;
+    recorderPending = 0;
+    profiler        = nullptr;
+    presentTime     = 0.0;
+    frames          = 0;
+    commands        = 0;
+    bytes           = 0;
+}
+
+// ------------------------------------------------------------------------------
+
+Graphics::~Graphics()
+{
+    Profiler::Active(nullptr);
+    delete profiler;
+    delete workers;
+}
+
+// ------------------------------------------------------------------------------
+
+void Graphics::Initialize(Window * window)
+{
+    // viewport e retângulo de corte ocupam a janela inteira
+    viewport[0] = viewport[1] = 0.0f;
+    viewport[2] = float(window->Width());
+    viewport[3] = float(window->Height());
+    viewport[4] = 0.0f;
+    viewport[5] = 1.0f;
+    scissor[0] = scissor[1] = 0;
+    scissor[2] = int(window->Width());
+    scissor[3] = int(window->Height());
+
+    // uma lista de comandos por thread de gravação
+    workers = new ThreadPool();
+    recorderCount = workers->Size() < MaxRecorders ? workers->Size() : MaxRecorders;
+
+    // faixas da CPU medidas pelo motor e pelos escopos
+    profiler = new Profiler(Clock::Seconds);
+    Profiler::Active(profiler);
+}
+
+// ------------------------------------------------------------------------------
+
+void Graphics::Clear(const void * pso)
+{
+    // o quadro grava na lista principal até Present
+    AcquireCommands();
+    presentTime = 0.0;
+
+    // transição do backbuffer, limpeza dos alvos, viewport, corte e alvos
+    const float color[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    commandList.Command(uint(1), pso);
+    commandList.Command(color);
+    commandList.Command(1.0f, uint(0));
+    commandList.Command(viewport);
+    commandList.Command(scissor);
+    commandList.Command(uint(1), false);
+}
+
+// ------------------------------------------------------------------------------
+
+void Graphics::Record(uint drawCount, const RecordFunc & record)
+{
+    // cada lista precisa de desenhos suficientes para compensar seu custo
+    const uint MinDrawsPerRecorder = 256;
+
+    uint available = recorderCount - recorderPending;
+    uint chunks = drawCount / MinDrawsPerRecorder;
+    chunks = chunks < available ? chunks : available;
+
+    // poucos desenhos são gravados em uma única lista
+    if (chunks <= 1)
+    {
+        record(recorderPending ? &recorderList[recorderPending - 1] : &commandList, 0, drawCount);
+        return;
+    }
+
+    // divide os desenhos em blocos contíguos, um por lista de comandos
+    uint base = recorderPending;
+    workers->Run(chunks, drawCount, [&](uint chunk, uint first, uint last)
+    {
+        PROFILE_SCOPE("Record");
+        NullCommandList & cmdList = recorderList[base + chunk];
+
+        // viewport, corte e alvos de renderização de cada lista
+        cmdList.Reset();
+        cmdList.Command(viewport);
+        cmdList.Command(scissor);
+        cmdList.Command(uint(1), false);
+        record(&cmdList, first, last);
+    });
+
+    recorderPending += chunks;
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::AcquireCommands()
+{
+    // a mesma thread pode reiniciar a lista sem submeter antes
+    if (commandOwner.load() != std::this_thread::get_id())
+    {
+        commandLock.lock();
+        commandOwner = std::this_thread::get_id();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ReleaseCommands()
+{
+    if (commandOwner.load() == std::this_thread::get_id())
+    {
+        commandOwner = std::thread::id();
+        commandLock.unlock();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ResetCommands()
+{
+    AcquireCommands();
+    commandList.Reset();
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::SubmitCommands()
+{
+    ExecuteCommands();
+    ReleaseCommands();
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::ExecuteCommands()
+{
+    // soma a lista principal e as listas gravadas em paralelo
+    commands += commandList.Commands();
+    bytes += commandList.Bytes();
+    commandList.Reset();
+
+    for (uint i = 0; i < recorderPending; ++i)
+    {
+        commands += recorderList[i].Commands();
+        bytes += recorderList[i].Bytes();
+        recorderList[i].Reset();
+    }
+
+    recorderPending = 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Collect()
+{
+}
+
+// -----------------------------------------------------------------------------
+
+void Graphics::Present()
+{
+    PROFILE_SCOPE("Present");
+    llong presentStart = Clock::Counter();
+
+    // transição do backbuffer para apresentação
+    NullCommandList & last = recorderPending ? recorderList[recorderPending - 1] : commandList;
+    last.Command(uint(1), false);
+
+    ExecuteCommands();
+    profiler->NextFrame();
+    ++frames;
+
+    presentTime += double(Clock::Counter() - presentStart) / double(Clock::Frequency());
+
+    // a lista principal fica livre para outra thread
+    ReleaseCommands();
+}
+
+// -----------------------------------------------------------------------------
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Object (Arquivo de Cabealho)
+// Object (Arquivo de Cabeçalho)
 //
-// Criao:     14 Out 2022
-// Atualizao: 14 Set 2023
+// Criação:     14 Out 2022
+// Atualização: 14 Set 2023
 // Compilador:  Visual C++ 2022
 //
-// Descrio:   Define armazenamento para objeto de uma cena
+// Descrição:   Define armazenamento para objeto de uma cena
 //
 **********************************************************************************/
 
@@ -26,8 +26,8 @@ struct Object
         0.0f, 0.0f, 0.0f, 1.0f 
     };
 
-    uint cbIndex = -1;			    // ndice para o constant buffer
-    SubMesh submesh = {};			// informaes da sub-malha
+    uint cbIndex = -1;			    // índice para o constant buffer
+    SubMesh submesh = {};			// informações da sub-malha
 };
 
 #endif
@@ -0,0 +1,85 @@
+/**********************************************************************************
+// Occlusion (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Descarte por oclusão na CPU. Oclusores grandes são rasterizados
+//              com SSE2 em um buffer de profundidade de baixa resolução que
+//              guarda, em cada pixel, a profundidade mais distante que os
+//              oclusores podem ter ali. A caixa envolvente de cada objeto é
+//              projetada na tela e o objeto é descartado quando todo o seu
+//              retângulo está atrás dos oclusores.
+//
+**********************************************************************************/
+
+#ifndef DXUT_OCCLUSION_H_
+#define DXUT_OCCLUSION_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Rasterizer.h"
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+class Occlusion
+{
+private:
+    uint width;                                     // largura do buffer
+    uint height;                                    // altura do buffer
+    uint stride;                                    // pixels por linha (múltiplo de 4)
+    vector<float> depth;                            // profundidade mais distante dos oclusores
+    ullong tested;                                  // objetos testados desde o início
+    ullong culled;                                  // objetos descartados desde o início
+
+    // retângulo de tela (em pixels do buffer) e profundidade mais próxima de uma caixa
+    bool Project(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                 const XMFLOAT4X4 & worldViewProj, float rect[4], float & nearest) const;
+
+public:
+    Occlusion(uint width, uint height);             // construtor
+
+    void Clear();                                   // remove todos os oclusores
+    void Occluder(const RasterDraw & draw);         // rasteriza os triângulos de um oclusor
+
+    // fração da tela coberta pela caixa (seleção de oclusores)
+    float Coverage(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                   const XMFLOAT4X4 & worldViewProj) const;
+
+    // falso se a caixa está inteiramente atrás dos oclusores (caixas e
+    // oclusores usam a matriz combinada transposta, como em RasterDraw)
+    bool Visible(const XMFLOAT3 & center, const XMFLOAT3 & extents,
+                 const XMFLOAT4X4 & worldViewProj);
+
+    uint Width() const;                             // largura do buffer
+    uint Height() const;                            // altura do buffer
+    ullong Tested() const;                          // objetos testados desde o início
+    ullong Culled() const;                          // objetos descartados desde o início
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// largura do buffer de profundidade
+inline uint Occlusion::Width() const
+{ return width; }
+
+// altura do buffer de profundidade
+inline uint Occlusion::Height() const
+{ return height; }
+
+// objetos testados desde o início
+inline ullong Occlusion::Tested() const
+{ return tested; }
+
+// objetos descartados desde o início
+inline ullong Occlusion::Culled() const
+{ return culled; }
+
+// -------------------------------------------------------------------------------
+
+#endif
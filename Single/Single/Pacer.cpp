@@ -0,0 +1,226 @@
+/**********************************************************************************
+// Pacer (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Limita a taxa de quadros a um valor alvo. Dorme a maior parte
+//              do intervalo e completa a espera girando no relógio, com uma
+//              margem que se ajusta ao atraso medido do sistema operacional.
+//              No Windows o sono usa um temporizador de alta resolução ou,
+//              sem ele, Sleep com timeBeginPeriod(1): com o tick padrão de
+//              15.6 ms a margem chegaria ao período e a espera seria só giro.
+//              Relógio e espera podem ser substituídos para testes.
+//
+**********************************************************************************/
+
+#include "Pacer.h"
+#include "Clock.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+using std::vector;
+
+#ifdef _WIN32
+#include <windows.h>
+#include <mmsystem.h>                               // timeBeginPeriod (winmm.lib)
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#endif
+
+// -------------------------------------------------------------------------------
+
+static const double MinMargin = 0.0002;             // menor margem de giro (0.2 ms)
+
+// -------------------------------------------------------------------------------
+
+Pacer::Pacer(TimeSource source, SleepFunc sleeper)
+{
+    clock = source ? source : TimeSource(Clock::Seconds);
+    sleep = sleeper;
+    timer = nullptr;
+    coarse = false;
+
+    period = 0.0;
+    deadline = -1.0;
+    last = 0.0;
+    margin = 0.002;
+    overshoot = 0.001;
+    deviation = 0.00025;
+    count = 0;
+}
+
+// -------------------------------------------------------------------------------
+
+Pacer::~Pacer()
+{
+    Resolution(false);
+}
+
+// -------------------------------------------------------------------------------
+
+void Pacer::Resolution(bool fine)
+{
+#ifdef _WIN32
+    if (fine)
+    {
+        // Windows 10 1803 ou mais novo: temporizador com resolução de
+        // ~0.5 ms sem alterar o tick de todo o sistema
+        if (!timer)
+            timer = CreateWaitableTimerExW(nullptr, nullptr,
+                CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+
+        // versões anteriores: tick de 1 ms enquanto o ritmo estiver ativo
+        if (!timer && !coarse)
+            coarse = timeBeginPeriod(1) == TIMERR_NOERROR;
+    }
+    else
+    {
+        if (coarse)
+            timeEndPeriod(1);
+        if (timer)
+            CloseHandle(timer);
+
+        timer = nullptr;
+        coarse = false;
+    }
+#else
+    // demais sistemas já dormem com resolução de microssegundos
+    (void) fine;
+#endif
+}
+
+// -------------------------------------------------------------------------------
+
+void Pacer::SystemSleep(double secs)
+{
+#ifdef _WIN32
+    if (timer)
+    {
+        // prazo relativo em unidades de 100 ns
+        LARGE_INTEGER due;
+        due.QuadPart = -llong(secs * 1e7);
+        if (SetWaitableTimerEx(timer, &due, 0, nullptr, nullptr, nullptr, 0))
+        {
+            WaitForSingleObject(timer, INFINITE);
+            return;
+        }
+    }
+#endif
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(secs));
+}
+
+// -------------------------------------------------------------------------------
+
+const char * Pacer::Sleeper() const
+{
+    if (sleep)
+        return "substituída";
+    if (timer)
+        return "temporizador de alta resolução";
+    if (coarse)
+        return "Sleep com timeBeginPeriod(1)";
+    return "sono do sistema";
+}
+
+// -------------------------------------------------------------------------------
+
+void Pacer::Rate(double fps)
+{
+    period = fps > 0.0 ? 1.0 / fps : 0.0;
+
+    // resolução fina do sono só enquanto houver limite
+    if (!sleep)
+        Resolution(period > 0.0);
+
+    // recomeça o ritmo e as medições na próxima espera
+    deadline = -1.0;
+    count = 0;
+}
+
+// -------------------------------------------------------------------------------
+
+void Pacer::Wait()
+{
+    if (period <= 0.0)
+        return;
+
+    double now = clock();
+
+    // primeira espera apenas marca o início do ritmo
+    if (deadline < 0.0)
+    {
+        deadline = now + period;
+        last = now;
+        return;
+    }
+
+    // dorme até perto do prazo: o sono do sistema pode atrasar
+    double remaining = deadline - now;
+    if (remaining > margin)
+    {
+        double request = remaining - margin;
+        if (sleep)
+            sleep(request);
+        else
+            SystemSleep(request);
+
+        // atraso do sono além do pedido ajusta a margem
+        // (média e desvio médio móveis, como a estimativa de RTT do TCP)
+        double late = clock() - now - request;
+        overshoot += (late - overshoot) / 16.0;
+        deviation += (std::fabs(late - overshoot) - deviation) / 16.0;
+        margin = std::min(std::max(overshoot + 4.0 * deviation, MinMargin), period);
+    }
+
+    // completa a espera girando no relógio
+    double spinStart = clock();
+    while ((now = clock()) < deadline);
+
+    spins[count & (Capacity - 1)] = now - spinStart;
+    intervals[count++ & (Capacity - 1)] = now - last;
+    last = now;
+
+    // quadros atrasados mais de um período não são recuperados
+    deadline += period;
+    if (now > deadline)
+        deadline = now + period;
+}
+
+// -------------------------------------------------------------------------------
+
+PaceStats Pacer::Stats() const
+{
+    PaceStats stats = {};
+    stats.margin = margin;
+
+    uint n = uint(std::min<ullong>(count, Capacity));
+    if (n == 0 || period <= 0.0)
+        return stats;
+
+    // desvio de cada intervalo em relação ao período alvo
+    vector<double> deviations(n);
+    double spinning = 0.0;
+    for (uint i = 0; i < n; ++i)
+    {
+        deviations[i] = std::fabs(intervals[i] - period);
+        spinning += spins[i];
+    }
+
+    std::sort(deviations.begin(), deviations.end());
+
+    stats.frames = n;
+    stats.p50 = deviations[size_t(0.50 * (n - 1))];
+    stats.p99 = deviations[size_t(0.99 * (n - 1))];
+    stats.max = deviations.back();
+    stats.spin = spinning / n / period;
+    return stats;
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,98 @@
+/**********************************************************************************
+// Pacer (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Limita a taxa de quadros a um valor alvo. Dorme a maior parte
+//              do intervalo e completa a espera girando no relógio, com uma
+//              margem que se ajusta ao atraso medido do sistema operacional.
+//              No Windows o sono usa um temporizador de alta resolução ou,
+//              sem ele, Sleep com timeBeginPeriod(1): com o tick padrão de
+//              15.6 ms a margem chegaria ao período e a espera seria só giro.
+//              Relógio e espera podem ser substituídos para testes.
+//
+**********************************************************************************/
+
+#ifndef DXUT_PACER_H_
+#define DXUT_PACER_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <functional>
+using std::function;
+
+// -------------------------------------------------------------------------------
+
+// estatísticas do ritmo dos quadros recentes (em segundos)
+struct PaceStats
+{
+    uint   frames;                                  // intervalos considerados
+    double p50;                                     // desvio mediano do período alvo
+    double p99;                                     // desvio percentil 99 do período alvo
+    double max;                                     // maior desvio
+    double margin;                                  // margem de giro atual
+    double spin;                                    // fração do período gasta girando
+};
+
+// -------------------------------------------------------------------------------
+
+class Pacer
+{
+public:
+    using TimeSource = function<double()>;          // relógio em segundos
+    using SleepFunc = function<void(double)>;       // dorme por alguns segundos
+
+private:
+    static const uint Capacity = 256;               // intervalos guardados (potência de 2)
+
+    TimeSource clock;                               // fonte de tempo
+    SleepFunc sleep;                                // espera do sistema
+    double period;                                  // intervalo alvo (0 = sem limite)
+    double deadline;                                // fim do quadro atual
+    double last;                                    // instante de saída da última espera
+    double margin;                                  // parte final da espera feita girando
+    double overshoot;                               // atraso médio do sono
+    double deviation;                               // desvio médio do atraso do sono
+    double intervals[Capacity];                     // intervalos entre quadros recentes
+    double spins[Capacity];                         // giro no fim de cada intervalo
+    ullong count;                                   // intervalos gravados
+
+    void * timer;                                   // temporizador de alta resolução (Windows)
+    bool   coarse;                                  // timeBeginPeriod(1) ativo (Windows)
+
+    void SystemSleep(double secs);                  // sono do sistema com a melhor resolução disponível
+    void Resolution(bool fine);                     // pede ou devolve a resolução fina do sistema
+
+public:
+    Pacer(TimeSource source = nullptr,
+          SleepFunc sleeper = nullptr);             // construtor (nullptr = relógio e sono do sistema)
+    ~Pacer();                                       // destrutor
+
+    Pacer(const Pacer &) = delete;                  // guarda recursos do sistema
+    Pacer & operator=(const Pacer &) = delete;
+
+    void Rate(double fps);                          // define taxa alvo (0 = sem limite)
+    double Rate() const;                            // retorna taxa alvo
+    double Margin() const;                          // margem de giro atual
+    const char * Sleeper() const;                   // espera usada pelo ritmo
+    void Wait();                                    // espera até o fim do quadro atual
+    PaceStats Stats() const;                        // desvios dos intervalos recentes
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// retorna taxa alvo em quadros por segundo (0 = sem limite)
+inline double Pacer::Rate() const
+{ return period > 0.0 ? 1.0 / period : 0.0; }
+
+// margem de giro atual em segundos
+inline double Pacer::Margin() const
+{ return margin; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,136 @@
+/**********************************************************************************
+// PipelineCache (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Guarda em disco blobs binários (pipelines compilados e
+//              assinaturas raiz serializadas) identificados por uma chave
+//              de 64 bits. Não depende do Direct3D: a chave é calculada
+//              por quem usa o cache a partir do conteúdo das descrições.
+//
+**********************************************************************************/
+
+#include "PipelineCache.h"
+#include <fstream>
+#include <cstdio>
+#include <filesystem>
+using std::ifstream;
+using std::ofstream;
+using std::ios;
+
+// -------------------------------------------------------------------------------
+
+PipelineCache::PipelineCache(const string & dir)
+{
+    directory = dir;
+    hits = 0;
+    misses = 0;
+
+    // cria a pasta do cache se ela ainda não existir
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+}
+
+// -------------------------------------------------------------------------------
+
+ullong PipelineCache::Hash(const void * data, size_t size, ullong seed)
+{
+    const byte * bytes = static_cast<const byte*>(data);
+    ullong hash = seed;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// -------------------------------------------------------------------------------
+
+string PipelineCache::FileName(ullong key, const string & ext) const
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.", key);
+    return directory + "/" + name + ext;
+}
+
+// -------------------------------------------------------------------------------
+
+bool PipelineCache::Load(ullong key, const string & ext, vector<byte> & blob)
+{
+    string name = FileName(key, ext);
+    ifstream fin(name, ios::in | ios::binary);
+
+    Header header = {};
+    if (!fin || !fin.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    {
+        ++misses;
+        return false;
+    }
+
+    // rejeita arquivos de outro formato, de outra versão ou de outra chave,
+    // e tamanhos maiores que o arquivo (cabeçalho corrompido)
+    std::error_code ec;
+    ullong fileSize = std::filesystem::file_size(name, ec);
+    if (header.magic != Magic || header.version != Version || header.key != key
+        || ec || header.size > fileSize - sizeof(header))
+    {
+        blob.clear();
+        ++misses;
+        return false;
+    }
+
+    blob.resize(size_t(header.size));
+    if (!fin.read(reinterpret_cast<char*>(blob.data()), std::streamsize(header.size))
+        || Hash(blob.data(), blob.size()) != header.checksum)
+    {
+        // arquivo truncado ou corrompido
+        blob.clear();
+        ++misses;
+        return false;
+    }
+
+    ++hits;
+    return true;
+}
+
+// -------------------------------------------------------------------------------
+
+bool PipelineCache::Store(ullong key, const string & ext, const void * data, size_t size)
+{
+    // grava em arquivo temporário e renomeia no final, para que
+    // uma interrupção nunca deixe um arquivo parcial no cache
+    string name = FileName(key, ext);
+    string temp = name + ".tmp";
+
+    {
+        ofstream fout(temp, ios::out | ios::binary | ios::trunc);
+        if (!fout)
+            return false;
+
+        Header header = { Magic, Version, key, size, Hash(data, size) };
+        fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        fout.write(static_cast<const char*>(data), std::streamsize(size));
+
+        if (!fout)
+            return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(temp, name, ec);
+    return !ec;
+}
+
+// -------------------------------------------------------------------------------
+
+void PipelineCache::Invalidate(ullong key, const string & ext)
+{
+    std::error_code ec;
+    std::filesystem::remove(FileName(key, ext), ec);
+}
+
+// -------------------------------------------------------------------------------
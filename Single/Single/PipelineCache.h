@@ -0,0 +1,77 @@
+/**********************************************************************************
+// PipelineCache (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Guarda em disco blobs binários (pipelines compilados e
+//              assinaturas raiz serializadas) identificados por uma chave
+//              de 64 bits. Não depende do Direct3D: a chave é calculada
+//              por quem usa o cache a partir do conteúdo das descrições.
+//
+**********************************************************************************/
+
+#ifndef DXUT_PIPELINECACHE_H_
+#define DXUT_PIPELINECACHE_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+class PipelineCache
+{
+private:
+    // cabeçalho gravado no início de cada arquivo do cache
+    struct Header
+    {
+        uint   magic;                                   // identifica arquivo do cache
+        uint   version;                                 // versão do formato
+        ullong key;                                     // chave do conteúdo
+        ullong size;                                    // tamanho do conteúdo em bytes
+        ullong checksum;                                // hash do conteúdo
+    };
+
+    static const uint Magic = 0x43505844;               // "DXPC"
+    static const uint Version = 1;                      // versão atual do formato
+
+    string directory;                                   // pasta dos arquivos do cache
+    uint hits;                                          // blobs encontrados no cache
+    uint misses;                                        // blobs ausentes ou inválidos
+
+    string FileName(ullong key, const string & ext) const;  // arquivo associado à chave
+
+public:
+    PipelineCache(const string & dir = "Cache");        // construtor
+
+    // acumula bytes em um hash FNV-1a de 64 bits
+    static ullong Hash(const void * data, size_t size, ullong seed = 14695981039346656037ULL);
+
+    bool Load(ullong key, const string & ext, vector<byte> & blob);             // lê blob (falso se inválido)
+    bool Store(ullong key, const string & ext, const void * data, size_t size); // grava blob
+    void Invalidate(ullong key, const string & ext);                            // descarta blob
+
+    uint Hits() const;                                  // retorna acertos no cache
+    uint Misses() const;                                // retorna falhas no cache
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// retorna número de blobs encontrados no cache
+inline uint PipelineCache::Hits() const
+{ return hits; }
+
+// retorna número de blobs ausentes ou inválidos
+inline uint PipelineCache::Misses() const
+{ return misses; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,180 @@
+/**********************************************************************************
+// Profiler (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Registra faixas de tempo nomeadas da CPU e da GPU em uma
+//              única linha do tempo (segundos desde a criação do profiler).
+//              Guarda as faixas mais recentes, responde consultas e exporta
+//              no formato de trace do Chrome (chrome://tracing). Não depende
+//              do Direct3D: os tempos da GPU chegam já convertidos.
+//
+//              PROFILE_SCOPE("nome") mede o bloco atual em um buffer da
+//              thread; definir DXUT_NO_PROFILE remove todas as medições.
+//
+**********************************************************************************/
+
+#ifndef DXUT_PROFILER_H_
+#define DXUT_PROFILER_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <string>
+#include <vector>
+#include <mutex>
+#include <functional>
+#include <atomic>
+using std::string;
+using std::vector;
+using std::mutex;
+using std::function;
+using std::atomic;
+
+// -------------------------------------------------------------------------------
+
+enum ProfileTrack { CPU_TRACK, GPU_TRACK };
+
+// faixa de tempo medida
+struct ProfileRange
+{
+    string name;                                    // nome da faixa
+    uint   track;                                   // CPU_TRACK ou GPU_TRACK
+    uint   thread;                                  // thread da CPU (0 = primeira a medir)
+    uint   depth;                                   // aninhamento dentro da thread
+    ullong frame;                                   // quadro em que foi gravada
+    double start;                                   // início em segundos
+    double end;                                     // fim em segundos
+
+    bool   hasStats;                                // estatísticas do pipeline válidas
+    ullong vertices;                                // vértices lidos pelo input assembler
+    ullong primitives;                              // primitivas enviadas ao rasterizador
+    ullong pixels;                                  // invocações do pixel shader
+
+    double Duration() const { return end - start; } // duração em segundos
+};
+
+// marca de início de uma faixa da CPU
+struct ProfileMark
+{
+    const char * name;                              // nome da faixa
+    double start;                                   // início em segundos
+};
+
+// -------------------------------------------------------------------------------
+
+class Profiler
+{
+public:
+    using TimeSource = function<double()>;          // relógio em segundos
+
+private:
+    static const uint MaxRanges = 4096;             // faixas mantidas no histórico
+
+    vector<ProfileRange> ranges;                    // histórico circular
+    uint head;                                      // posição da próxima faixa
+    uint count;                                     // faixas no histórico
+    atomic<ullong> frame;                           // quadro atual (avançado pela thread de desenho)
+    TimeSource clock;                               // fonte de tempo da CPU
+    double origin;                                  // início da linha do tempo
+    mutable mutex lock;                             // protege o histórico
+
+    static Profiler * active;                       // profiler usado pelos escopos
+
+public:
+    Profiler(TimeSource source = nullptr);          // construtor (nullptr = relógio padrão)
+
+    double Now() const;                             // tempo atual na linha do tempo
+    double Origin() const;                          // valor do relógio no início da linha do tempo
+    void NextFrame();                               // avança o contador de quadros
+    ullong Frame() const;                           // retorna quadro atual
+
+    ProfileMark BeginCpu(const char * name) const;  // inicia faixa da CPU
+    void EndCpu(const ProfileMark & mark);          // encerra faixa da CPU
+    void Add(const ProfileRange & range);           // adiciona faixa já medida
+    void Add(const vector<ProfileRange> & batch);   // adiciona faixas de uma só vez
+
+    // converte timestamp da GPU para a linha do tempo a partir de uma
+    // calibração (gpuStamp lido no mesmo instante que cpuTime)
+    static double GpuTime(ullong stamp, ullong gpuStamp, ullong gpuFrequency, double cpuTime);
+
+    static void Active(Profiler * profiler);        // define profiler usado pelos escopos
+    static Profiler * Active();                     // retorna profiler usado pelos escopos
+
+    uint Count() const;                             // faixas no histórico
+    ProfileRange Range(uint index) const;           // faixa (0 = mais antiga)
+    bool Last(const string & name, ProfileRange & range) const; // faixa mais recente com o nome
+    double Average(const string & name) const;      // duração média das faixas com o nome
+    void Clear();                                   // esvazia o histórico
+
+    string ChromeTrace() const;                     // histórico no formato de trace do Chrome
+    bool Export(const string & fileName) const;     // grava trace em arquivo
+};
+
+// -------------------------------------------------------------------------------
+
+// mede o tempo de vida do objeto como uma faixa da CPU
+class ProfileScope
+{
+private:
+    const char * name;                              // nome da faixa
+    Profiler * profiler;                            // profiler ativo no início
+    double start;                                   // início em segundos
+
+public:
+    ProfileScope(const char * name);                // inicia faixa
+    ~ProfileScope();                                // encerra faixa e guarda no buffer da thread
+};
+
+// -------------------------------------------------------------------------------
+
+#define DXUT_PROFILE_JOIN(a, b) a##b
+#define DXUT_PROFILE_NAME(a, b) DXUT_PROFILE_JOIN(a, b)
+
+#ifdef DXUT_NO_PROFILE
+#define PROFILE_SCOPE(name) ((void)0)
+#else
+#define PROFILE_SCOPE(name) ProfileScope DXUT_PROFILE_NAME(profileScope, __LINE__)(name)
+#endif
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// tempo atual em segundos desde a criação do profiler
+inline double Profiler::Now() const
+{ return clock() - origin; }
+
+// valor do relógio no início da linha do tempo
+inline double Profiler::Origin() const
+{ return origin; }
+
+// avança o contador de quadros
+inline void Profiler::NextFrame()
+{ ++frame; }
+
+// retorna quadro atual
+inline ullong Profiler::Frame() const
+{ return frame; }
+
+// inicia uma faixa da CPU
+inline ProfileMark Profiler::BeginCpu(const char * name) const
+{ return { name, Now() }; }
+
+// a diferença é feita em inteiros: timestamps grandes perdem
+// precisão quando convertidos para double antes da subtração
+inline double Profiler::GpuTime(ullong stamp, ullong gpuStamp, ullong gpuFrequency, double cpuTime)
+{ return cpuTime + double(llong(stamp - gpuStamp)) / double(gpuFrequency); }
+
+// define profiler usado pelos escopos (nullptr = escopos ignorados)
+inline void Profiler::Active(Profiler * profiler)
+{ active = profiler; }
+
+// retorna profiler usado pelos escopos
+inline Profiler * Profiler::Active()
+{ return active; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,529 @@
+/**********************************************************************************
+// Rasterizer (Código Fonte)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Rasterizador por software para execuções sem GPU. Recebe os
+//              mesmos vértices, sub-malhas e matrizes combinadas usados pelo
+//              pipeline gráfico, distribui os triângulos em blocos de tela e
+//              rasteriza os blocos em paralelo com funções de aresta SSE2,
+//              teste de profundidade e preenchimento sólido ou em arame.
+//              A imagem final pode ser gravada em PNG ou PPM.
+//
+**********************************************************************************/
+
+#include "Rasterizer.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <emmintrin.h>
+using std::ofstream;
+
+// -------------------------------------------------------------------------------
+
+static const float SubPixel = 16.0f;                // precisão das posições na tela (1/16 de pixel)
+
+// converte cor em ponto flutuante para RGBA de 8 bits
+static uint Pack(float r, float g, float b, float a)
+{
+    auto channel = [](float c) { return uint(std::min(std::max(c, 0.0f), 1.0f) * 255.0f + 0.5f); };
+    return channel(r) | channel(g) << 8 | channel(b) << 16 | channel(a) << 24;
+}
+
+// -------------------------------------------------------------------------------
+
+Rasterizer::Rasterizer(uint width, uint height, uint threads) : pool(threads)
+{
+    this->width = width;
+    this->height = height;
+    tilesX = (width + TileSize - 1) / TileSize;
+    tilesY = (height + TileSize - 1) / TileSize;
+    fill = RASTER_SOLID;
+    cull = true;
+    triangles = 0;
+
+    // linhas com múltiplos de 4 pixels: grupos SSE nunca passam do fim
+    stride = (width + 3) & ~3u;
+    color.resize(size_t(stride) * height);
+    depth.resize(size_t(stride) * height);
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Clear(float r, float g, float b)
+{
+    std::fill(color.begin(), color.end(), Pack(r, g, b, 1.0f));
+    std::fill(depth.begin(), depth.end(), 1.0f);
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Draw(const RasterDraw & draw)
+{
+    // o desenho só guarda ponteiros: os dados devem viver até Finish
+    if (draw.indexCount >= 3)
+        draws.push_back(draw);
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Setup(const RasterDraw & draw, uint triangle, Batch & batch)
+{
+    const uint * index = draw.indices + draw.startIndex + triangle * 3;
+    const XMFLOAT4X4 & m = draw.worldViewProj;
+
+    // posição em espaço de recorte (x, y, z, w) seguida da cor
+    float clip[3][8];
+    for (uint i = 0; i < 3; ++i)
+    {
+        const Vertex & v = draw.vertices[index[i] + draw.baseVertex];
+
+        // a matriz está transposta, como o vertex shader a recebe
+        for (uint r = 0; r < 4; ++r)
+            clip[i][r] = m.m[r][0] * v.pos.x + m.m[r][1] * v.pos.y + m.m[r][2] * v.pos.z + m.m[r][3];
+
+        clip[i][4] = v.color.x;
+        clip[i][5] = v.color.y;
+        clip[i][6] = v.color.z;
+        clip[i][7] = v.color.w;
+    }
+
+    // descarta triângulos inteiramente fora de um dos planos do volume de visão
+    auto outside = [&](auto test) { return test(clip[0]) && test(clip[1]) && test(clip[2]); };
+    if (outside([](const float * v) { return v[0] > v[3]; }) ||
+        outside([](const float * v) { return v[0] < -v[3]; }) ||
+        outside([](const float * v) { return v[1] > v[3]; }) ||
+        outside([](const float * v) { return v[1] < -v[3]; }) ||
+        outside([](const float * v) { return v[2] > v[3]; }) ||
+        outside([](const float * v) { return v[2] < 0.0f; }))
+        return;
+
+    // todos na frente do plano próximo: dispensa o recorte
+    if (clip[0][2] >= 0.0f && clip[1][2] >= 0.0f && clip[2][2] >= 0.0f)
+    {
+        Emit(clip[0], clip[1], clip[2], batch);
+        return;
+    }
+
+    // recorta contra o plano próximo (z = 0): até 4 vértices
+    float poly[4][8];
+    uint count = 0;
+
+    for (uint i = 0; i < 3; ++i)
+    {
+        const float * a = clip[i];
+        const float * b = clip[(i + 1) % 3];
+
+        if (a[2] >= 0.0f)
+            std::copy(a, a + 8, poly[count++]);
+
+        // aresta cruza o plano: acrescenta a interseção
+        if ((a[2] >= 0.0f) != (b[2] >= 0.0f))
+        {
+            float t = a[2] / (a[2] - b[2]);
+            for (uint c = 0; c < 8; ++c)
+                poly[count][c] = a[c] + t * (b[c] - a[c]);
+            ++count;
+        }
+    }
+
+    // polígono recortado vira um leque de triângulos
+    for (uint i = 2; i < count; ++i)
+        Emit(poly[0], poly[i - 1], poly[i], batch);
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Emit(const float * v0, const float * v1, const float * v2, Batch & batch)
+{
+    const float * v[3] = { v0, v1, v2 };
+    float x[3], y[3], z[3], w[3];
+
+    // divisão perspectiva e mapeamento para a tela (y para baixo)
+    for (uint i = 0; i < 3; ++i)
+    {
+        w[i] = 1.0f / v[i][3];
+        if (!std::isfinite(w[i]))
+            return;
+
+        // posições arredondadas para a grade de subpixels: diferenças
+        // entre elas são exatas e vizinhos avaliam a mesma aresta
+        x[i] = std::floor((v[i][0] * w[i] * 0.5f + 0.5f) * width * SubPixel + 0.5f) / SubPixel;
+        y[i] = std::floor((0.5f - v[i][1] * w[i] * 0.5f) * height * SubPixel + 0.5f) / SubPixel;
+        z[i] = v[i][2] * w[i];
+    }
+
+    // dobro da área com sinal: positiva para sentido horário na tela (frente)
+    float area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0.0f || (cull && area < 0.0f))
+        return;
+
+    // triângulos de costas desenhados trocam a ordem de dois vértices
+    uint order[3] = { 0, 1, 2 };
+    if (area < 0.0f)
+    {
+        std::swap(order[1], order[2]);
+        area = -area;
+    }
+
+    // retângulo envolvente dos centros de pixels cobertos
+    float left = std::min({ x[0], x[1], x[2] });
+    float right = std::max({ x[0], x[1], x[2] });
+    float top = std::min({ y[0], y[1], y[2] });
+    float bottom = std::max({ y[0], y[1], y[2] });
+
+    Triangle tri;
+    tri.minX = int(std::max(std::ceil(left - 0.5f), 0.0f));
+    tri.minY = int(std::max(std::ceil(top - 0.5f), 0.0f));
+    tri.maxX = int(std::min(std::floor(right - 0.5f), float(width) - 1.0f));
+    tri.maxY = int(std::min(std::floor(bottom - 0.5f), float(height) - 1.0f));
+
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY)
+        return;
+
+    for (uint i = 0; i < 3; ++i)
+    {
+        uint s = order[i];
+        uint j = order[(i + 1) % 3];
+        uint k = order[(i + 2) % 3];
+
+        // aresta de j para k: positiva do lado interno
+        tri.a[i] = y[j] - y[k];
+        tri.b[i] = x[k] - x[j];
+
+        // origem no extremo de menor (y, x): o vizinho que compartilha a
+        // aresta calcula exatamente o valor oposto em cada pixel
+        bool first = y[j] < y[k] || (y[j] == y[k] && x[j] < x[k]);
+        tri.ox[i] = first ? x[j] : x[k];
+        tri.oy[i] = first ? y[j] : y[k];
+
+        // regra superior-esquerda: pixels sobre a aresta ficam com um só triângulo
+        tri.topLeft[i] = (tri.a[i] > 0.0f || (tri.a[i] == 0.0f && tri.b[i] > 0.0f)) ? ~0 : 0;
+        tri.invLength[i] = 1.0f / std::sqrt(tri.a[i] * tri.a[i] + tri.b[i] * tri.b[i]);
+
+        // atributos divididos por w são lineares na tela
+        tri.z[i] = z[s];
+        tri.w[i] = w[s];
+        for (uint c = 0; c < 4; ++c)
+            tri.color[i][c] = v[s][4 + c] * w[s];
+    }
+
+    tri.invArea = 1.0f / area;
+
+    // distribui o triângulo nos blocos de tela que ele toca
+    uint index = uint(batch.triangles.size());
+    batch.triangles.push_back(tri);
+
+    for (int ty = tri.minY / int(TileSize); ty <= tri.maxY / int(TileSize); ++ty)
+        for (int tx = tri.minX / int(TileSize); tx <= tri.maxX / int(TileSize); ++tx)
+            batch.bins[ty * tilesX + tx].push_back(index);
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Raster(uint tile)
+{
+    int tileX = int(tile % tilesX * TileSize);
+    int tileY = int(tile / tilesX * TileSize);
+    int tileRight = std::min(tileX + int(TileSize), int(width)) - 1;
+    int tileBottom = std::min(tileY + int(TileSize), int(height)) - 1;
+
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128 lanes = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const bool wireframe = fill == RASTER_WIREFRAME;
+
+    // lotes em ordem de preparação preservam a ordem de submissão
+    for (const Batch & batch : batches)
+    {
+        for (uint index : batch.bins[tile])
+        {
+            const Triangle & tri = batch.triangles[index];
+
+            int minX = std::max(tri.minX, tileX) & ~3;
+            int maxX = std::min(tri.maxX, tileRight);
+            int minY = std::max(tri.minY, tileY);
+            int maxY = std::min(tri.maxY, tileBottom);
+
+            __m128 a[3], ox[3], topLeft[3], invLength[3];
+            for (uint i = 0; i < 3; ++i)
+            {
+                a[i] = _mm_set1_ps(tri.a[i]);
+                ox[i] = _mm_set1_ps(tri.ox[i]);
+                topLeft[i] = _mm_castsi128_ps(_mm_set1_epi32(tri.topLeft[i]));
+                invLength[i] = _mm_set1_ps(tri.invLength[i]);
+            }
+
+            // atributos como planos: f = f0 + l1 * (f1 - f0) + l2 * (f2 - f0)
+            float planes[6][3] =
+            {
+                { tri.z[0], tri.z[1] - tri.z[0], tri.z[2] - tri.z[0] },
+                { tri.w[0], tri.w[1] - tri.w[0], tri.w[2] - tri.w[0] },
+            };
+            for (uint c = 0; c < 4; ++c)
+            {
+                planes[2 + c][0] = tri.color[0][c];
+                planes[2 + c][1] = tri.color[1][c] - tri.color[0][c];
+                planes[2 + c][2] = tri.color[2][c] - tri.color[0][c];
+            }
+
+            __m128 base[6], d1[6], d2[6];
+            for (uint p = 0; p < 6; ++p)
+            {
+                base[p] = _mm_set1_ps(planes[p][0]);
+                d1[p] = _mm_set1_ps(planes[p][1]);
+                d2[p] = _mm_set1_ps(planes[p][2]);
+            }
+
+            __m128 invArea = _mm_set1_ps(tri.invArea);
+
+            for (int y = minY; y <= maxY; ++y)
+            {
+                // parte da aresta que só depende da linha
+                float py = float(y) + 0.5f;
+                __m128 row[3];
+                for (uint i = 0; i < 3; ++i)
+                    row[i] = _mm_set1_ps(tri.b[i] * (py - tri.oy[i]));
+
+                uint * colorRow = &color[size_t(y) * stride];
+                float * depthRow = &depth[size_t(y) * stride];
+
+                for (int x = minX; x <= maxX; x += 4)
+                {
+                    __m128 px = _mm_add_ps(_mm_set1_ps(float(x)), lanes);
+
+                    // funções de aresta dos 4 pixels
+                    __m128 e[3];
+                    __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                    for (uint i = 0; i < 3; ++i)
+                    {
+                        e[i] = _mm_add_ps(_mm_mul_ps(a[i], _mm_sub_ps(px, ox[i])), row[i]);
+                        __m128 inside = _mm_or_ps(_mm_cmpgt_ps(e[i], zero),
+                            _mm_and_ps(_mm_cmpeq_ps(e[i], zero), topLeft[i]));
+                        mask = _mm_and_ps(mask, inside);
+                    }
+
+                    if (!_mm_movemask_ps(mask))
+                        continue;
+
+                    // em arame ficam só os pixels a menos de 1 pixel de uma aresta
+                    if (wireframe)
+                    {
+                        __m128 distance = _mm_min_ps(_mm_mul_ps(e[0], invLength[0]),
+                            _mm_min_ps(_mm_mul_ps(e[1], invLength[1]), _mm_mul_ps(e[2], invLength[2])));
+                        mask = _mm_and_ps(mask, _mm_cmplt_ps(distance, one));
+                    }
+
+                    // coordenadas baricêntricas dos vértices 1 e 2
+                    __m128 l1 = _mm_mul_ps(e[1], invArea);
+                    __m128 l2 = _mm_mul_ps(e[2], invArea);
+                    auto plane = [&](uint p)
+                    { return _mm_add_ps(base[p], _mm_add_ps(_mm_mul_ps(l1, d1[p]), _mm_mul_ps(l2, d2[p]))); };
+
+                    // teste de profundidade (menor passa) dentro de [0, 1]
+                    __m128 z = plane(0);
+                    __m128 stored = _mm_loadu_ps(depthRow + x);
+                    mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmplt_ps(z, stored),
+                        _mm_and_ps(_mm_cmpge_ps(z, zero), _mm_cmple_ps(z, one))));
+
+                    if (!_mm_movemask_ps(mask))
+                        continue;
+
+                    _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, stored)));
+
+                    // cor com correção de perspectiva
+                    __m128 w = _mm_div_ps(scale, plane(1));
+                    __m128i r = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(plane(2), w), zero), scale));
+                    __m128i g = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(plane(3), w), zero), scale));
+                    __m128i b = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(plane(4), w), zero), scale));
+                    __m128i al = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(_mm_mul_ps(plane(5), w), zero), scale));
+
+                    __m128i pixels = _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                        _mm_or_si128(_mm_slli_epi32(b, 16), _mm_slli_epi32(al, 24)));
+
+                    __m128i keep = _mm_castps_si128(mask);
+                    __m128i old = _mm_loadu_si128((const __m128i *) (colorRow + x));
+                    _mm_storeu_si128((__m128i *) (colorRow + x),
+                        _mm_or_si128(_mm_and_si128(keep, pixels), _mm_andnot_si128(keep, old)));
+                }
+            }
+        }
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+void Rasterizer::Finish()
+{
+    if (draws.empty())
+        return;
+
+    // primeiro triângulo global de cada desenho
+    firsts.resize(draws.size() + 1);
+    firsts[0] = 0;
+    for (uint i = 0; i < draws.size(); ++i)
+        firsts[i + 1] = firsts[i] + draws[i].indexCount / 3;
+
+    uint total = firsts.back();
+    uint tiles = tilesX * tilesY;
+
+    // alguns lotes por thread equilibram triângulos de custos diferentes
+    uint chunks = std::max(1u, std::min(pool.Size() * 4, total / 64));
+    batches.resize(chunks);
+
+    // transforma, recorta e distribui os triângulos em paralelo
+    pool.Run(chunks, total, [&](uint chunk, uint first, uint last)
+    {
+        Batch & batch = batches[chunk];
+        batch.triangles.clear();
+        batch.bins.resize(tiles);
+        for (vector<uint> & bin : batch.bins)
+            bin.clear();
+
+        if (first == last)
+            return;
+
+        // desenho que contém o primeiro triângulo do lote
+        uint d = uint(std::upper_bound(firsts.begin(), firsts.end(), first) - firsts.begin()) - 1;
+
+        for (uint t = first; t < last; ++t)
+        {
+            while (t >= firsts[d + 1])
+                ++d;
+            Setup(draws[d], t - firsts[d], batch);
+        }
+    });
+
+    // blocos de tela são independentes: cada thread pega o próximo livre
+    pool.Run(tiles, tiles, [&](uint, uint first, uint last)
+    {
+        for (uint tile = first; tile < last; ++tile)
+            Raster(tile);
+    });
+
+    for (const Batch & batch : batches)
+        triangles += batch.triangles.size();
+
+    draws.clear();
+}
+
+// -------------------------------------------------------------------------------
+
+bool Rasterizer::Save(const string & fileName) const
+{
+    ofstream fout(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!fout)
+        return false;
+
+    // linhas RGB sem o canal alfa
+    auto rgb = [&](uint y, char * out)
+    {
+        for (uint x = 0; x < width; ++x)
+        {
+            uint pixel = Pixel(x, y);
+            out[x * 3 + 0] = char(pixel & 0xff);
+            out[x * 3 + 1] = char(pixel >> 8 & 0xff);
+            out[x * 3 + 2] = char(pixel >> 16 & 0xff);
+        }
+    };
+
+    bool ppm = fileName.size() >= 4 && fileName.compare(fileName.size() - 4, 4, ".ppm") == 0;
+
+    if (ppm)
+    {
+        fout << "P6\n" << width << ' ' << height << "\n255\n";
+
+        vector<char> line(width * 3);
+        for (uint y = 0; y < height; ++y)
+        {
+            rgb(y, line.data());
+            fout.write(line.data(), line.size());
+        }
+
+        return bool(fout);
+    }
+
+    // PNG: linhas com filtro nulo em blocos deflate sem compressão
+    vector<char> raw(size_t(width * 3 + 1) * height);
+    for (uint y = 0; y < height; ++y)
+    {
+        char * line = &raw[size_t(width * 3 + 1) * y];
+        line[0] = 0;
+        rgb(y, line + 1);
+    }
+
+    uint crcTable[256];
+    for (uint n = 0; n < 256; ++n)
+    {
+        uint c = n;
+        for (uint k = 0; k < 8; ++k)
+            c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        crcTable[n] = c;
+    }
+
+    auto big = [](vector<char> & out, uint value)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+            out.push_back(char(value >> shift & 0xff));
+    };
+
+    // bloco PNG: tamanho, tipo, dados e CRC do tipo com os dados
+    auto chunk = [&](const char * type, const vector<char> & data)
+    {
+        vector<char> header;
+        big(header, uint(data.size()));
+        header.insert(header.end(), type, type + 4);
+
+        uint crc = 0xffffffffu;
+        for (size_t i = 4; i < header.size(); ++i)
+            crc = crcTable[(crc ^ byte(header[i])) & 0xff] ^ (crc >> 8);
+        for (char c : data)
+            crc = crcTable[(crc ^ byte(c)) & 0xff] ^ (crc >> 8);
+
+        vector<char> tail;
+        big(tail, crc ^ 0xffffffffu);
+
+        fout.write(header.data(), header.size());
+        fout.write(data.data(), data.size());
+        fout.write(tail.data(), tail.size());
+    };
+
+    vector<char> ihdr;
+    big(ihdr, width);
+    big(ihdr, height);
+    ihdr.insert(ihdr.end(), { 8, 2, 0, 0, 0 });     // 8 bits, RGB, deflate, sem filtro adaptativo, sem entrelaçamento
+
+    // fluxo zlib com blocos armazenados de até 65535 bytes
+    vector<char> idat = { 0x78, 0x01 };
+    uint s1 = 1, s2 = 0;
+    for (size_t offset = 0; offset < raw.size(); offset += 65535)
+    {
+        uint length = uint(std::min<size_t>(65535, raw.size() - offset));
+        idat.push_back(offset + length == raw.size() ? 1 : 0);
+        idat.push_back(char(length & 0xff));
+        idat.push_back(char(length >> 8));
+        idat.push_back(char(~length & 0xff));
+        idat.push_back(char(~length >> 8 & 0xff));
+        idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + length);
+
+        for (uint i = 0; i < length; ++i)
+        {
+            s1 = (s1 + byte(raw[offset + i])) % 65521;
+            s2 = (s2 + s1) % 65521;
+        }
+    }
+    big(idat, s2 << 16 | s1);
+
+    const char signature[8] = { char(0x89), 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    fout.write(signature, 8);
+    chunk("IHDR", ihdr);
+    chunk("IDAT", idat);
+    chunk("IEND", vector<char>());
+
+    return bool(fout);
+}
+
+// -------------------------------------------------------------------------------
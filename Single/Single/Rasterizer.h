@@ -0,0 +1,143 @@
+/**********************************************************************************
+// Rasterizer (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Rasterizador por software para execuções sem GPU. Recebe os
+//              mesmos vértices, sub-malhas e matrizes combinadas usados pelo
+//              pipeline gráfico, distribui os triângulos em blocos de tela e
+//              rasteriza os blocos em paralelo com funções de aresta SSE2,
+//              teste de profundidade e preenchimento sólido ou em arame.
+//              A imagem final pode ser gravada em PNG ou PPM.
+//
+**********************************************************************************/
+
+#ifndef DXUT_RASTERIZER_H_
+#define DXUT_RASTERIZER_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Geometry.h"
+#include "ThreadPool.h"
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+enum RasterFill { RASTER_SOLID, RASTER_WIREFRAME };
+
+// desenho indexado de uma sub-malha
+struct RasterDraw
+{
+    const Vertex * vertices;                        // vértices da geometria
+    const uint * indices;                           // índices da geometria
+    uint indexCount;                                // índices desenhados
+    uint startIndex;                                // primeiro índice desenhado
+    uint baseVertex;                                // somado a cada índice
+    XMFLOAT4X4 worldViewProj;                       // matriz combinada transposta (como no buffer constante)
+};
+
+// -------------------------------------------------------------------------------
+
+class Rasterizer
+{
+private:
+    static const uint TileSize = 64;                // lado do bloco de tela em pixels
+
+    // triângulo pronto para rasterizar: funções de aresta e atributos
+    struct Triangle
+    {
+        float a[3], b[3];                           // aresta i (oposta ao vértice i): a*(x-ox) + b*(y-oy)
+        float ox[3], oy[3];                         // origem de cada aresta (mesma nos dois triângulos vizinhos)
+        int   topLeft[3];                           // aresta superior ou esquerda (~0) inclui pixels sobre ela
+        float invLength[3];                         // inverso do comprimento de cada aresta
+        float z[3];                                 // profundidade de cada vértice
+        float w[3];                                 // 1/w de cada vértice
+        float color[3][4];                          // cor/w de cada vértice
+        float invArea;                              // inverso do dobro da área
+        int minX, minY, maxX, maxY;                 // retângulo envolvente em pixels
+    };
+
+    // triângulos preparados por um bloco de trabalho e sua distribuição
+    struct Batch
+    {
+        vector<Triangle> triangles;                 // triângulos preparados
+        vector<vector<uint>> bins;                  // triângulos que tocam cada bloco de tela
+    };
+
+    uint width;                                     // largura da imagem
+    uint height;                                    // altura da imagem
+    uint tilesX;                                    // blocos na horizontal
+    uint tilesY;                                    // blocos na vertical
+    uint fill;                                      // modo de preenchimento
+    bool cull;                                      // descarta triângulos de costas
+    uint stride;                                    // pixels por linha (múltiplo de 4)
+    vector<uint> color;                             // imagem RGBA (8 bits por canal)
+    vector<float> depth;                            // buffer de profundidade
+    vector<RasterDraw> draws;                       // desenhos pendentes
+    vector<uint> firsts;                            // primeiro triângulo de cada desenho
+    vector<Batch> batches;                          // um por bloco de trabalho
+    ThreadPool pool;                                // threads de preparação e rasterização
+    ullong triangles;                               // triângulos rasterizados desde o início
+
+    void Setup(const RasterDraw & draw, uint triangle, Batch & batch);  // transforma e recorta um triângulo
+    void Emit(const float * v0, const float * v1, const float * v2,
+              Batch & batch);                                           // prepara e distribui nos blocos
+    void Raster(uint tile);                                             // rasteriza um bloco de tela
+
+public:
+    Rasterizer(uint width, uint height, uint threads = 0);  // construtor (0 = todos os núcleos)
+
+    void Fill(uint mode);                           // define modo de preenchimento
+    void Cull(bool enable);                         // ativa descarte de costas
+    void Clear(float r, float g, float b);          // limpa imagem e profundidade
+    void Draw(const RasterDraw & draw);             // enfileira um desenho
+    void Finish();                                  // prepara e rasteriza desenhos pendentes
+
+    uint Width() const;                             // largura da imagem
+    uint Height() const;                            // altura da imagem
+    uint Threads() const;                           // threads usadas
+    ullong Triangles() const;                       // triângulos rasterizados desde o início
+    uint Pixel(uint x, uint y) const;               // cor RGBA de um pixel
+    bool Save(const string & fileName) const;       // grava PNG (ou PPM se .ppm)
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+// define modo de preenchimento (RASTER_SOLID ou RASTER_WIREFRAME)
+inline void Rasterizer::Fill(uint mode)
+{ fill = mode; }
+
+// descarta triângulos em sentido anti-horário na tela, como o pipeline
+inline void Rasterizer::Cull(bool enable)
+{ cull = enable; }
+
+// largura da imagem
+inline uint Rasterizer::Width() const
+{ return width; }
+
+// altura da imagem
+inline uint Rasterizer::Height() const
+{ return height; }
+
+// threads usadas (inclui a chamadora)
+inline uint Rasterizer::Threads() const
+{ return pool.Size(); }
+
+// triângulos que passaram pelo recorte e pelo descarte
+inline ullong Rasterizer::Triangles() const
+{ return triangles; }
+
+// cor do pixel (vermelho no byte menos significativo)
+inline uint Rasterizer::Pixel(uint x, uint y) const
+{ return color[size_t(y) * stride + x]; }
+
+// -------------------------------------------------------------------------------
+
+#endif
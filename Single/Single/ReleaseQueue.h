@@ -0,0 +1,125 @@
+/**********************************************************************************
+// ReleaseQueue (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Fila de liberação adiada. Guarda objetos que a GPU ainda pode
+//              estar usando junto com as barreiras (fila de desenho e fila de
+//              cópia) que precisam ser alcançadas antes da liberação, e conta
+//              os recursos vivos e sua memória. Não depende do Direct3D: quem
+//              usa informa os valores concluídos das barreiras e como liberar.
+//
+**********************************************************************************/
+
+#ifndef DXUT_RELEASEQUEUE_H_
+#define DXUT_RELEASEQUEUE_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <deque>
+using std::deque;
+
+// -------------------------------------------------------------------------------
+
+template<class T>
+class ReleaseQueue
+{
+private:
+    struct Retired
+    {
+        T      object;                              // recurso ou heap a liberar
+        ullong fenceValue;                          // barreira após o último uso
+        ullong copyValue;                           // lote de cópia após o último uso
+        ullong bytes;                               // memória ocupada (0 se não contabilizado)
+        bool   counted;                             // contabilizado nos recursos vivos
+    };
+
+    deque<Retired> retired;                         // objetos aguardando a GPU
+    uint   live;                                    // recursos criados e não liberados
+    ullong liveBytes;                               // memória dos recursos não liberados
+
+public:
+    ReleaseQueue();                                 // construtor
+
+    void Track(ullong bytes);                       // contabiliza recurso criado
+    void Retire(T object, ullong fenceValue,
+        ullong copyValue, ullong bytes);            // adia liberação de recurso contabilizado
+    void Retire(T object, ullong fenceValue);       // adia liberação de objeto não contabilizado
+
+    // libera os objetos cujas barreiras já foram alcançadas (retorna quantos)
+    template<class Release>
+    uint Collect(ullong completed, ullong copied, Release release);
+
+    uint Pending() const;                           // objetos aguardando a GPU
+    uint Live() const;                              // recursos criados e não liberados
+    ullong LiveBytes() const;                       // memória dos recursos não liberados
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+template<class T>
+inline ReleaseQueue<T>::ReleaseQueue() : live(0), liveBytes(0)
+{}
+
+template<class T>
+inline void ReleaseQueue<T>::Track(ullong bytes)
+{ ++live; liveBytes += bytes; }
+
+template<class T>
+inline void ReleaseQueue<T>::Retire(T object, ullong fenceValue, ullong copyValue, ullong bytes)
+{ retired.push_back({ object, fenceValue, copyValue, bytes, true }); }
+
+template<class T>
+inline void ReleaseQueue<T>::Retire(T object, ullong fenceValue)
+{ retired.push_back({ object, fenceValue, 0, 0, false }); }
+
+// objetos retirados em ordem podem terminar fora de ordem: um lote de
+// cópia antigo pode segurar um objeto enquanto os seguintes são liberados
+template<class T>
+template<class Release>
+inline uint ReleaseQueue<T>::Collect(ullong completed, ullong copied, Release release)
+{
+    uint released = 0;
+
+    auto it = retired.begin();
+    while (it != retired.end())
+    {
+        if (it->fenceValue > completed || it->copyValue > copied)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->counted)
+        {
+            --live;
+            liveBytes -= it->bytes;
+        }
+
+        release(it->object);
+        it = retired.erase(it);
+        ++released;
+    }
+
+    return released;
+}
+
+template<class T>
+inline uint ReleaseQueue<T>::Pending() const
+{ return uint(retired.size()); }
+
+template<class T>
+inline uint ReleaseQueue<T>::Live() const
+{ return live; }
+
+template<class T>
+inline ullong ReleaseQueue<T>::LiveBytes() const
+{ return liveBytes; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -36,7 +36,7 @@ private:
     Mesh* mesh = nullptr;
 
     Timer timer;
-    bool spinning = false; // O objeto no gira por padro
+    bool spinning = false; // O objeto não gira por padrão
 
     XMFLOAT4X4 Identity = {};
     XMFLOAT4X4 View = {};
@@ -77,12 +77,14 @@ public:
     void Update();
     void Draw();
     void Finalize();
+    ullong Hash();
     ObjData LoadOBJ(const std::string& filename);
     void BuildRootSignature();
     void BuildPipelineState();
 };
 
 ObjData Single::LoadOBJ(const std::string& filename) {
+    PROFILE_SCOPE("LoadOBJ");
     ObjData objData;
     std::ifstream file(filename);
     std::string line;
@@ -97,7 +99,7 @@ ObjData Single::LoadOBJ(const std::string& filename) {
         iss >> prefix;
 
         if (prefix == "v") {
-            // Vrtices (posies)
+            // Vértices (posições)
             XMFLOAT3 position;
             iss >> position.x >> position.y >> position.z;
             positions.push_back(position);
@@ -109,13 +111,13 @@ ObjData Single::LoadOBJ(const std::string& filename) {
             normals.push_back(normal);
         }
         else if (prefix == "f") {
-            // Faces (ndices de vrtices, coordenadas de textura e normais)
+            // Faces (índices de vértices, coordenadas de textura e normais)
             uint32_t v1, v2, v3;
             uint32_t vt1, vt2, vt3; // Coordenadas de textura
             uint32_t n1, n2, n3;    // Normais
             char slash;
 
-            // Verifica se o formato  v/vt/vn
+            // Verifica se o formato é v/vt/vn
             std::string faceStr;
             getline(iss, faceStr);
             std::istringstream faceStream(faceStr);
@@ -127,7 +129,7 @@ ObjData Single::LoadOBJ(const std::string& filename) {
                     >> v2 >> slash >> slash >> n2
                     >> v3 >> slash >> slash >> n3;
 
-                // Armazena os ndices dos vrtices (convertendo de 1-based para 0-based)
+                // Armazena os índices dos vértices (convertendo de 1-based para 0-based)
                 objData.indices.push_back(v1 - 1);
                 objData.indices.push_back(v2 - 1);
                 objData.indices.push_back(v3 - 1);
@@ -141,7 +143,7 @@ ObjData Single::LoadOBJ(const std::string& filename) {
                     >> v2 >> slash >> vt2 >> slash >> n2
                     >> v3 >> slash >> vt3 >> slash >> n3;
 
-                // Armazena os ndices dos vrtices (convertendo de 1-based para 0-based)
+                // Armazena os índices dos vértices (convertendo de 1-based para 0-based)
                 objData.indices.push_back(v1 - 1);
                 objData.indices.push_back(v2 - 1);
                 objData.indices.push_back(v3 - 1);
@@ -156,7 +158,7 @@ ObjData Single::LoadOBJ(const std::string& filename) {
     for (auto& pos : positions) {
         Vertex vertex;
         vertex.pos = pos;
-        vertex.color = XMFLOAT4(DirectX::Colors::DimGray); // Definir cor padro
+        vertex.color = XMFLOAT4(DirectX::Colors::DimGray); // Definir cor padrão
         objData.vertices.push_back(vertex);
     }
 
@@ -167,18 +169,16 @@ ObjData Single::LoadOBJ(const std::string& filename) {
 
 void Single::Init()
 {
-    graphics->ResetCommands();
-
     // -----------------------------
-    // Parmetros Iniciais da Cmera
+    // Parâmetros Iniciais da Câmera
     // -----------------------------
  
-    // controla rotao da cmera
+    // controla rotação da câmera
     theta = XM_PIDIV4;
     phi = 1.3f;
     radius = 5.0f;
 
-    // pega ltima posio do mouse
+    // pega última posição do mouse
     lastMousePosX = (float) input->MouseX();
     lastMousePosY = (float) input->MouseY();
 
@@ -189,7 +189,7 @@ void Single::Init()
         0.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 1.0f };
 
-    // inicializa a matriz de projeo
+    // inicializa a matriz de projeção
     XMStoreFloat4x4(&Proj, XMMatrixPerspectiveFovLH(
         XMConvertToRadians(45.0f), 
         window->AspectRatio(), 
@@ -199,13 +199,13 @@ void Single::Init()
 
     totalVertexCount = (grid.VertexCount()); // quantidade de vertices
 
-    vbSize = totalVertexCount * sizeof(Vertex); // tamanho em bytes dos vrtices
+    vbSize = totalVertexCount * sizeof(Vertex); // tamanho em bytes dos vértices
 
-    totalIndexCount = (grid.IndexCount());     // quantidade total de ndices
+    totalIndexCount = (grid.IndexCount());     // quantidade total de índices
 
-    ibSize = totalIndexCount * sizeof(uint);     // tamanho em bytes dos ndices
+    ibSize = totalIndexCount * sizeof(uint);     // tamanho em bytes dos índices
 
-    vertices.resize(totalVertexCount);    // junta todos os vrtices em um nico vetor
+    vertices.resize(totalVertexCount);    // junta todos os vértices em um único vetor
 
     for (uint i = 0; i < grid.VertexCount(); ++i, ++k)
     {
@@ -213,7 +213,7 @@ void Single::Init()
         vertices[k].color = XMFLOAT4(DirectX::Colors::DimGray);
     }
 
-    // junta todos os ndices em um nico vetor
+    // junta todos os índices em um único vetor
  
     indices.insert(indices.end(), begin(grid.indices), end(grid.indices));
 
@@ -241,7 +241,6 @@ void Single::Init()
     BuildPipelineState();    
 
     // ---------------------------------------
-    graphics->SubmitCommands();
 
     timer.Start();
 }
@@ -262,7 +261,6 @@ void Single::Update()
     // b: box, c:cylinder, s:sphere, g: geosphere, p: plane (grid), q:quad
     if (input->KeyPress('B')) {
         OutputDebugString("Box criada\n");
-        graphics->ResetCommands();
 
         Box newBox(2.0f, 2.0f, 2.0f); //Cria BOX
 
@@ -293,13 +291,13 @@ void Single::Update()
         newBoxSubMesh.startIndex = totalIndexCount;
         newBoxSubMesh.baseVertex = totalVertexCount;
 
-        //Definio do Objeto
+        //Definição do Objeto
         Object obj;
 
         XMStoreFloat4x4(&obj.world,
             XMMatrixScaling(0.4f, 0.4f, 0.4f) *
             XMMatrixTranslation(0.0f, 0.0f, 0.0f));
-        obj.cbIndex = cbIndex; //Recebe numero de objetos *COMEA COM UM POR JA INICIAR COM O GRID*
+        obj.cbIndex = cbIndex; //Recebe numero de objetos *COMEÇA COM UM POR JA INICIAR COM O GRID*
         obj.submesh = newBoxSubMesh; //Recebe submalha da nova BOX
         scene.push_back(obj); //Coloca no vetor
 
@@ -319,13 +317,10 @@ void Single::Update()
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
 
         // ---------------------------------------
-
-        graphics->SubmitCommands();
     }
 
     else if (input->KeyPress('C')) {
         OutputDebugString("Cylinder\n");
-        graphics->ResetCommands();
 
         Cylinder newCylinder(1.0f, 0.5f, 3.0f, 20, 10); //Cria novo Cylinder
 
@@ -379,12 +374,9 @@ void Single::Update()
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('S')) {
         OutputDebugString("Sphere\n");
-        graphics->ResetCommands();
 
         Sphere newSphere(1.0f, 20, 20); //Cria nova Sphere
 
@@ -438,12 +430,9 @@ void Single::Update()
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('G')) {
         OutputDebugString("Geosphere\n");
-        graphics->ResetCommands();
 
         GeoSphere newGeoSphere(1.0f, 20); //Cria nova GeoSphere
 
@@ -497,12 +486,9 @@ void Single::Update()
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('P')) {
         OutputDebugString("Plane (grid)\n");
-        graphics->ResetCommands();
 
         Grid newGrid(3.0f, 3.0f, 20, 20); //Cria novo Grid
 
@@ -555,12 +541,9 @@ void Single::Update()
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('Q')) {
         OutputDebugString("Quad\n");
-        graphics->ResetCommands();
 
         Quad newQuad(2.0f, 2.0f); //Cria novo Quad
 
@@ -614,37 +597,34 @@ void Single::Update()
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     //Ball, Capsule, House, Monkey e Thorus
     else if (input->KeyPress('1')) {
         OutputDebugString("Ball\n");
-        graphics->ResetCommands();
 
         // Carregar o arquivo .obj
         ObjData ballData = LoadOBJ("ball.obj");
 
-        // Atualizar a quantidade de vrtices e ndices
+        // Atualizar a quantidade de vértices e índices
         uint newTotalVertexCount = totalVertexCount + uint(ballData.vertices.size());
         const uint vbSize = newTotalVertexCount * sizeof(Vertex);
 
         uint newTotalIndexCount = totalIndexCount + uint(ballData.indices.size());
         const uint ibSize = newTotalIndexCount * sizeof(uint);
 
-        // Expandir o vetor de vrtices e ndices
+        // Expandir o vetor de vértices e índices
         std::vector<Vertex> aux(newTotalVertexCount);
         int k = 0;
 
         for (uint i{}; i < totalVertexCount; i++, k++) {
-            aux[i] = vertices[i]; // Copia os vrtices j existentes
+            aux[i] = vertices[i]; // Copia os vértices já existentes
         }
 
         for (uint i{}; i < ballData.vertices.size(); i++, k++) {
-            aux[k] = ballData.vertices[i]; // Adiciona os novos vrtices
+            aux[k] = ballData.vertices[i]; // Adiciona os novos vértices
         }
 
-        indices.insert(indices.end(), begin(ballData.indices), end(ballData.indices)); // Adiciona os novos ndices
+        indices.insert(indices.end(), begin(ballData.indices), end(ballData.indices)); // Adiciona os novos índices
 
         // Definir submesh para o novo objeto
         SubMesh newBallSubMesh;
@@ -656,7 +636,7 @@ void Single::Update()
         XMStoreFloat4x4(&obj.world, XMMatrixScaling(0.5f, 0.5f, 0.5f)); // Escala do objeto
         obj.cbIndex = cbIndex;
         obj.submesh = newBallSubMesh;
-        scene.push_back(obj); // Adiciona  cena
+        scene.push_back(obj); // Adiciona à cena
 
         cbIndex++;
 
@@ -665,41 +645,38 @@ void Single::Update()
 
         vertices = aux;
 
-        // Atualiza buffers de vrtices e ndices
+        // Atualiza buffers de vértices e índices
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
         }
 
     else if (input->KeyPress('2')) {
         OutputDebugString("Capsule\n");
-        graphics->ResetCommands();
 
         // Carregar o arquivo .obj
         ObjData capsuleData = LoadOBJ("capsule.obj");
 
-        // Atualizar a quantidade de vrtices e ndices
+        // Atualizar a quantidade de vértices e índices
         uint newTotalVertexCount = totalVertexCount + uint(capsuleData.vertices.size());
         const uint vbSize = newTotalVertexCount * sizeof(Vertex);
 
         uint newTotalIndexCount = totalIndexCount + uint(capsuleData.indices.size());
         const uint ibSize = newTotalIndexCount * sizeof(uint);
 
-        // Expandir o vetor de vrtices e ndices
+        // Expandir o vetor de vértices e índices
         std::vector<Vertex> aux(newTotalVertexCount);
         int k = 0;
 
         for (uint i{}; i < totalVertexCount; i++, k++) {
-            aux[i] = vertices[i]; // Copia os vrtices j existentes
+            aux[i] = vertices[i]; // Copia os vértices já existentes
         }
 
         for (uint i{}; i < capsuleData.vertices.size(); i++, k++) {
-            aux[k] = capsuleData.vertices[i]; // Adiciona os novos vrtices
+            aux[k] = capsuleData.vertices[i]; // Adiciona os novos vértices
         }
 
-        indices.insert(indices.end(), begin(capsuleData.indices), end(capsuleData.indices)); // Adiciona os novos ndices
+        indices.insert(indices.end(), begin(capsuleData.indices), end(capsuleData.indices)); // Adiciona os novos índices
 
         // Definir submesh para o novo objeto
         SubMesh newCapsuleSubMesh;
@@ -711,7 +688,7 @@ void Single::Update()
         XMStoreFloat4x4(&obj.world, XMMatrixScaling(0.5f, 0.5f, 0.5f)); // Escala do objeto
         obj.cbIndex = cbIndex;
         obj.submesh = newCapsuleSubMesh;
-        scene.push_back(obj); // Adiciona  cena
+        scene.push_back(obj); // Adiciona à cena
 
         cbIndex++;
 
@@ -720,40 +697,37 @@ void Single::Update()
 
         vertices = aux;
 
-        // Atualiza buffers de vrtices e ndices
+        // Atualiza buffers de vértices e índices
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('3')) {
         OutputDebugString("House\n");
-        graphics->ResetCommands();
 
         // Carregar o arquivo .obj
         ObjData houseData = LoadOBJ("house.obj");
 
-        // Atualizar a quantidade de vrtices e ndices
+        // Atualizar a quantidade de vértices e índices
         uint newTotalVertexCount = totalVertexCount + uint(houseData.vertices.size());
         const uint vbSize = newTotalVertexCount * sizeof(Vertex);
 
         uint newTotalIndexCount = totalIndexCount + uint(houseData.indices.size());
         const uint ibSize = newTotalIndexCount * sizeof(uint);
 
-        // Expandir o vetor de vrtices e ndices
+        // Expandir o vetor de vértices e índices
         std::vector<Vertex> aux(newTotalVertexCount);
         int k = 0;
 
         for (uint i{}; i < totalVertexCount; i++, k++) {
-            aux[i] = vertices[i]; // Copia os vrtices j existentes
+            aux[i] = vertices[i]; // Copia os vértices já existentes
         }
 
         for (uint i{}; i < houseData.vertices.size(); i++, k++) {
-            aux[k] = houseData.vertices[i]; // Adiciona os novos vrtices
+            aux[k] = houseData.vertices[i]; // Adiciona os novos vértices
         }
 
-        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos ndices
+        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos índices
 
         // Definir submesh para o novo objeto
         SubMesh newHouseSubMesh;
@@ -765,7 +739,7 @@ void Single::Update()
         XMStoreFloat4x4(&obj.world, XMMatrixScaling(0.5f, 0.5f, 0.5f)); // Escala do objeto
         obj.cbIndex = cbIndex;
         obj.submesh = newHouseSubMesh;
-        scene.push_back(obj); // Adiciona  cena
+        scene.push_back(obj); // Adiciona à cena
 
         cbIndex++;
 
@@ -774,40 +748,37 @@ void Single::Update()
 
         vertices = aux;
 
-        // Atualiza buffers de vrtices e ndices
+        // Atualiza buffers de vértices e índices
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('4')) {
         OutputDebugString("Monkey\n");
-        graphics->ResetCommands();
 
         // Carregar o arquivo .obj
         ObjData houseData = LoadOBJ("monkey.obj");
 
-        // Atualizar a quantidade de vrtices e ndices
+        // Atualizar a quantidade de vértices e índices
         uint newTotalVertexCount = totalVertexCount + uint(houseData.vertices.size());
         const uint vbSize = newTotalVertexCount * sizeof(Vertex);
 
         uint newTotalIndexCount = totalIndexCount + uint(houseData.indices.size());
         const uint ibSize = newTotalIndexCount * sizeof(uint);
 
-        // Expandir o vetor de vrtices e ndices
+        // Expandir o vetor de vértices e índices
         std::vector<Vertex> aux(newTotalVertexCount);
         int k = 0;
 
         for (uint i{}; i < totalVertexCount; i++, k++) {
-            aux[i] = vertices[i]; // Copia os vrtices j existentes
+            aux[i] = vertices[i]; // Copia os vértices já existentes
         }
 
         for (uint i{}; i < houseData.vertices.size(); i++, k++) {
-            aux[k] = houseData.vertices[i]; // Adiciona os novos vrtices
+            aux[k] = houseData.vertices[i]; // Adiciona os novos vértices
         }
 
-        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos ndices
+        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos índices
 
         // Definir submesh para o novo objeto
         SubMesh newHouseSubMesh;
@@ -819,7 +790,7 @@ void Single::Update()
         XMStoreFloat4x4(&obj.world, XMMatrixScaling(0.5f, 0.5f, 0.5f)); // Escala do objeto
         obj.cbIndex = cbIndex;
         obj.submesh = newHouseSubMesh;
-        scene.push_back(obj); // Adiciona  cena
+        scene.push_back(obj); // Adiciona à cena
 
         cbIndex++;
 
@@ -828,40 +799,37 @@ void Single::Update()
 
         vertices = aux;
 
-        // Atualiza buffers de vrtices e ndices
+        // Atualiza buffers de vértices e índices
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
     else if (input->KeyPress('5')) {
         OutputDebugString("Thorus\n");
-        graphics->ResetCommands();
 
         // Carregar o arquivo .obj
         ObjData houseData = LoadOBJ("thorus.obj");
 
-        // Atualizar a quantidade de vrtices e ndices
+        // Atualizar a quantidade de vértices e índices
         uint newTotalVertexCount = totalVertexCount + uint(houseData.vertices.size());
         const uint vbSize = newTotalVertexCount * sizeof(Vertex);
 
         uint newTotalIndexCount = totalIndexCount + uint(houseData.indices.size());
         const uint ibSize = newTotalIndexCount * sizeof(uint);
 
-        // Expandir o vetor de vrtices e ndices
+        // Expandir o vetor de vértices e índices
         std::vector<Vertex> aux(newTotalVertexCount);
         int k = 0;
 
         for (uint i{}; i < totalVertexCount; i++, k++) {
-            aux[i] = vertices[i]; // Copia os vrtices j existentes
+            aux[i] = vertices[i]; // Copia os vértices já existentes
         }
 
         for (uint i{}; i < houseData.vertices.size(); i++, k++) {
-            aux[k] = houseData.vertices[i]; // Adiciona os novos vrtices
+            aux[k] = houseData.vertices[i]; // Adiciona os novos vértices
         }
 
-        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos ndices
+        indices.insert(indices.end(), begin(houseData.indices), end(houseData.indices)); // Adiciona os novos índices
 
         // Definir submesh para o novo objeto
         SubMesh newHouseSubMesh;
@@ -873,7 +841,7 @@ void Single::Update()
         XMStoreFloat4x4(&obj.world, XMMatrixScaling(0.5f, 0.5f, 0.5f)); // Escala do objeto
         obj.cbIndex = cbIndex;
         obj.submesh = newHouseSubMesh;
-        scene.push_back(obj); // Adiciona  cena
+        scene.push_back(obj); // Adiciona à cena
 
         cbIndex++;
 
@@ -882,35 +850,31 @@ void Single::Update()
 
         vertices = aux;
 
-        // Atualiza buffers de vrtices e ndices
+        // Atualiza buffers de vértices e índices
         mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
         mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
         mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
-
-        graphics->SubmitCommands();
     }
    
     else if (input->KeyPress(VK_TAB)) {
         OutputDebugString("Tab pressionado\n");
 
-        // Alterna o ndice do objeto selecionado
+        // Alterna o índice do objeto selecionado
         selecionado = (selecionado + 1) % scene.size();
         OutputDebugString(("Objeto selecionado: " + std::to_string(selecionado) + "\n").c_str());
 
-        graphics->ResetCommands();
-
         bool verticesAlterados = false;
 
         // Itera sobre os objetos na cena
         for (auto& obj : scene) {
-            // Calcula o nmero de vrtices do submesh atual
+            // Calcula o número de vértices do submesh atual
             uint numVertices = obj.submesh.indexCount;
             OutputDebugString(("Num vertices: " + std::to_string(numVertices) + "\n").c_str());
 
-            // Itera sobre todos os vrtices do submesh do objeto selecionado
+            // Itera sobre todos os vértices do submesh do objeto selecionado
             if (obj.cbIndex == selecionado) {
                 for (uint i = 0; i < numVertices; ++i) {
-                    // Verifica os limites de acesso aos vrtices
+                    // Verifica os limites de acesso aos vértices
                     if (obj.submesh.baseVertex + i < vertices.size()) {
                         vertices[obj.submesh.baseVertex + i].color = XMFLOAT4(DirectX::Colors::Red);
                         verticesAlterados = true;
@@ -919,7 +883,7 @@ void Single::Update()
             }
             else {
                 for (uint i = 0; i < numVertices; ++i) {
-                    // Verifica os limites de acesso aos vrtices
+                    // Verifica os limites de acesso aos vértices
                     if (obj.submesh.baseVertex + i < vertices.size()) {
                         vertices[obj.submesh.baseVertex + i].color = XMFLOAT4(DirectX::Colors::DimGray);
                         verticesAlterados = true;
@@ -928,14 +892,13 @@ void Single::Update()
             }
         }
 
-        // Atualiza os buffers de vrtices e ndices apenas se houver mudanas
+        // Atualiza os buffers de vértices e índices apenas se houver mudanças
         if (verticesAlterados) {
             mesh->VertexBuffer(vertices.data(), totalVertexCount * sizeof(Vertex), sizeof(Vertex));
             mesh->IndexBuffer(indices.data(), totalIndexCount * sizeof(uint), DXGI_FORMAT_R32_UINT);
         }
 
         // Submete os comandos para a GPU
-        graphics->SubmitCommands();
         }
 
 
@@ -943,27 +906,27 @@ void Single::Update()
     else if (input->KeyPress(VK_DELETE)) {
         OutputDebugString("Tecla DEL pressionada\n");
 
-        if (!scene.empty()) {  // Verifica se h objetos na cena
-            // Verifica se o objeto selecionado est dentro dos limites
+        if (!scene.empty()) {  // Verifica se há objetos na cena
+            // Verifica se o objeto selecionado está dentro dos limites
             if (selecionado >= 0 && selecionado < scene.size()) {
                 OutputDebugString(("Deletando objeto: " + std::to_string(selecionado) + "\n").c_str());
 
                 // Obter o objeto a ser removido
                 const Object& objToDelete = scene[selecionado];
 
-                // Remover os vrtices e ndices associados ao objeto
+                // Remover os vértices e índices associados ao objeto
                 const uint vertexCountToRemove = objToDelete.submesh.indexCount;
                 const uint startVertex = objToDelete.submesh.baseVertex;
                 const uint indexCountToRemove = objToDelete.submesh.indexCount;
                 const uint startIndex = objToDelete.submesh.startIndex;
 
-                // Remover vrtices
+                // Remover vértices
                 vertices.erase(vertices.begin() + startVertex, vertices.begin() + startVertex + vertexCountToRemove);
 
-                // Remover ndices
+                // Remover índices
                 indices.erase(indices.begin() + startIndex, indices.begin() + startIndex + indexCountToRemove);
 
-                // Atualizar os submeshes dos objetos restantes (ajustando os ndices)
+                // Atualizar os submeshes dos objetos restantes (ajustando os índices)
                 for (uint i = selecionado + 1; i < scene.size(); ++i) {
                     scene[i].submesh.baseVertex -= vertexCountToRemove;
                     scene[i].submesh.startIndex -= indexCountToRemove;
@@ -972,30 +935,27 @@ void Single::Update()
                 // Remover o objeto da cena
                 scene.erase(scene.begin() + selecionado);
 
-                // Atualizar total de vrtices e ndices
+                // Atualizar total de vértices e índices
                 totalVertexCount -= vertexCountToRemove;
                 totalIndexCount -= indexCountToRemove;
 
-                // Caso no haja mais objetos, o ndice selecionado  resetado
+                // Caso não haja mais objetos, o índice selecionado é resetado
                 if (scene.empty()) {
                     selecionado = -1;
                 }
                 else {
-                    // Se houver objetos restantes, garantir que o ndice de seleo seja vlido
+                    // Se houver objetos restantes, garantir que o índice de seleção seja válido
                     selecionado = selecionado % scene.size();
                 }
 
-                // Atualizar os buffers de vrtices e ndices na GPU
+                // Atualizar os buffers de vértices e índices na GPU
                 const uint vbSize = totalVertexCount * sizeof(Vertex);
                 const uint ibSize = totalIndexCount * sizeof(uint);
 
-                graphics->ResetCommands();
                 mesh->VertexBuffer(vertices.data(), vbSize, sizeof(Vertex));
                 mesh->IndexBuffer(indices.data(), ibSize, DXGI_FORMAT_R32_UINT);
                 mesh->ConstantBuffer(sizeof(ObjectConstants), uint(scene.size()));
 
-                graphics->SubmitCommands();
-
                 OutputDebugString("Objeto deletado e buffers atualizados\n");
             }
             else {
@@ -1008,7 +968,7 @@ void Single::Update()
         }
 
 
-    // ativa ou desativa a viso de cima
+    // ativa ou desativa a visão de cima
     if (input->KeyPress('V'))
     {
         topView = !topView;
@@ -1018,7 +978,7 @@ void Single::Update()
     float mousePosX = (float)input->MouseX();
     float mousePosY = (float)input->MouseY();
 
-    if (!topView) // Quando no est na viso de cima
+    if (!topView) // Quando não está na visão de cima
     {
         if (input->KeyDown(VK_LBUTTON))
         {
@@ -1026,12 +986,12 @@ void Single::Update()
             float dx = XMConvertToRadians(0.25f * (mousePosX - lastMousePosX));
             float dy = XMConvertToRadians(0.25f * (mousePosY - lastMousePosY));
 
-            // atualiza ngulos com base no deslocamento do mouse 
-            // para orbitar a cmera ao redor da caixa
+            // atualiza ângulos com base no deslocamento do mouse 
+            // para orbitar a câmera ao redor da caixa
             theta += dx;
             phi += dy;
 
-            // restringe o ngulo de phi ]0-180[ graus
+            // restringe o ângulo de phi ]0-180[ graus
             phi = phi < 0.1f ? 0.1f : (phi > (XM_PI - 0.1f) ? XM_PI - 0.1f : phi);
         }
         else if (input->KeyDown(VK_RBUTTON))
@@ -1040,7 +1000,7 @@ void Single::Update()
             float dx = 0.05f * (mousePosX - lastMousePosX);
             float dy = 0.05f * (mousePosY - lastMousePosY);
 
-            // atualiza o raio da cmera com base no deslocamento do mouse 
+            // atualiza o raio da câmera com base no deslocamento do mouse 
             radius += dx - dy;
 
             // restringe o raio (3 a 15 unidades)
@@ -1050,12 +1010,12 @@ void Single::Update()
         lastMousePosX = mousePosX;
         lastMousePosY = mousePosY;
 
-        // converte coordenadas esfricas para cartesianas
+        // converte coordenadas esféricas para cartesianas
         float x = radius * sinf(phi) * cosf(theta);
         float z = radius * sinf(phi) * sinf(theta);
         float y = radius * cosf(phi);
 
-        // constri a matriz da cmera (view matrix)
+        // constrói a matriz da câmera (view matrix)
         XMVECTOR pos = XMVectorSet(x, y, z, 1.0f);
         XMVECTOR target = XMVectorZero();
         XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
@@ -1063,24 +1023,27 @@ void Single::Update()
         XMStoreFloat4x4(&View, view);
     }
     else {
-        // Coloca a cmera acima dos objetos, olhando diretamente para baixo
-        XMVECTOR pos = XMVectorSet(0.0f, 10.0f, 0.0f, 1.0f);  // Altura Y=10.0 (ajuste conforme necessrio)
+        // Coloca a câmera acima dos objetos, olhando diretamente para baixo
+        XMVECTOR pos = XMVectorSet(0.0f, 10.0f, 0.0f, 1.0f);  // Altura Y=10.0 (ajuste conforme necessário)
         XMVECTOR target = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f); // Centro da cena
         XMVECTOR up = XMVectorSet(0.0f, 0.0f, -1.0f, 0.0f);    // Vetor "up" apontando para o eixo Z negativo
         XMMATRIX view = XMMatrixLookAtLH(pos, target, up);
         XMStoreFloat4x4(&View, view);
     }
-    // carrega matriz de projeo em uma XMMATRIX
+    // carrega matriz de projeção em uma XMMATRIX
     XMMATRIX proj = XMLoadFloat4x4(&Proj);
     if (input->KeyPress('R')) {
-        spinning = !spinning; // Alterna o estado de rotao
+        spinning = !spinning; // Alterna o estado de rotação
     }
   
+        // mede a atualização das matrizes de todos os objetos
+        PROFILE_SCOPE("WVP");
+
         for (auto& obj : scene) {
             // carrega matriz de mundo em uma XMMATRIX
             XMMATRIX world = XMLoadFloat4x4(&obj.world);
 
-            // constri matriz combinada (world x view x proj)
+            // constrói matriz combinada (world x view x proj)
             XMMATRIX WorldViewProj = world * XMLoadFloat4x4(&View) * proj;
 
             // atualiza o buffer constante com a matriz combinada
@@ -1106,27 +1069,32 @@ void Single::Draw()
     // limpa o backbuffer
     graphics->Clear(pipelineState);
 
-    // comandos de configurao do pipeline
-    ID3D12DescriptorHeap* descriptorHeaps = mesh->ConstantBufferHeap() ;
-    graphics->CommandList()->SetDescriptorHeaps(1, &descriptorHeaps);
-    graphics->CommandList()->SetGraphicsRootSignature(rootSignature);
-    graphics->CommandList()->IASetVertexBuffers(0, 1, mesh->VertexBufferView());
-    graphics->CommandList()->IASetIndexBuffer(mesh->IndexBufferView());
-    graphics->CommandList()->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
-    
-    // desenha objetos da cena
-    for (auto& obj : scene)
+    // desenha objetos da cena (cenas grandes são gravadas em paralelo)
+    graphics->Record(uint(scene.size()), [&](ID3D12GraphicsCommandList* cmdList, uint first, uint last)
     {
-        // ajusta o buffer constante associado ao vertex shader
-        graphics->CommandList()->SetGraphicsRootDescriptorTable(0, mesh->ConstantBufferHandle(obj.cbIndex));
-
-        // desenha objeto
-        graphics->CommandList()->DrawIndexedInstanced(
-            obj.submesh.indexCount, 1,
-            obj.submesh.startIndex,
-            obj.submesh.baseVertex,
-            0);
-    }
+        // comandos de configuração do pipeline
+        ID3D12DescriptorHeap* descriptorHeaps = mesh->ConstantBufferHeap();
+        cmdList->SetDescriptorHeaps(1, &descriptorHeaps);
+        cmdList->SetGraphicsRootSignature(rootSignature);
+        cmdList->IASetVertexBuffers(0, 1, mesh->VertexBufferView());
+        cmdList->IASetIndexBuffer(mesh->IndexBufferView());
+        cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+        for (uint i = first; i < last; ++i)
+        {
+            const Object& obj = scene[i];
+
+            // ajusta o buffer constante associado ao vertex shader
+            cmdList->SetGraphicsRootDescriptorTable(0, mesh->ConstantBufferHandle(obj.cbIndex));
+
+            // desenha objeto
+            cmdList->DrawIndexedInstanced(
+                obj.submesh.indexCount, 1,
+                obj.submesh.startIndex,
+                obj.submesh.baseVertex,
+                0);
+        }
+    });
  
     // apresenta o backbuffer na tela
     graphics->Present();    
@@ -1141,6 +1109,24 @@ void Single::Finalize()
     delete mesh;
 }
 
+// ------------------------------------------------------------------------------
+
+ullong Single::Hash()
+{
+    // objetos, submalhas e câmera determinam o que é desenhado
+    ullong hash = PipelineCache::Hash(&totalVertexCount, sizeof(totalVertexCount));
+    hash = PipelineCache::Hash(&totalIndexCount, sizeof(totalIndexCount), hash);
+    hash = PipelineCache::Hash(&View, sizeof(View), hash);
+
+    for (const auto& obj : scene)
+    {
+        hash = PipelineCache::Hash(&obj.world, sizeof(obj.world), hash);
+        hash = PipelineCache::Hash(&obj.submesh, sizeof(obj.submesh), hash);
+    }
+
+    return hash;
+}
+
 
 // ------------------------------------------------------------------------------
 //                                     D3D                                      
@@ -1148,7 +1134,7 @@ void Single::Finalize()
 
 void Single::BuildRootSignature()
 {
-    // cria uma nica tabela de descritores de CBVs
+    // cria uma única tabela de descritores de CBVs
     D3D12_DESCRIPTOR_RANGE cbvTable = {};
     cbvTable.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_CBV;
     cbvTable.NumDescriptors = 1;
@@ -1156,14 +1142,14 @@ void Single::BuildRootSignature()
     cbvTable.RegisterSpace = 0;
     cbvTable.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
 
-    // define parmetro raiz com uma tabela
+    // define parâmetro raiz com uma tabela
     D3D12_ROOT_PARAMETER rootParameters[1];
     rootParameters[0].ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
     rootParameters[0].ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
     rootParameters[0].DescriptorTable.NumDescriptorRanges = 1;
     rootParameters[0].DescriptorTable.pDescriptorRanges = &cbvTable;
 
-    // uma assinatura raiz  um vetor de parmetros raiz
+    // uma assinatura raiz é um vetor de parâmetros raiz
     D3D12_ROOT_SIGNATURE_DESC rootSigDesc = {};
     rootSigDesc.NumParameters = 1;
     rootSigDesc.pParameters = rootParameters;
@@ -1171,28 +1157,10 @@ void Single::BuildRootSignature()
     rootSigDesc.pStaticSamplers = nullptr;
     rootSigDesc.Flags = D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT;
 
-    // serializa assinatura raiz
-    ID3DBlob* serializedRootSig = nullptr;
-    ID3DBlob* error = nullptr;
-
-    ThrowIfFailed(D3D12SerializeRootSignature(
-        &rootSigDesc,
-        D3D_ROOT_SIGNATURE_VERSION_1,
-        &serializedRootSig,
-        &error));
-
-    if (error != nullptr)
-    {
-        OutputDebugString((char*)error->GetBufferPointer());
-    }
-
-    // cria uma assinatura raiz com um nico slot que aponta para  
-    // uma faixa de descritores consistindo de um nico buffer constante
-    ThrowIfFailed(graphics->Device()->CreateRootSignature(
-        0,
-        serializedRootSig->GetBufferPointer(),
-        serializedRootSig->GetBufferSize(),
-        IID_PPV_ARGS(&rootSignature)));
+    // cria uma assinatura raiz com um único slot que aponta para  
+    // uma faixa de descritores consistindo de um único buffer constante
+    // (a versão serializada é reaproveitada do cache em disco)
+    graphics->CreateRootSignature(&rootSigDesc, &rootSignature);
 }
 
 // ------------------------------------------------------------------------------
@@ -1290,7 +1258,7 @@ void Single::BuildPipelineState()
     pso.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
     pso.SampleDesc.Count = graphics->Antialiasing();
     pso.SampleDesc.Quality = graphics->Quality();
-    graphics->Device()->CreateGraphicsPipelineState(&pso, IID_PPV_ARGS(&pipelineState));
+    graphics->CreatePipelineState(&pso, &pipelineState);
 
     vertexShader->Release();
     pixelShader->Release();
@@ -1319,10 +1287,77 @@ int APIENTRY WinMain(_In_ HINSTANCE hInstance,
         engine->window->LostFocus(Engine::Pause);
         engine->window->InFocus(Engine::Resume);
 
-        // cria e executa a aplicao
-        engine->Start(new Single());
+        // desenha apenas quando algo muda: Single.exe --ondemand
+        Engine::OnDemand(strstr(lpCmdLine, "--ondemand") != nullptr);
+
+        // sem vsync, com a taxa limitada pelo motor: Single.exe --fps 144
+        string fps = Engine::Option(lpCmdLine, "--fps");
+        if (!fps.empty())
+        {
+            engine->graphics->VSync(false);
+            Engine::FrameRate(atof(fps.c_str()));
+        }
+
+        // execução sem janela visível para medições automatizadas:
+        // Single.exe --headless [quadros] [--seconds s] [--synthetic hz] [--warp] [--replay arquivo]
+        // gravação da entrada de uma sessão interativa:
+        // Single.exe --record arquivo
+        const char * headless = strstr(lpCmdLine, "--headless");
+        if (headless)
+        {
+            uint frames = 1000;
+            int given = sscanf_s(headless, "--headless %u", &frames);
+            engine->graphics->Software(strstr(lpCmdLine, "--warp") != nullptr);
+
+            // limite de tempo sem número de quadros: executa até o fim do prazo
+            string seconds = Engine::Option(lpCmdLine, "--seconds");
+            double secs = seconds.empty() ? 0.0 : atof(seconds.c_str());
+            if (secs > 0.0 && given != 1)
+                frames = 0;
+
+            // movimentos sintéticos do mouse para medir a latência da entrada
+            string synthetic = Engine::Option(lpCmdLine, "--synthetic");
+            if (!synthetic.empty())
+                engine->Synthetic(uint(atoi(synthetic.c_str())));
+
+            // reproduz uma sessão gravada ou usa o roteiro padrão
+            vector<InputEvent> events;
+            string replay = Engine::Option(lpCmdLine, "--replay");
+
+            if (!replay.empty())
+            {
+                if (!Input::Load(replay, events))
+                    OutputDebugString("---> Falha ao ler a entrada gravada\n");
+            }
+            else
+            {
+                // roteiro de entrada: cria uma geometria de cada tipo
+                uint frame = 1;
+                for (int key : { 'B', 'C', 'G', 'P', 'Q' })
+                {
+                    events.push_back({ frame, key, true });
+                    events.push_back({ frame + 1, key, false });
+                    frame += 2;
+                }
+            }
+
+            engine->Script(events);
+            engine->Headless(new Single(), frames, secs);
+        }
+        else
+        {
+            // grava a entrada da sessão se solicitado
+            string record = Engine::Option(lpCmdLine, "--record");
+            Input::Record(!record.empty());
+
+            // cria e executa a aplicação
+            engine->Start(new Single());
+
+            if (!record.empty())
+                Input::Save(record);
+        }
 
-        // finaliza execuo
+        // finaliza execução
         delete engine;
     }
     catch (Error & e)
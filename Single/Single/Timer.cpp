@@ -1,35 +1,35 @@
 /**********************************************************************************
-// Timer (Cdigo Fonte)
+// Timer (Código Fonte)
 // 
-// Criao:		02 Abr 2011
-// Atualizao:	09 Jul 2023
+// Criação:		02 Abr 2011
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	Usa um contador de alta preciso para medir o tempo
+// Descrição:	Usa um contador de alta precisão para medir o tempo
 //
 **********************************************************************************/
 
 #include "Timer.h"
 
 // ------------------------------------------------------------------------------
-// inicializao de membros estticos
+// inicialização de membros estáticos
 
-LARGE_INTEGER Timer::freq = { };	// frequncia do contador
+llong Timer::freq = 0;			// frequência do contador
 
 // ------------------------------------------------------------------------------
 
 Timer::Timer()
 {
-	// inicializa frequncia do contador apenas na primeira instanciao 
-	if (!freq.QuadPart)
+	// inicializa frequência do contador apenas na primeira instanciação 
+	if (!freq)
 	{
-		// pega frequncia do contador de alta resoluo
-		QueryPerformanceFrequency(&freq);
+		// pega frequência do contador de alta resolução
+		freq = Clock::Frequency();
 	}
 
-	// zera os valores de incio e fim da contagem
-	ZeroMemory(&start, sizeof(start));
-	ZeroMemory(&end, sizeof(end));
+	// zera os valores de início e fim da contagem
+	start = 0;
+	end = 0;
 
 	// timer em funcionamento
 	stoped = false;
@@ -49,11 +49,11 @@ void Timer::Start()
 		//
 		
 		// tempo transcorrida antes da parada
-		llong elapsed = end.QuadPart - start.QuadPart;
+		llong elapsed = end - start;
 		
-		// leva em conta tempo j transcorrido antes da parada
-		QueryPerformanceCounter(&start); 
-		start.QuadPart -= elapsed;
+		// leva em conta tempo já transcorrido antes da parada
+		start = Clock::Counter(); 
+		start -= elapsed;
 
 		// retoma contagem normal
 		stoped = false;
@@ -61,7 +61,7 @@ void Timer::Start()
 	else
 	{
 		// inicia contagem do tempo
-		QueryPerformanceCounter(&start);
+		start = Clock::Counter();
 	}
 }
 
@@ -72,7 +72,7 @@ void Timer::Stop()
 	if (!stoped)
 	{
 		// marca o ponto de parada do tempo
-		QueryPerformanceCounter(&end);
+		end = Clock::Counter();
 		stoped = true;
 	}
 }
@@ -86,10 +86,10 @@ double Timer::Reset()
 	if (stoped)
 	{
 		// pega tempo transcorrido antes da parada
-		elapsed = end.QuadPart - start.QuadPart;
+		elapsed = end - start;
 		
 		// reinicia contagem do tempo
-		QueryPerformanceCounter(&start); 
+		start = Clock::Counter(); 
 		
 		// contagem reativada
 		stoped = false;
@@ -97,25 +97,25 @@ double Timer::Reset()
 	else
 	{
 		// finaliza contagem do tempo
-		QueryPerformanceCounter(&end);
+		end = Clock::Counter();
 
 		// calcula tempo transcorrido (em ciclos)
-		elapsed = end.QuadPart - start.QuadPart;
+		elapsed = end - start;
 
 		// reinicia contador
 		start = end;
 	}
 
 	// converte tempo para segundos
-	return elapsed / double(freq.QuadPart);	
+	return elapsed / double(freq);	
 }
 
 // ------------------------------------------------------------------------------
 
 llong Timer::Stamp()
 {
-	QueryPerformanceCounter(&end);
-	return end.QuadPart;
+	end = Clock::Counter();
+	return end;
 }
 
 // ------------------------------------------------------------------------------
@@ -126,20 +126,20 @@ double Timer::Elapsed()
 
 	if (stoped)
 	{
-		// pega tempo transcorrido at a parada
-		elapsed = end.QuadPart - start.QuadPart;
+		// pega tempo transcorrido até a parada
+		elapsed = end - start;
 	}
 	else
 	{
 		// finaliza contagem do tempo
-		QueryPerformanceCounter(&end);
+		end = Clock::Counter();
 
 		// calcula tempo transcorrido (em ciclos)
-		elapsed = end.QuadPart - start.QuadPart;
+		elapsed = end - start;
 	}
 
 	// converte tempo para segundos
-	return elapsed / double(freq.QuadPart);
+	return elapsed / double(freq);
 }
 
 // -------------------------------------------------------------------------------
@@ -150,21 +150,21 @@ double Timer::Elapsed(llong stamp)
 
 	if (stoped)
 	{
-		// pega tempo transcorrido at a pausa
-		elapsed = end.QuadPart - stamp;
+		// pega tempo transcorrido até a pausa
+		elapsed = end - stamp;
 
 	}
 	else
 	{
 		// finaliza contagem do tempo
-		QueryPerformanceCounter(&end);
+		end = Clock::Counter();
 
 		// calcula tempo transcorrido (em ciclos)
-		elapsed = end.QuadPart - stamp;
+		elapsed = end - stamp;
 	}
 
 	// converte tempo para segundos
-	return elapsed / double(freq.QuadPart);
+	return elapsed / double(freq);
 }
 
 // -------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,11 +1,11 @@
 /**********************************************************************************
-// Timer (Arquivo de Cabealho)
+// Timer (Arquivo de Cabeçalho)
 // 
-// Criao:		02 Abr 2011
-// Atualizao:	09 Jul 2023
+// Criação:		02 Abr 2011
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:	Usa um contador de alta preciso para medir o tempo
+// Descrição:	Usa um contador de alta precisão para medir o tempo
 //
 **********************************************************************************/
 
@@ -14,23 +14,23 @@
 
 // -------------------------------------------------------------------------------
 
-#include <windows.h>						    // acesso ao contador de alta preciso
-#include "Types.h"							    // tipos especficos do motor
+#include "Clock.h"							    // acesso ao contador de alta precisão
+#include "Types.h"							    // tipos específicos do motor
 
 // -------------------------------------------------------------------------------
 
 class Timer
 {
 private:
-	static LARGE_INTEGER freq;					// frequncia do contador
-	LARGE_INTEGER start, end;					// valores de incio e fim do contador
+	static llong freq;							// frequência do contador
+	llong start, end;							// valores de início e fim do contador
 	bool stoped;								// estado da contagem
 	
 public:
 	Timer();									// construtor
 
 	void   Start();								// inicia/retoma contagem do tempo
-	void   Stop();								// pra contagem do tempo
+	void   Stop();								// pára contagem do tempo
 	double Reset();								// reinicia contagem e retorna tempo transcorrido
 	double Elapsed();							// retorna tempo transcorrido em segundos	
 	bool   Elapsed(double secs);				// verifica se transcorreu "secs" segundos
@@ -42,7 +42,7 @@ public:
 
 // -------------------------------------------------------------------------------
 
-// Funes Inline
+// Funções Inline
 
 inline bool Timer::Elapsed(double secs)
 { return (Elapsed() >= secs ? true : false); }
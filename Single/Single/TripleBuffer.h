@@ -0,0 +1,83 @@
+/**********************************************************************************
+// TripleBuffer (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Troca dados entre uma thread produtora e uma consumidora sem
+//              travas. Cada lado trabalha em sua própria cópia e a terceira
+//              cópia é trocada atomicamente: a produtora nunca espera e a
+//              consumidora sempre recebe os dados publicados mais recentes.
+//
+**********************************************************************************/
+
+#ifndef DXUT_TRIPLEBUFFER_H_
+#define DXUT_TRIPLEBUFFER_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include <atomic>
+using std::atomic;
+
+// -------------------------------------------------------------------------------
+
+template<class T>
+class TripleBuffer
+{
+private:
+    static const uint Fresh = 4;                    // marca dados ainda não lidos no meio
+
+    T buffers[3];                                   // cópias dos dados
+    uint writing;                                   // cópia da produtora
+    uint reading;                                   // cópia da consumidora
+    atomic<uint> middle;                            // cópia trocada (índice | Fresh)
+
+public:
+    TripleBuffer();                                 // construtor
+
+    T & Write();                                    // cópia a preencher (produtora)
+    void Publish();                                 // publica a cópia preenchida (produtora)
+    bool Acquire();                                 // pega a publicação mais recente (consumidora)
+    const T & Read() const;                         // cópia adquirida (consumidora)
+};
+
+// -------------------------------------------------------------------------------
+// Métodos Inline
+
+template<class T>
+inline TripleBuffer<T>::TripleBuffer() : writing(0), reading(1), middle(2)
+{}
+
+// a cópia mantém o conteúdo de usos anteriores: preencha por completo
+template<class T>
+inline T & TripleBuffer<T>::Write()
+{ return buffers[writing]; }
+
+// troca a cópia preenchida pela do meio; uma publicação
+// ainda não lida é descartada e sua cópia é reaproveitada
+template<class T>
+inline void TripleBuffer<T>::Publish()
+{ writing = middle.exchange(writing | Fresh, std::memory_order_acq_rel) & 3; }
+
+// retorna falso se nada foi publicado desde a última aquisição
+// (Read continua retornando os dados adquiridos antes)
+template<class T>
+inline bool TripleBuffer<T>::Acquire()
+{
+    if (!(middle.load(std::memory_order_relaxed) & Fresh))
+        return false;
+
+    reading = middle.exchange(reading, std::memory_order_acq_rel) & 3;
+    return true;
+}
+
+// dados adquiridos pela consumidora
+template<class T>
+inline const T & TripleBuffer<T>::Read() const
+{ return buffers[reading]; }
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -1,11 +1,11 @@
 /**********************************************************************************
 // Vertex (Arquivo de Sombreamento)
 //
-// Criao:     22 Jul 2020
-// Atualizao: 08 Set 2023
+// Criação:     22 Jul 2020
+// Atualização: 08 Set 2023
 // Compilador:  Direct3D Shader Compiler (FXC)
 //
-// Descrio:   Um vertex shader que faz a transformao de vrtices
+// Descrição:   Um vertex shader que faz a transformação de vértices
 //              a partir de uma matriz combinada WorldViewProj fornecida
 //
 **********************************************************************************/
@@ -31,10 +31,10 @@ VertexOut main(VertexIn vin)
 {
     VertexOut vout;
 
-    // transforma para espao homogneo de recorte
+    // transforma para espaço homogêneo de recorte
     vout.PosH = mul(float4(vin.PosL, 1.0f), WorldViewProj);
 
-    // apenas passa a cor do vrtice para o pixel shader
+    // apenas passa a cor do vértice para o pixel shader
     vout.Color = vin.Color;
 
     return vout;
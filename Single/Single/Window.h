@@ -1,11 +1,14 @@
 /**********************************************************************************
-// Window (Arquivo de Cabealho)
+// Window (Arquivo de Cabeçalho)
 // 
-// Criao:     19 Mai 2007
-// Atualizao:	26 Jul 2023
+// Criação:     19 Mai 2007
+// Atualização:	19 Out 2026
 // Compilador:	Visual C++ 2022
 //
-// Descrio:   Abstrai os detalhes de configurao de uma janela 
+// Descrição:   Abstrai os detalhes de configuração de uma janela 
+//              No Windows cria uma janela Win32. Nas demais plataformas
+//              a janela é uma superfície fora da tela: guarda apenas o
+//              tamanho e o pedido de fechamento, sem sistema de janelas.
 //
 **********************************************************************************/
 
@@ -13,18 +16,20 @@
 #define DXUT_WINDOW_H
 
 // ---------------------------------------------------------------------------------
-// Incluses
-
-#define WIN32_LEAN_AND_MEAN
+// Inclusões
 
 #include "Types.h"       // tipos personalizados da biblioteca
-#include <windows.h>     // inclui funes do windows
-#include <windowsx.h>    // inclui extenses do windows
 #include <string>        // inclui a classe string
 using std::string;       // permite usar o tipo string sem std::
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>     // inclui funções do windows
+#include <windowsx.h>    // inclui extensões do windows
+#endif
+
 // ---------------------------------------------------------------------------------
-// Constantes globais e enumeraes
+// Constantes globais e enumerações
 
 enum WindowModes {FULLSCREEN, WINDOWED};
 enum ResizeModes {UNLOCKED, LOCKED, ASPECTRATIO};
@@ -34,19 +39,23 @@ enum ResizeModes {UNLOCKED, LOCKED, ASPECTRATIO};
 class Window
 {
 private:
+#ifdef _WIN32
     HDC          windowHdc;                 // contexto do dispositivo
-    RECT         windowRect;                // rea cliente da janela
+    RECT         windowRect;                // área cliente da janela
     HWND         windowId;                  // identificador da janela
-    int          windowWidth;               // largura da janela
-    int          windowHeight;              // altura da janela
-    HICON        windowIcon;                // cone da janela
+    HICON        windowIcon;                // ícone da janela
     HCURSOR      windowCursor;              // cursor da janela
     COLORREF     windowColor;               // cor de fundo da janela
-    string       windowTitle;               // nome da barra de ttulo
     DWORD        windowStyle;               // estilo da janela 
+#else
+    bool         windowClosed;              // fechamento pedido pela aplicação
+#endif
+    int          windowWidth;               // largura da janela
+    int          windowHeight;              // altura da janela
+    string       windowTitle;               // nome da barra de título
     int          windowMode;                // modo tela cheia, em janela ou sem borda
-    int          windowPosX;                // posio inicial da janela no eixo x
-    int          windowPosY;                // posio inicial da janela no eixo y
+    int          windowPosX;                // posição inicial da janela no eixo x
+    int          windowPosY;                // posição inicial da janela no eixo y
     int          windowCenterX;             // centro da janela no eixo x
     int          windowCenterY;             // centro da janela no eixo y
     float        windowAspectRatio;         // aspect ratio da janela
@@ -56,8 +65,8 @@ private:
     int          resizeMode;                // modo de redimensionamento da janela
     int          styleWidth;                // largura devido a bordas e barras da janela
     int          styleHeight;               // altura devido a bordas e barras da janela
-    int          windowMinWidth;            // largura mnima da janela
-    int          windowMinHeight;           // altura mnima da janela
+    int          windowMinWidth;            // largura mínima da janela
+    int          windowMinHeight;           // altura mínima da janela
  
     static void (*inFocus)();               // executar quando a janela ganhar de volta o foco
     static void (*lostFocus)();             // executar quando a janela perder o foco
@@ -68,55 +77,71 @@ public:
     Window();                               // construtor
     ~Window();                              // destrutor
 
+#ifdef _WIN32
     HWND Id();                              // retorna identificador da janela
+    COLORREF Color();                       // retorna cor de fundo da janela
+#else
+    bool Closed() const;                    // retorna se o fechamento foi pedido
+#endif
     int Width();                            // retorna largura atual da janela
     int Height();                           // retorna altura atual da janela
     int Mode() const;                       // retorna modo atual da janela
     int CenterX() const;                    // retorna centro da janela no eixo x
     int CenterY() const;                    // retorna centro da janela no eixo y
-    string Title() const;                   // retorna ttulo da janela
-    COLORREF Color();                       // retorna cor de fundo da janela
+    string Title() const;                   // retorna título da janela
     
     int ScreenWidth() const;                // retorna largura da tela
     int ScreenHeight() const;               // retorna altura da tela
     int ResizeMode() const;                 // retorna modo de redimensionamento
     int FullWidth() const;                  // retorna largura da janela com bordas
     int FullHeight() const;                 // retorna altura da janela com barras e bordas
-    int MinWidth() const;                   // retorna largura mnima da janela
-    int MinHeight() const;                  // retorna altura mnima da janela
-    float AspectRatio() const;              // retorna aspect ratio da rea interna da janela
+    int MinWidth() const;                   // retorna largura mínima da janela
+    int MinHeight() const;                  // retorna altura mínima da janela
+    float AspectRatio() const;              // retorna aspect ratio da área interna da janela
     float FullAspectRatio() const;          // retorna aspect ratio da janela com barras e bordas
 
-    void Icon(const uint icon);             // define cone da janela
+    void Icon(const uint icon);             // define ícone da janela
     void Cursor(const uint cursor);         // define cursor da janela
-    void Title(const string title);         // define ttulo da janela 
+    void Title(const string title);         // define título da janela 
     void Size(int width, int height);       // define tamanho da janela
-    void Resize(int width, int height);     // ajusta tamanho da rea interna da janela
+    void Resize(int width, int height);     // ajusta tamanho da área interna da janela
     void FullResize(int width, int height); // ajusta tamanho externo da janela
     void Mode(int mode);                    // define modo da janela
     void ResizeMode(int mode);              // define modo de redimensionamento
     void Color(int r, int g, int b);        // define cor de fundo da janela
-    void HideCursor(bool hide);             // habilita ou desabilita a exbio do cursor
+    void HideCursor(bool hide);             // habilita ou desabilita a exbição do cursor
 
     void Close();                           // fecha janela
-    void Clear();                           // limpa rea cliente
-    bool Create();                          // cria janela com a configurao estabelecida
+    void Clear();                           // limpa área cliente
+    bool Create();                          // cria janela com a configuração estabelecida
 
-    void InFocus(void(*func)());            // altera funo executada ao ganhar foco
-    void LostFocus(void(*func)());          // altera funo executada na perda do foco
+    void InFocus(void(*func)());            // altera função executada ao ganhar foco
+    void LostFocus(void(*func)());          // altera função executada na perda do foco
 
+#ifdef _WIN32
     // trata eventos do Windows
     static LRESULT CALLBACK WinProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+#endif
 };
 
 // ---------------------------------------------------------------------------------
 
-// Funes Membro Inline
+// Funções Membro Inline
 
+#ifdef _WIN32
 // retorna o identificador da janela do jogo
 inline HWND Window::Id()
 { return windowId; }
 
+// retorna a cor de fundo da janela
+inline COLORREF Window::Color()
+{ return windowColor; }
+#else
+// retorna se a aplicação pediu o fechamento da janela
+inline bool Window::Closed() const
+{ return windowClosed; }
+#endif
+
 // retorna a largura atual da janela
 inline int Window::Width() 
 { return windowWidth;  }
@@ -137,14 +162,10 @@ inline int Window::CenterX() const
 inline int Window::CenterY() const
 { return windowCenterY; }
 
-// retorna ttulo da janela
+// retorna título da janela
 inline string Window::Title() const
 { return windowTitle; }
 
-// retorna a cor de fundo da janela
-inline COLORREF Window::Color()
-{ return windowColor; }
-
 // retorna largura da tela
 inline int Window::ScreenWidth() const
 { return screenWidth; }
@@ -165,15 +186,15 @@ inline int Window::FullWidth() const
 inline int Window::FullHeight() const
 { return fullHeight; }
 
-// retorna largura mnima da janela
+// retorna largura mínima da janela
 inline int Window::MinWidth() const
 { return windowMinWidth; }
 
-// retorna altura mnima da janela
+// retorna altura mínima da janela
 inline int Window::MinHeight() const
 { return windowMinHeight; }
 
-// retorna aspect ratio da rea interna da janela
+// retorna aspect ratio da área interna da janela
 inline float Window::AspectRatio() const
 { return windowAspectRatio; }
 
@@ -183,7 +204,13 @@ inline float Window::FullAspectRatio() const
 
 // ----------------------------------------------------------
 
-// define o cone da janela
+// define o título da janela 
+inline void Window::Title(const string title)
+{ windowTitle = title; }
+
+#ifdef _WIN32
+
+// define o ícone da janela
 inline void Window::Icon(const uint icon)    
 { windowIcon = LoadIcon(GetModuleHandle(NULL), MAKEINTRESOURCE(icon)); }
 
@@ -191,15 +218,11 @@ inline void Window::Icon(const uint icon)
 inline void Window::Cursor(const uint cursor)
 { windowCursor = LoadCursor(GetModuleHandle(NULL), MAKEINTRESOURCE(cursor)); }
 
-// define o ttulo da janela 
-inline void Window::Title(const string title)
-{ windowTitle = title; }
-
 // define a cor de fundo da janela
 inline void Window::Color(int r, int g, int b)    
 { windowColor = RGB(r,g,b); }
 
-// habilita ou desabilita a exbio do cursor
+// habilita ou desabilita a exbição do cursor
 inline void Window::HideCursor(bool hide)
 { ShowCursor(!hide); }
 
@@ -209,17 +232,44 @@ inline void Window::HideCursor(bool hide)
 inline void Window::Close()
 { PostMessage(windowId, WM_DESTROY, 0, 0); }
 
-// limpa a rea cliente
+// limpa a área cliente
 inline void Window::Clear()
 { FillRect(windowHdc, &windowRect, CreateSolidBrush(Color())); }
 
+#else
+
+// superfície fora da tela: ícone, cursor e cor de fundo não são exibidos
+inline void Window::Icon(const uint)
+{}
+
+inline void Window::Cursor(const uint)
+{}
+
+inline void Window::Color(int, int, int)
+{}
+
+inline void Window::HideCursor(bool)
+{}
+
+// ----------------------------------------------------------
+
+// pede o fechamento: o laço do motor encerra na próxima drenagem
+inline void Window::Close()
+{ windowClosed = true; }
+
+// não há área cliente a limpar
+inline void Window::Clear()
+{}
+
+#endif
+
 // ----------------------------------------------------------
 
-// altera funo executada no ganho de foco
+// altera função executada no ganho de foco
 inline void Window::InFocus(void(*func)())                
 { inFocus = func; }
 
-// altera funo executada na perda de foco
+// altera função executada na perda de foco
 inline void Window::LostFocus(void(*func)())
 { lostFocus = func; }
 
@@ -0,0 +1,277 @@
+/**********************************************************************************
+// CopyBatchesTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Simula as filas de cópia e de desenho da GPU para verificar
+//              os lotes de cópia de Graphics: a fila de desenho só começa
+//              depois dos lotes que seus recursos exigem, um alocador só é
+//              reiniciado depois do seu último lote e cada lote é aguardado
+//              uma vez. Compara os engasgos ao transmitir 100 MB de malhas
+//              pela fila de cópia e pela cópia na lista principal com espera
+//              completa da GPU (caminho antigo). Com --bench mostra os tempos.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "CopyBatches.h"
+#include <algorithm>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// parâmetros da simulação (tempos em milissegundos)
+struct Setup
+{
+    double period = 1000.0 / 60.0;      // período alvo do quadro
+    double work = 4.0;                  // CPU por quadro (Update e Draw)
+    double render = 6.0;                // fila de desenho por quadro
+    double memcpy = 10.0;               // MB por ms copiados pela CPU para o upload
+    double copy = 12.0;                 // MB por ms da fila de cópia
+    double sync = 0.1;                  // submissão e espera completa da GPU
+    double mesh = 0.0625;               // tamanho de cada malha em MB (64 KB)
+    uint total = 1600;                  // malhas transmitidas (100 MB)
+    uint perFrame = 80;                 // malhas enviadas por quadro (5 MB)
+    uint drawDelay = 0;                 // quadros entre envio e primeiro desenho
+};
+
+// resultado da simulação
+struct Outcome
+{
+    vector<double> frames;              // duração de cada quadro
+    double streaming = 0.0;             // tempo até a última malha ficar pronta
+    uint hitches = 0;                   // quadros acima do período
+    bool ordered = true;                // desenhos nunca antes das suas cópias
+    bool reused = true;                 // alocadores reiniciados só após seus lotes
+};
+
+// -------------------------------------------------------------------------------
+
+// fila de cópia simulada: lotes terminam em ordem
+struct FakeCopyQueue
+{
+    vector<double> end = { 0.0 };       // fim de cada lote (lote 0 = nenhum)
+    double free = 0.0;                  // fila livre a partir deste instante
+
+    ullong Completed(double now) const
+    {
+        ullong batch = 0;
+        while (batch + 1 < end.size() && end[batch + 1] <= now)
+            ++batch;
+        return batch;
+    }
+};
+
+// -------------------------------------------------------------------------------
+
+// caminho novo: lotes na fila de cópia, fila de desenho espera só o exigido
+static Outcome Batched(const Setup & s)
+{
+    Outcome out;
+    CopyBatches batches;
+    FakeCopyQueue copyQueue;
+    vector<ullong> meshBatch;
+    vector<ullong> allocBatch(CopyBatches::Allocators, 0);
+
+    double start = 0.0;
+    double gpuFree = 0.0;
+
+    for (uint frame = 0; meshBatch.size() < s.total || frame < 2 + s.drawDelay; ++frame)
+    {
+        double cpu = start;
+        double bytes = 0.0;
+
+        // envia as malhas do quadro
+        for (uint i = 0; i < s.perFrame && meshBatch.size() < s.total; ++i)
+        {
+            if (!batches.Open())
+            {
+                uint index;
+                ullong reuse = batches.Begin(index);
+
+                // o último lote do alocador precisa ter terminado
+                out.reused = out.reused && reuse == allocBatch[index];
+                if (copyQueue.Completed(cpu) < reuse)
+                    cpu = copyQueue.end[reuse];
+                allocBatch[index] = batches.Current();
+            }
+
+            cpu += s.mesh / s.memcpy;
+            bytes += s.mesh;
+            meshBatch.push_back(batches.Current());
+        }
+
+        // desenha as malhas enviadas há drawDelay quadros ou mais
+        size_t drawable = frame >= s.drawDelay ? std::min<size_t>(meshBatch.size(), size_t(frame - s.drawDelay + 1) * s.perFrame) : 0;
+        for (size_t m = 0; m < drawable; ++m)
+            batches.Require(meshBatch[m]);
+
+        cpu += s.work;
+
+        // ExecuteCommands: submete o lote e espera apenas o exigido
+        if (batches.Open())
+        {
+            ullong batch = batches.Submit();
+            double copyStart = std::max(cpu, copyQueue.free);
+            copyQueue.free = copyStart + bytes / s.copy;
+            copyQueue.end.push_back(copyQueue.free);
+            out.ordered = out.ordered && batch == copyQueue.end.size() - 1;
+        }
+
+        double gpuStart = std::max(cpu, gpuFree);
+        ullong required = batches.Wait();
+        if (required && copyQueue.Completed(gpuStart) < required)
+            gpuStart = copyQueue.end[required];
+
+        for (size_t m = 0; m < drawable; ++m)
+            out.ordered = out.ordered && copyQueue.end[meshBatch[m]] <= gpuStart;
+
+        // o motor espera a GPU no fim do quadro
+        gpuFree = gpuStart + s.render;
+        double end = gpuFree;
+
+        out.frames.push_back(end - start);
+        start = std::max(end, start + s.period);
+    }
+
+    out.streaming = copyQueue.free;
+    for (double f : out.frames)
+        out.hitches += f > s.period;
+    return out;
+}
+
+// -------------------------------------------------------------------------------
+
+// caminho antigo: cada malha copiada na lista principal com espera completa
+static Outcome Direct(const Setup & s)
+{
+    Outcome out;
+    double start = 0.0;
+    uint sent = 0;
+
+    for (uint frame = 0; sent < s.total || frame < 2 + s.drawDelay; ++frame)
+    {
+        double cpu = start;
+
+        for (uint i = 0; i < s.perFrame && sent < s.total; ++i, ++sent)
+        {
+            cpu += s.mesh / s.memcpy;
+            cpu += s.mesh / s.copy + s.sync;
+            out.streaming = cpu;
+        }
+
+        cpu += s.work;
+        double end = cpu + s.render;
+
+        out.frames.push_back(end - start);
+        start = std::max(end, start + s.period);
+    }
+
+    for (double f : out.frames)
+        out.hitches += f > s.period;
+    return out;
+}
+
+// -------------------------------------------------------------------------------
+
+// lotes, alocadores e esperas sem a simulação
+static void TestBatches()
+{
+    CopyBatches batches;
+    CHECK(!batches.Open());
+    CHECK(batches.Wait() == 0);
+
+    // três lotes ocupam os três alocadores; o quarto reusa o primeiro
+    ullong reuse[4];
+    uint index[4];
+    for (uint i = 0; i < 4; ++i)
+    {
+        reuse[i] = batches.Begin(index[i]);
+        CHECK(batches.Open());
+        CHECK(batches.Current() == i + 1);
+        CHECK(batches.Submit() == i + 1);
+        CHECK(!batches.Open());
+    }
+
+    CHECK(reuse[0] == 0 && reuse[1] == 0 && reuse[2] == 0);
+    CHECK(index[3] == index[0] && reuse[3] == 1);
+    CHECK(batches.Submitted() == 4);
+
+    // o maior lote exigido é aguardado uma única vez
+    batches.Require(2);
+    batches.Require(1);
+    CHECK(batches.Wait() == 2);
+    CHECK(batches.Wait() == 0);
+    batches.Require(2);
+    CHECK(batches.Wait() == 0);
+    batches.Require(4);
+    CHECK(batches.Wait() == 4);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestStreaming()
+{
+    for (uint delay : { 0u, 2u })
+    {
+        Setup setup;
+        setup.drawDelay = delay;
+
+        Outcome batched = Batched(setup);
+        Outcome direct = Direct(setup);
+
+        CHECK(batched.ordered);
+        CHECK(batched.reused);
+
+        // 5 MB por quadro cabem no quadro pela fila de cópia, não pela principal
+        CHECK(batched.hitches == 0);
+        CHECK(direct.hitches > 0);
+    }
+
+    // um envio grande demais para o período ainda respeita as barreiras
+    Setup burst;
+    burst.perFrame = 800;
+    Outcome batched = Batched(burst);
+    CHECK(batched.ordered);
+    CHECK(batched.reused);
+}
+
+// -------------------------------------------------------------------------------
+
+static void Show(const char * name, Outcome out)
+{
+    std::sort(out.frames.begin(), out.frames.end());
+    auto percentile = [&](double p) { return out.frames[size_t(p * (out.frames.size() - 1))]; };
+
+    printf("  %-22s P50 %6.2f ms  P99 %6.2f ms  máx %6.2f ms  engasgos %3u/%zu  100 MB em %6.1f ms\n",
+        name, percentile(0.5), percentile(0.99), out.frames.back(), out.hitches, out.frames.size(), out.streaming);
+}
+
+// transmissão de 100 MB em malhas de 64 KB com vários ritmos de envio
+static void BenchStreaming()
+{
+    for (uint perFrame : { 40u, 80u, 160u })
+    {
+        Setup setup;
+        setup.perFrame = perFrame;
+        printf("%.1f MB por quadro:\n", perFrame * setup.mesh);
+        Show("fila de cópia", Batched(setup));
+        Show("lista principal", Direct(setup));
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestBatches();
+    TestStreaming();
+
+    if (Bench(argc, argv))
+        BenchStreaming();
+
+    return Result("CopyBatchesTest");
+}
@@ -0,0 +1,211 @@
+/**********************************************************************************
+// EdgesTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica Geometry::ExtractEdges contra uma referência com
+//              conjunto de arestas: cada aresta não degenerada do original
+//              aparece uma única vez, com o menor índice primeiro, também no
+//              caminho paralelo das malhas grandes. Verifica ainda a
+//              convivência com grupos e níveis de detalhe nos índices. Com
+//              --bench mostra as primitivas economizadas no arame e a vazão
+//              da extração.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <set>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// arestas não degeneradas do original com o menor índice primeiro
+static std::set<std::pair<uint, uint>> Reference(const Geometry & g)
+{
+    std::set<std::pair<uint, uint>> edges;
+    uint count = g.OriginalCount() / 3 * 3;
+    for (uint i = 0; i < count; ++i)
+    {
+        uint a = g.indices[i], b = g.indices[i % 3 == 2 ? i - 2 : i + 1];
+        if (a != b)
+            edges.insert({ std::min(a, b), std::max(a, b) });
+    }
+    return edges;
+}
+
+// lista de linhas igual à referência, sem repetições e após o original
+static bool Matches(const Geometry & g, const std::set<std::pair<uint, uint>> & reference)
+{
+    const EdgeList & list = g.edges;
+    if (list.indexCount != 2 * reference.size() || list.startIndex < g.OriginalCount()
+        || list.startIndex + list.indexCount > g.IndexCount())
+        return false;
+
+    std::set<std::pair<uint, uint>> found;
+    for (uint i = list.startIndex; i < list.startIndex + list.indexCount; i += 2)
+    {
+        uint a = g.indices[i], b = g.indices[i + 1];
+        if (a >= b || !found.insert({ a, b }).second)
+            return false;
+    }
+    return found == reference;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestUnique()
+{
+    vector<Geometry> shapes;
+    for (const char * name : Models)
+        shapes.push_back(LoadModel(name));
+    shapes.push_back(Box(1.0f, 2.0f, 3.0f));
+    shapes.push_back(Sphere(1.0f, 40, 40));
+    shapes.push_back(Cylinder(1.0f, 0.5f, 3.0f, 20, 10));
+    shapes.push_back(GeoSphere(1.0f, 3));
+    shapes.push_back(Grid(3.0f, 2.0f, 7, 5));
+
+    for (const Geometry & shape : shapes)
+    {
+        Geometry g = shape;
+        g.ExtractEdges();
+        CHECK(Matches(g, Reference(shape)));
+        CHECK(g.OriginalCount() == shape.IndexCount());
+        CHECK(std::equal(shape.indices.begin(), shape.indices.end(), g.indices.begin()));
+
+        // extrair de novo substitui a lista anterior
+        vector<uint> indices = g.indices;
+        g.ExtractEdges();
+        CHECK(g.indices == indices);
+    }
+
+    // malha fechada: 3 arestas por 2 triângulos; grade: interior e contorno
+    Geometry closed = GeoSphere(1.0f, 0);
+    closed.ExtractEdges();
+    CHECK(closed.edges.indexCount / 2 == 30);
+    Geometry grid = Grid(1.0f, 1.0f, 4, 5);
+    grid.ExtractEdges();
+    CHECK(grid.edges.indexCount / 2 == 3 * 5 + 4 * 4 + 3 * 4);
+
+    // triângulos degenerados só contribuem as arestas não degeneradas
+    Geometry degenerate;
+    degenerate.vertices.resize(4);
+    degenerate.indices = { 0, 1, 2, 2, 2, 3, 1, 1, 1 };
+    degenerate.ExtractEdges();
+    CHECK(Matches(degenerate, Reference(degenerate)) && degenerate.edges.indexCount == 2 * 4);
+
+    // sem triângulos não há lista
+    Geometry empty;
+    empty.ExtractEdges();
+    CHECK(empty.edges.indexCount == 0 && empty.indices.empty());
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestParallel()
+{
+    // a partir de 32k triângulos as arestas são separadas em grupos paralelos
+    Sphere sphere(1.0f, 200, 120);
+    Grid grid(1.0f, 1.0f, 300, 301);
+    for (Geometry * g : { (Geometry *) &sphere, (Geometry *) &grid })
+    {
+        CHECK(g->IndexCount() / 3 >= (1u << 15));
+        Geometry parallel = *g;
+        parallel.ExtractEdges();
+        CHECK(Matches(parallel, Reference(*g)));
+
+        // com o conjunto ocupado os mesmos blocos rodam na thread atual
+        Geometry serial = *g;
+        ThreadPool::Shared().Run(2, 2, [&](uint chunk, uint, uint)
+        {
+            if (chunk == 0)
+                serial.ExtractEdges();
+        });
+        CHECK(serial.indices == parallel.indices);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestLayout()
+{
+    Sphere sphere(1.0f, 40, 40);
+    uint original = sphere.IndexCount();
+    std::set<std::pair<uint, uint>> reference = Reference(sphere);
+
+    // grupos depois das arestas continuam apontando para os seus índices
+    sphere.Clusterize();
+    vector<uint> clustered(sphere.indices.begin() + original, sphere.indices.end());
+    auto same = [&]
+    {
+        uint start = sphere.meshlets.front().startIndex;
+        return std::equal(clustered.begin(), clustered.end(), sphere.indices.begin() + start);
+    };
+
+    sphere.ExtractEdges();
+    CHECK(Matches(sphere, reference) && sphere.edges.startIndex == original + uint(clustered.size()) && same());
+
+    sphere.Clusterize();
+    CHECK(Matches(sphere, reference) && sphere.edges.startIndex == original && same());
+
+    sphere.ExtractEdges();
+    CHECK(Matches(sphere, reference) && sphere.IndexCount() == original + clustered.size() + 2 * reference.size() && same());
+
+    // simplificar descarta a lista, que pode ser refeita
+    sphere.Simplify(2);
+    CHECK(sphere.edges.indexCount == 0 && sphere.OriginalCount() == original);
+    sphere.ExtractEdges();
+    CHECK(Matches(sphere, reference) && sphere.edges.startIndex == sphere.IndexCount() - sphere.edges.indexCount);
+}
+
+// -------------------------------------------------------------------------------
+
+// primitivas do arame com linhas no lugar dos triângulos e vazão da extração
+static void BenchEdges()
+{
+    vector<Geometry> shapes;
+    vector<const char *> names;
+    for (const char * name : Models)
+    {
+        shapes.push_back(LoadModel(name));
+        names.push_back(name);
+    }
+    shapes.push_back(Sphere(1.0f, 708, 708));
+    names.push_back("Sphere 708");
+    shapes.push_back(Grid(1.0f, 1.0f, 709, 709));
+    names.push_back("Grid 709");
+    shapes.push_back(GeoSphere(1.0f, 6));
+    names.push_back("GeoSphere 6");
+
+    printf("ExtractEdges (%u threads):\n", ThreadPool::Shared().Size());
+    for (uint i = 0; i < shapes.size(); ++i)
+    {
+        Geometry & g = shapes[i];
+        uint triangles = g.IndexCount() / 3;
+        double time = Best(triangles < 100000 ? 50 : 3, [&] { g.ExtractEdges(); });
+        uint lines = g.edges.indexCount / 2;
+
+        printf("  %-12s %8u triângulos  %8u linhas no lugar de %8u segmentos (%4.1f%% a menos)  %7.2f ms  %6.2f Mtri/s\n",
+            names[i], triangles, lines, 3 * triangles, 100.0 * (1.0 - double(lines) / (3.0 * triangles)),
+            time * 1e3, triangles / time * 1e-6);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestUnique();
+    TestParallel();
+    TestLayout();
+
+    if (Bench(argc, argv))
+        BenchEdges();
+
+    return Result("EdgesTest");
+}
@@ -0,0 +1,348 @@
+/**********************************************************************************
+// GeneratorTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica que os geradores vetorizados de Sphere, Cylinder e
+//              Grid produzem bit a bit os mesmos vértices e índices que as
+//              versões escalares anteriores, mantidas aqui como referência,
+//              inclusive nas sobras dos laços de 4 em 4 e na geração em
+//              faixas de linhas das grades grandes. Verifica também as
+//              tabelas prontas na compilação de Box, Quad e GeoSphere contra
+//              a montagem em execução. Com --bench compara os construtores
+//              com as referências de 20x20 a 4096x4096 e mede a construção
+//              das formas de topologia fixa.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Geometry.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// -------------------------------------------------------------------------------
+// Referências: construtores anteriores aos geradores vetorizados e às tabelas prontas
+
+static Geometry ReferenceCylinder(float bottom, float top, float height, uint sliceCount, uint stackCount)
+{
+    Geometry g;
+    float stackHeight = height / stackCount;
+    float radiusStep = (top - bottom) / stackCount;
+    uint ringCount = stackCount + 1;
+
+    for (uint i = 0; i < ringCount; ++i)
+    {
+        float y = -0.5f * height + i * stackHeight;
+        float r = bottom + i * radiusStep;
+        float theta = 2.0f * XM_PI / sliceCount;
+
+        for (uint j = 0; j <= sliceCount; ++j)
+        {
+            float c = cosf(j * theta);
+            float s = sinf(j * theta);
+            g.vertices.push_back({ XMFLOAT3(r * c, y, r * s), XMFLOAT4(Colors::Yellow) });
+        }
+    }
+
+    uint ringVertexCount = sliceCount + 1;
+    for (uint i = 0; i < stackCount; ++i)
+        for (uint j = 0; j < sliceCount; ++j)
+            g.indices.insert(g.indices.end(), {
+                i * ringVertexCount + j, (i + 1) * ringVertexCount + j, (i + 1) * ringVertexCount + j + 1,
+                i * ringVertexCount + j, (i + 1) * ringVertexCount + j + 1, i * ringVertexCount + j + 1 });
+
+    for (uint k = 0; k < 2; ++k)
+    {
+        uint baseIndex = uint(g.vertices.size());
+        float y = (k - 0.5f) * height;
+        float theta = 2.0f * XM_PI / sliceCount;
+        float r = (k ? top : bottom);
+
+        for (uint i = 0; i <= sliceCount; i++)
+            g.vertices.push_back({ XMFLOAT3(r * cosf(i * theta), y, r * sinf(i * theta)), XMFLOAT4(Colors::Yellow) });
+
+        g.vertices.push_back({ XMFLOAT3(0.0f, y, 0.0f), XMFLOAT4(Colors::Yellow) });
+        uint centerIndex = uint(g.vertices.size() - 1);
+
+        for (uint i = 0; i < sliceCount; ++i)
+            g.indices.insert(g.indices.end(), { centerIndex, baseIndex + i + k, baseIndex + i + 1 - k });
+    }
+    return g;
+}
+
+static Geometry ReferenceSphere(float radius, uint sliceCount, uint stackCount)
+{
+    Geometry g;
+    g.vertices.push_back({ XMFLOAT3(0.0f, radius, 0.0f), XMFLOAT4(Colors::Yellow) });
+
+    float phiStep = XM_PI / stackCount;
+    float thetaStep = 2.0f * XM_PI / sliceCount;
+
+    for (uint i = 1; i <= stackCount - 1; ++i)
+    {
+        float phi = i * phiStep;
+        for (uint j = 0; j <= sliceCount; ++j)
+        {
+            float theta = j * thetaStep;
+            Vertex v;
+            v.pos.x = radius * sinf(phi) * cosf(theta);
+            v.pos.y = radius * cosf(phi);
+            v.pos.z = radius * sinf(phi) * sinf(theta);
+            v.color = XMFLOAT4(Colors::Yellow);
+            g.vertices.push_back(v);
+        }
+    }
+
+    g.vertices.push_back({ XMFLOAT3(0.0f, -radius, 0.0f), XMFLOAT4(Colors::Yellow) });
+
+    for (uint i = 1; i <= sliceCount; ++i)
+        g.indices.insert(g.indices.end(), { 0, i + 1, i });
+
+    uint baseIndex = 1;
+    uint ringVertexCount = sliceCount + 1;
+    for (uint i = 0; i < stackCount - 2; ++i)
+        for (uint j = 0; j < sliceCount; ++j)
+            g.indices.insert(g.indices.end(), {
+                baseIndex + i * ringVertexCount + j, baseIndex + i * ringVertexCount + j + 1, baseIndex + (i + 1) * ringVertexCount + j,
+                baseIndex + (i + 1) * ringVertexCount + j, baseIndex + i * ringVertexCount + j + 1, baseIndex + (i + 1) * ringVertexCount + j + 1 });
+
+    uint southPoleIndex = uint(g.vertices.size()) - 1;
+    baseIndex = southPoleIndex - ringVertexCount;
+    for (uint i = 0; i < sliceCount; ++i)
+        g.indices.insert(g.indices.end(), { southPoleIndex, baseIndex + i, baseIndex + i + 1 });
+    return g;
+}
+
+static Geometry ReferenceGrid(float width, float depth, uint m, uint n)
+{
+    Geometry g;
+    float halfWidth = 0.5f * width;
+    float halfDepth = 0.5f * depth;
+    float dx = width / (n - 1);
+    float dz = depth / (m - 1);
+
+    g.vertices.resize(size_t(m) * n);
+    for (uint i = 0; i < m; ++i)
+    {
+        float z = halfDepth - i * dz;
+        for (uint j = 0; j < n; ++j)
+        {
+            float x = -halfWidth + j * dx;
+            g.vertices[size_t(i) * n + j] = { XMFLOAT3(x, 0.0f, z), XMFLOAT4(Colors::Yellow) };
+        }
+    }
+
+    g.indices.resize(size_t(m - 1) * (n - 1) * 6);
+    size_t k = 0;
+    for (uint i = 0; i < m - 1; ++i)
+        for (uint j = 0; j < n - 1; ++j, k += 6)
+        {
+            g.indices[k] = i * n + j;
+            g.indices[k + 1] = i * n + j + 1;
+            g.indices[k + 2] = (i + 1) * n + j;
+            g.indices[k + 3] = (i + 1) * n + j;
+            g.indices[k + 4] = i * n + j + 1;
+            g.indices[k + 5] = (i + 1) * n + j + 1;
+        }
+    return g;
+}
+
+static Geometry ReferenceBox(float width, float height, float depth)
+{
+    Geometry g;
+    float w = 0.5f * width;
+    float h = 0.5f * height;
+    float d = 0.5f * depth;
+
+    const XMFLOAT3 corners[8] =
+    {
+        XMFLOAT3(-w, -h, -d), XMFLOAT3(-w, +h, -d), XMFLOAT3(+w, +h, -d), XMFLOAT3(+w, -h, -d),
+        XMFLOAT3(-w, -h, +d), XMFLOAT3(-w, +h, +d), XMFLOAT3(+w, +h, +d), XMFLOAT3(+w, -h, +d)
+    };
+    for (const XMFLOAT3 & p : corners)
+        g.vertices.push_back({ p, XMFLOAT4(Colors::Yellow) });
+
+    g.indices = { 0, 1, 2, 0, 2, 3, 4, 7, 5, 7, 6, 5, 4, 5, 1, 4, 1, 0,
+                  3, 2, 6, 3, 6, 7, 1, 5, 6, 1, 6, 2, 4, 0, 3, 4, 3, 7 };
+    return g;
+}
+
+static Geometry ReferenceQuad(float width, float height)
+{
+    Geometry g;
+    float w = 0.5f * width;
+    float h = 0.5f * height;
+
+    const XMFLOAT3 corners[4] = { XMFLOAT3(-w, -h, 0.0f), XMFLOAT3(-w, +h, 0.0f), XMFLOAT3(+w, +h, 0.0f), XMFLOAT3(+w, -h, 0.0f) };
+    for (const XMFLOAT3 & p : corners)
+        g.vertices.push_back({ p, XMFLOAT4(Colors::Yellow) });
+
+    g.indices = { 0, 1, 2, 0, 2, 3, 2, 1, 0, 3, 2, 0 };
+    return g;
+}
+
+static Geometry ReferenceGeoSphere(float radius, uint subdivisions)
+{
+    Geometry g;
+    const float X = 0.525731f;
+    const float Z = 0.850651f;
+
+    const XMFLOAT3 pos[12] =
+    {
+        XMFLOAT3(-X, 0.0f, Z),  XMFLOAT3(X, 0.0f, Z),
+        XMFLOAT3(-X, 0.0f, -Z), XMFLOAT3(X, 0.0f, -Z),
+        XMFLOAT3(0.0f, Z, X),   XMFLOAT3(0.0f, Z, -X),
+        XMFLOAT3(0.0f, -Z, X),  XMFLOAT3(0.0f, -Z, -X),
+        XMFLOAT3(Z, X, 0.0f),   XMFLOAT3(-Z, X, 0.0f),
+        XMFLOAT3(Z, -X, 0.0f),  XMFLOAT3(-Z, -X, 0.0f)
+    };
+
+    g.indices = { 1,4,0,  4,9,0,  4,5,9,  8,5,4,  1,8,4,
+                  1,10,8, 10,3,8, 8,3,5,  3,2,5,  3,7,2,
+                  3,10,7, 10,6,7, 6,11,7, 6,0,11, 6,1,0,
+                  10,1,6, 11,0,9, 2,11,9, 5,2,9,  11,2,7 };
+
+    g.vertices.resize(12);
+    for (uint i = 0; i < 12; ++i)
+        g.vertices[i].pos = pos[i];
+
+    for (uint i = 0; i < subdivisions; ++i)
+        g.Subdivide();
+
+    for (Vertex & v : g.vertices)
+    {
+        XMStoreFloat3(&v.pos, XMVectorScale(XMVector3Normalize(XMLoadFloat3(&v.pos)), radius));
+        v.color = XMFLOAT4(Colors::Yellow);
+    }
+    return g;
+}
+
+// -------------------------------------------------------------------------------
+
+// mesmos vértices e índices, bit a bit
+static bool Same(const Geometry & a, const Geometry & b)
+{
+    return a.vertices.size() == b.vertices.size() && a.indices == b.indices
+        && memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Vertex)) == 0;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestGenerators()
+{
+    // tamanhos que deixam sobras de 1 a 3 nos laços de 4 em 4
+    const uint sizes[] = { 3, 4, 5, 6, 7, 8, 9, 20, 31, 64, 101 };
+
+    for (uint slices : sizes)
+        for (uint stacks : sizes)
+        {
+            CHECK(Same(Sphere(1.5f, slices, stacks), ReferenceSphere(1.5f, slices, stacks)));
+            CHECK(Same(Cylinder(1.0f, 0.5f, 3.0f, slices, stacks), ReferenceCylinder(1.0f, 0.5f, 3.0f, slices, stacks)));
+            CHECK(Same(Grid(3.0f, 2.0f, slices, stacks), ReferenceGrid(3.0f, 2.0f, slices, stacks)));
+        }
+
+    // cilindro fechado em cone e as formas da cena do Multi
+    CHECK(Same(Cylinder(1.0f, 0.0f, 2.0f, 17, 5), ReferenceCylinder(1.0f, 0.0f, 2.0f, 17, 5)));
+    CHECK(Same(Sphere(1.0f, 20, 20), ReferenceSphere(1.0f, 20, 20)));
+    CHECK(Same(Cylinder(1.0f, 0.5f, 3.0f, 20, 10), ReferenceCylinder(1.0f, 0.5f, 3.0f, 20, 10)));
+
+    // a partir de 2^20 vértices a grade é gerada em faixas de linhas
+    CHECK(Same(Grid(100.0f, 50.0f, 1023, 1025), ReferenceGrid(100.0f, 50.0f, 1023, 1025)));
+    CHECK(Same(Grid(100.0f, 100.0f, 1025, 1027), ReferenceGrid(100.0f, 100.0f, 1025, 1027)));
+    CHECK(Same(Grid(10.0f, 500.0f, 4099, 257), ReferenceGrid(10.0f, 500.0f, 4099, 257)));
+}
+
+// maior diferença entre as posições de duas geometrias com os mesmos índices
+static float Distance(const Geometry & a, const Geometry & b)
+{
+    if (a.vertices.size() != b.vertices.size() || a.indices != b.indices)
+        return 1e30f;
+
+    float worst = 0.0f;
+    for (size_t i = 0; i < a.vertices.size(); ++i)
+    {
+        const XMFLOAT3 & p = a.vertices[i].pos;
+        const XMFLOAT3 & q = b.vertices[i].pos;
+        worst = std::max(worst, std::max(std::fabs(p.x - q.x), std::max(std::fabs(p.y - q.y), std::fabs(p.z - q.z))));
+    }
+    return worst;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestTables()
+{
+    // tabelas de Box e Quad: os mesmos vértices e índices da montagem anterior
+    CHECK(Same(Box(1.0f, 1.0f, 1.0f), ReferenceBox(1.0f, 1.0f, 1.0f)));
+    CHECK(Same(Box(2.0f, 3.5f, 0.25f), ReferenceBox(2.0f, 3.5f, 0.25f)));
+    CHECK(Same(Quad(1.0f, 1.0f), ReferenceQuad(1.0f, 1.0f)));
+    CHECK(Same(Quad(7.0f, 0.3f), ReferenceQuad(7.0f, 0.3f)));
+
+    // níveis 0 a 3 da GeoSphere vêm prontos da compilação e os maiores
+    // continuam a partir do nível 3 plano: mesma topologia e posições
+    // iguais às da subdivisão em execução até o arredondamento da raiz
+    for (uint level = 0; level <= 6; ++level)
+        for (float radius : { 1.0f, 0.5f, 3.0f })
+        {
+            Geometry table = GeoSphere(radius, level);
+            Geometry runtime = ReferenceGeoSphere(radius, level);
+            CHECK(Distance(table, runtime) <= 2e-7f * radius);
+            CHECK(memcmp(&table.vertices[0].color, &runtime.vertices[0].color, sizeof(XMFLOAT4)) == 0);
+        }
+
+    // subdivisões acima de 6 são limitadas
+    CHECK(GeoSphere(1.0f, 9).IndexCount() == GeoSphere(1.0f, 6).IndexCount());
+}
+
+// -------------------------------------------------------------------------------
+
+// construtores contra as referências escalares
+static void BenchGenerators()
+{
+    printf("Geração em ms (referência -> atual):\n");
+    for (uint n : { 20u, 64u, 256u, 1024u, 4096u })
+    {
+        uint repeats = n <= 256 ? 20 : n <= 1024 ? 3 : 1;
+        double sphere[2] = { Best(repeats, [&] { ReferenceSphere(1.0f, n, n); }), Best(repeats, [&] { Sphere(1.0f, n, n); }) };
+        double cylinder[2] = { Best(repeats, [&] { ReferenceCylinder(1.0f, 0.5f, 3.0f, n, n); }), Best(repeats, [&] { Cylinder(1.0f, 0.5f, 3.0f, n, n); }) };
+        double grid[2] = { Best(repeats, [&] { ReferenceGrid(3.0f, 3.0f, n, n); }), Best(repeats, [&] { Grid(3.0f, 3.0f, n, n); }) };
+
+        printf("  %4ux%-4u  sphere %9.3f -> %9.3f  cylinder %9.3f -> %9.3f  grid %9.3f -> %9.3f\n", n, n,
+            sphere[0] * 1e3, sphere[1] * 1e3, cylinder[0] * 1e3, cylinder[1] * 1e3, grid[0] * 1e3, grid[1] * 1e3);
+    }
+
+    // formas de topologia fixa: montagem anterior contra as tabelas prontas
+    const uint shapes = 10000;
+    double box[2] = { Best(5, [] { for (uint i = 0; i < shapes; ++i) ReferenceBox(1.0f, 2.0f, 3.0f); }),
+                      Best(5, [] { for (uint i = 0; i < shapes; ++i) Box(1.0f, 2.0f, 3.0f); }) };
+    double quad[2] = { Best(5, [] { for (uint i = 0; i < shapes; ++i) ReferenceQuad(1.0f, 2.0f); }),
+                       Best(5, [] { for (uint i = 0; i < shapes; ++i) Quad(1.0f, 2.0f); }) };
+    printf("Construção em ns (referência -> atual):\n  box %.0f -> %.0f  quad %.0f -> %.0f\n",
+        box[0] / shapes * 1e9, box[1] / shapes * 1e9, quad[0] / shapes * 1e9, quad[1] / shapes * 1e9);
+
+    printf("  geosphere:");
+    for (uint level = 0; level <= 4; ++level)
+    {
+        uint repeats = level < 3 ? 1000 : 20;
+        double time[2] = { Best(5, [&] { for (uint i = 0; i < repeats; ++i) ReferenceGeoSphere(1.0f, level); }),
+                           Best(5, [&] { for (uint i = 0; i < repeats; ++i) GeoSphere(1.0f, level); }) };
+        printf("  %u: %.1f -> %.1f us", level, time[0] / repeats * 1e6, time[1] / repeats * 1e6);
+    }
+    printf("\n");
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestGenerators();
+    TestTables();
+
+    if (Bench(argc, argv))
+        BenchGenerators();
+
+    return Result("GeneratorTest");
+}
@@ -0,0 +1,320 @@
+/**********************************************************************************
+// HalfEdgeTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica HalfEdgeMesh contra uma referência com mapa de
+//              arestas: opostas, anéis de vizinhos, valências, contornos de
+//              borda, arestas com mais de dois triângulos e a volta para
+//              Geometry sem perdas, também no pareamento paralelo das malhas
+//              grandes. Verifica ainda a divisão das normais nos vincos, que
+//              percorre os leques pelas semi-arestas. Com --bench mede a
+//              construção nos modelos do Multi e em malhas de um milhão de
+//              triângulos.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "HalfEdge.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// toro fechado de n x n quadrados (2n² triângulos, sem bordas)
+static Geometry Torus(uint n)
+{
+    Geometry g;
+    g.vertices.resize(size_t(n) * n);
+    for (uint i = 0; i < n; ++i)
+        for (uint j = 0; j < n; ++j)
+        {
+            float u = 6.2831853f * i / n, v = 6.2831853f * j / n;
+            g.vertices[size_t(i) * n + j].pos = XMFLOAT3((2.0f + std::cos(v)) * std::cos(u), std::sin(v), (2.0f + std::cos(v)) * std::sin(u));
+
+            uint a = i * n + j, b = i * n + (j + 1) % n;
+            uint c = ((i + 1) % n) * n + j, d = ((i + 1) % n) * n + (j + 1) % n;
+            g.indices.insert(g.indices.end(), { a, c, b, b, c, d });
+        }
+    return g;
+}
+
+// semi-arestas erradas em relação a uma referência com mapa de arestas
+static uint Mismatches(const Geometry & g, const HalfEdgeMesh & mesh)
+{
+    uint count = g.OriginalCount();
+    auto next = [](uint h) { return h % 3 == 2 ? h - 2 : h + 1; };
+
+    std::map<std::pair<uint, uint>, vector<uint>> edges;
+    for (uint h = 0; h < count; ++h)
+        edges[{ g.indices[h], g.indices[next(h)] }].push_back(h);
+
+    // a oposta de a->b é a única b->a, se a->b também é única
+    uint wrong = 0;
+    for (uint h = 0; h < count; ++h)
+    {
+        uint a = g.indices[h], b = g.indices[next(h)];
+        auto back = edges.find({ b, a });
+        uint expected = a != b && edges[{ a, b }].size() == 1 && back != edges.end() && back->second.size() == 1
+            ? back->second[0] : HalfEdgeMesh::Invalid;
+
+        wrong += mesh.Twin(h) != expected;
+        wrong += mesh.Origin(h) != a || mesh.Target(h) != b || mesh.Face(h) != h / 3;
+        wrong += mesh.Next(mesh.Prev(h)) != h || mesh.Next(mesh.Next(mesh.Next(h))) != h;
+        if (mesh.Twin(h) != HalfEdgeMesh::Invalid)
+            wrong += mesh.Twin(mesh.Twin(h)) != h;
+    }
+    return wrong;
+}
+
+// vértices com anel diferente do conjunto de vizinhos (malhas sem arestas repetidas)
+static uint RingMismatches(const Geometry & g, const HalfEdgeMesh & mesh)
+{
+    uint count = g.OriginalCount();
+    vector<std::set<uint>> neighbors(g.vertices.size());
+    for (uint h = 0; h < count; ++h)
+    {
+        uint a = g.indices[h], b = g.indices[h % 3 == 2 ? h - 2 : h + 1];
+        neighbors[a].insert(b);
+        neighbors[b].insert(a);
+    }
+
+    uint wrong = 0;
+    vector<uint> ring;
+    for (uint v = 0; v < mesh.VertexCount(); ++v)
+    {
+        mesh.Ring(v, ring);
+        std::set<uint> unique(ring.begin(), ring.end());
+        wrong += unique != neighbors[v] || unique.size() != ring.size() || mesh.Valence(v) != ring.size();
+        wrong += mesh.Edge(v) != HalfEdgeMesh::Invalid && mesh.Origin(mesh.Edge(v)) != v;
+    }
+    return wrong;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestAdjacency()
+{
+    // malhas fechadas, abertas, com vértices repetidos nas costuras e
+    // costuras abertas (a esfera geodésica subdividida repete os vértices em cada triângulo)
+    vector<Geometry> shapes;
+    for (const char * name : Models)
+        shapes.push_back(LoadModel(name));
+    shapes.push_back(GeoSphere(1.0f, 2));
+    shapes.push_back(Torus(16));
+    shapes.push_back(Grid(2.0f, 2.0f, 9, 13));
+    shapes.push_back(Sphere(1.0f, 12, 8));
+    shapes.push_back(Cylinder(1.0f, 0.5f, 2.0f, 10, 3));
+
+    for (const Geometry & g : shapes)
+    {
+        HalfEdgeMesh mesh(g);
+        CHECK(mesh.FaceCount() == g.IndexCount() / 3 && mesh.VertexCount() == g.VertexCount());
+        CHECK(Mismatches(g, mesh) == 0);
+
+        // os modelos têm vértices com mais de um leque, e o anel percorre um só
+        if (&g - shapes.data() >= std::ptrdiff_t(std::size(Models)))
+            CHECK(RingMismatches(g, mesh) == 0);
+
+        // volta sem perdas
+        Geometry back = mesh.ToGeometry();
+        CHECK(back.indices == g.indices && back.vertices.size() == g.vertices.size());
+        CHECK(std::equal(back.vertices.begin(), back.vertices.end(), g.vertices.begin(),
+            [](const Vertex & a, const Vertex & b) { return a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.pos.z == b.pos.z; }));
+    }
+
+    // malhas fechadas não têm borda
+    CHECK(HalfEdgeMesh(GeoSphere(1.0f, 0)).BoundaryCount() == 0);
+    CHECK(HalfEdgeMesh(GeoSphere(1.0f, 2)).BoundaryCount() > 0);
+    CHECK(HalfEdgeMesh(Torus(16)).BoundaryCount() == 0);
+
+    // contorno da grade: uma volta só, com todas as semi-arestas de borda
+    Grid grid(2.0f, 2.0f, 9, 13);
+    HalfEdgeMesh mesh(grid);
+    CHECK(mesh.BoundaryCount() == 2 * (8 + 12) && mesh.NonManifoldCount() == 0);
+
+    uint start = HalfEdgeMesh::Invalid;
+    for (uint h = 0; h < mesh.HalfEdgeCount() && start == HalfEdgeMesh::Invalid; ++h)
+        if (mesh.Boundary(h))
+            start = h;
+
+    uint length = 0;
+    bool linked = true;
+    for (uint h = start; length == 0 || h != start; h = mesh.NextBoundary(h))
+    {
+        linked = linked && mesh.Boundary(mesh.NextBoundary(h)) && mesh.Origin(mesh.NextBoundary(h)) == mesh.Target(h);
+        if (++length > mesh.HalfEdgeCount())
+            break;
+    }
+    CHECK(linked && length == mesh.BoundaryCount());
+
+    // cantos da grade têm 2 ou 3 vizinhos, o interior 6
+    CHECK(mesh.BoundaryVertex(0) && !mesh.BoundaryVertex(13 + 1));
+    CHECK(mesh.Valence(13 + 1) == 6);
+    CHECK(mesh.Valence(0) == 2 || mesh.Valence(0) == 3);
+
+    // três triângulos na mesma aresta e uma aresta degenerada ficam sem par
+    Geometry fin;
+    fin.vertices.resize(6);
+    fin.indices = { 0, 1, 2, 1, 0, 3, 0, 1, 4, 5, 5, 2 };
+    HalfEdgeMesh fins(fin);
+    CHECK(Mismatches(fin, fins) == 0);
+    CHECK(fins.NonManifoldCount() == 3 + 1);
+    CHECK(fins.Twin(0) == HalfEdgeMesh::Invalid && fins.Twin(3) == HalfEdgeMesh::Invalid);
+
+    // apenas o original entra: níveis de detalhe e arestas ficam de fora
+    Sphere detailed(1.0f, 16, 16);
+    uint original = detailed.IndexCount();
+    detailed.Simplify(2);
+    detailed.ExtractEdges();
+    CHECK(HalfEdgeMesh(detailed).HalfEdgeCount() == original);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestParallel()
+{
+    // a partir de 64k semi-arestas o pareamento roda em blocos paralelos
+    Geometry torus = Torus(200);
+    HalfEdgeMesh mesh(torus);
+    CHECK(mesh.HalfEdgeCount() >= (1u << 16));
+    CHECK(Mismatches(torus, mesh) == 0 && mesh.BoundaryCount() == 0);
+    CHECK(RingMismatches(torus, mesh) == 0);
+
+    Sphere sphere(1.0f, 160, 120);
+    HalfEdgeMesh poles(sphere);
+    CHECK(Mismatches(sphere, poles) == 0);
+    CHECK(poles.Valence(0) == 160 + 1);
+
+    // reconstruir reaproveita o objeto
+    mesh.Build(Grid(1.0f, 1.0f, 4, 4));
+    CHECK(mesh.FaceCount() == 18 && mesh.BoundaryCount() == 12);
+}
+
+// -------------------------------------------------------------------------------
+
+// normais divididas nos vincos percorrendo os leques pelas semi-arestas
+static void TestCreases()
+{
+    // cubo com cantos compartilhados: cada canto vira três vértices
+    Box box(2.0f, 2.0f, 2.0f);
+    box.ComputeNormals(NORMALS_ANGLE, 60.0f);
+    CHECK(box.VertexCount() == 24 && box.normals.size() == 24);
+
+    bool axis = true;
+    for (uint i = 0; i < box.IndexCount(); i += 3)
+    {
+        // cada face tem a normal do seu lado, nos três cantos
+        XMFLOAT3 n = box.normals[box.indices[i]];
+        float largest = std::max(std::fabs(n.x), std::max(std::fabs(n.y), std::fabs(n.z)));
+        for (uint k = 1; k < 3; ++k)
+        {
+            const XMFLOAT3 & m = box.normals[box.indices[i + k]];
+            axis = axis && m.x == n.x && m.y == n.y && m.z == n.z;
+        }
+        axis = axis && std::fabs(largest - 1.0f) < 1e-6f;
+    }
+    CHECK(axis);
+
+    // sem vinco: normais suavizadas nos 8 cantos
+    Box smooth(2.0f, 2.0f, 2.0f);
+    smooth.ComputeNormals(NORMALS_ANGLE, 180.0f);
+    CHECK(smooth.VertexCount() == 8);
+    CHECK(std::fabs(std::fabs(smooth.normals[0].x) - 0.57735f) < 1e-4f);
+
+    // esfera geodésica: superfície suave não é dividida
+    GeoSphere sphere(1.0f, 3);
+    uint vertices = sphere.VertexCount();
+    sphere.ComputeNormals(NORMALS_ANGLE, 30.0f);
+    CHECK(sphere.VertexCount() == vertices);
+
+    // a divisão segue o leque: no vértice de um cone baixo faces vizinhas
+    // diferem 8 graus e opostas 53 graus; com vinco de 30 graus o leque
+    // continua inteiro e o vértice não é dividido
+    Geometry cone;
+    cone.vertices.push_back({ XMFLOAT3(0.0f, 0.5f, 0.0f), XMFLOAT4() });
+    for (uint i = 0; i < 20; ++i)
+    {
+        float angle = 6.2831853f * i / 20;
+        cone.vertices.push_back({ XMFLOAT3(std::cos(angle), 0.0f, std::sin(angle)), XMFLOAT4() });
+        cone.indices.insert(cone.indices.end(), { 0, 1 + (i + 1) % 20, 1 + i });
+    }
+    cone.ComputeNormals(NORMALS_ANGLE, 30.0f);
+    CHECK(cone.VertexCount() == 21);
+    CHECK(std::fabs(cone.normals[0].y - 1.0f) < 1e-5f);
+
+    // com vinco de 5 graus cada face do vértice fica com a sua normal
+    cone.normals.clear();
+    cone.vertices.resize(21);
+    cone.ComputeNormals(NORMALS_ANGLE, 5.0f);
+    CHECK(cone.VertexCount() == 21 + 19 + 20);
+}
+
+// -------------------------------------------------------------------------------
+
+// construção nos modelos do Multi e em malhas de um milhão de triângulos
+static void BenchBuild()
+{
+    vector<Geometry> shapes;
+    vector<const char *> names;
+    for (const char * name : Models)
+    {
+        shapes.push_back(LoadModel(name));
+        names.push_back(name);
+    }
+    shapes.push_back(Sphere(1.0f, 708, 708));
+    names.push_back("Sphere 708");
+    shapes.push_back(Grid(1.0f, 1.0f, 709, 709));
+    names.push_back("Grid 709");
+    shapes.push_back(Torus(708));
+    names.push_back("Torus 708");
+
+    printf("HalfEdgeMesh (pareamento com mapa de arestas para comparar):\n");
+    for (uint i = 0; i < shapes.size(); ++i)
+    {
+        const Geometry & g = shapes[i];
+        uint triangles = g.IndexCount() / 3;
+        uint repeats = triangles < 100000 ? 50 : 3;
+
+        HalfEdgeMesh mesh;
+        double build = Best(repeats, [&] { mesh.Build(g); });
+
+        // referência: cada semi-aresta procura a oposta num mapa
+        double map = Best(1, [&]
+        {
+            std::map<std::pair<uint, uint>, uint> edges;
+            for (uint h = 0; h < g.IndexCount(); ++h)
+                edges[{ g.indices[h], g.indices[h % 3 == 2 ? h - 2 : h + 1] }] = h;
+            uint paired = 0;
+            for (const auto & e : edges)
+                paired += edges.count({ e.first.second, e.first.first }) != 0;
+            mesh.Twin(paired % mesh.HalfEdgeCount());
+        });
+
+        printf("  %-12s %8u triângulos  %8.2f ms  %6.2f Mtri/s  mapa %8.2f ms\n",
+            names[i], triangles, build * 1e3, triangles / build * 1e-6, map * 1e3);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestAdjacency();
+    TestParallel();
+    TestCreases();
+
+    if (Bench(argc, argv))
+        BenchBuild();
+
+    return Result("HalfEdgeTest");
+}
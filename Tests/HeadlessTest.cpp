@@ -0,0 +1,550 @@
+/**********************************************************************************
+// HeadlessTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Roda a Engine fora do Windows sobre o dispositivo gráfico
+//              nulo: a execução sem janela desenha o número pedido de
+//              quadros, os comandos gravados em paralelo chegam ao Present
+//              e o laço principal termina quando a aplicação fecha a janela.
+//              A latência da entrada vai da geração do evento ao Present e
+//              os passos fixos não dependem da taxa de quadros. Uma sessão
+//              gravada e reproduzida duas vezes chega ao mesmo estado. Sob
+//              demanda, sem entrada nada é desenhado e cada evento ou
+//              Invalidate desenha exatamente um quadro. Com --bench mede a
+//              gravação de 10 mil e 100 mil desenhos, a vazão com e sem a
+//              thread de desenho, os quadros e a CPU sob demanda e a
+//              reprodução.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Engine.h"
+#include "PipelineCache.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <ctime>
+
+// -------------------------------------------------------------------------------
+
+// aplicação que grava draws desenhos por quadro
+class Scene : public App
+{
+public:
+    static uint draws;                      // desenhos gravados por quadro
+    static uint closeAt;                    // quadro em que a janela é fechada (0 = nunca)
+    static uint updates;                    // chamadas de Update
+    static uint frames;                     // chamadas de Draw
+    static uint moves;                      // movimentos do mouse recebidos
+    static uint drawMs;                     // duração artificial de Draw (ms)
+    static uint steps;                      // chamadas de FixedUpdate
+    static uint animated;                   // quadros pedidos com Invalidate (Init pede o primeiro)
+    static double position;                 // posição simulada nos passos fixos
+    static std::atomic<ullong> recorded;    // desenhos gravados em todos os quadros
+
+    void Init()
+    {
+        if (animated)
+            Engine::Invalidate();
+    }
+
+    void Finalize() {}
+
+    void FixedUpdate()
+    {
+        ++steps;
+        position += 6.0 * fixedTime;
+    }
+
+    void Update()
+    {
+        ++updates;
+        moves += uint(input->Events().size());
+
+        if (updates < animated)
+            Engine::Invalidate();
+
+        if (closeAt && updates == closeAt)
+            window->Close();
+    }
+
+    void Draw()
+    {
+        ++frames;
+        std::this_thread::sleep_for(std::chrono::milliseconds(drawMs));
+        graphics->Clear();
+        graphics->Record(draws, [](NullCommandList * cmdList, uint first, uint last)
+        {
+            for (uint i = first; i < last; ++i)
+            {
+                uint constants[16] = { i };
+                cmdList->SetGraphicsRoot32BitConstants(0, 16, constants, 0);
+                cmdList->DrawIndexedInstanced(36, 1, 0, 0, 0);
+            }
+            recorded += last - first;
+        });
+        graphics->Present();
+    }
+};
+
+uint Scene::draws = 0;
+uint Scene::closeAt = 0;
+uint Scene::updates = 0;
+uint Scene::frames = 0;
+uint Scene::moves = 0;
+uint Scene::drawMs = 0;
+uint Scene::steps = 0;
+uint Scene::animated = 0;
+double Scene::position = 0.0;
+std::atomic<ullong> Scene::recorded{ 0 };
+
+static void Reset(uint draws, uint closeAt = 0)
+{
+    Scene::draws = draws;
+    Scene::closeAt = closeAt;
+    Scene::updates = 0;
+    Scene::frames = 0;
+    Scene::moves = 0;
+    Scene::drawMs = 0;
+    Scene::steps = 0;
+    Scene::animated = 0;
+    Scene::position = 0.0;
+    Scene::recorded = 0;
+}
+
+// aplicação que anda com as teclas e acumula os movimentos do mouse:
+// o estado depende apenas da entrada e do número de quadros
+class Walker : public App
+{
+public:
+    static uint session;                    // quadros com entrada postada (0 = nenhum)
+
+    uint updates = 0;                       // chamadas de Update
+    double x = 0.0;                         // posição controlada por A e D
+    double z = 0.0;                         // posição controlada por S e W
+    llong mouse = 0;                        // resumo dos movimentos recebidos
+
+    void Init() {}
+    void Finalize() {}
+
+    void FixedUpdate()
+    {
+        x += (int(input->KeyDown('D')) - int(input->KeyDown('A'))) * 3.0 * fixedTime;
+        z += (int(input->KeyDown('W')) - int(input->KeyDown('S'))) * 2.0 * fixedTime;
+    }
+
+    void Update()
+    {
+        ++updates;
+
+        // usuário roteirizado: teclas seguradas por 8 quadros e movimentos
+        // do mouse, todos liberados antes do fim da sessão
+        if (updates < session)
+        {
+            static const int keys[4] = { 'D', 'W', 'A', 'S' };
+            int key = keys[(updates / 16) % 4];
+            if (updates % 16 == 1 && updates + 8 < session)
+                Input::Post({ 0, key, true });
+            if (updates % 16 == 9)
+                Input::Post({ 0, key, false });
+            if (updates % 5 == 0)
+                Input::Post({ 0, 0, false, INPUT_MOVE, int(updates * 7 % 400), int(updates * 3 % 300) });
+        }
+
+        for (const InputEvent & e : input->Events())
+            if (e.type == INPUT_MOVE)
+                mouse = mouse * 31 + e.x * 1000 + e.y + llong(updates);
+    }
+
+    void Draw()
+    {
+        graphics->Clear();
+        graphics->Present();
+    }
+
+    ullong Hash()
+    {
+        ullong hash = PipelineCache::Hash(&x, sizeof(x));
+        hash = PipelineCache::Hash(&z, sizeof(z), hash);
+        hash = PipelineCache::Hash(&mouse, sizeof(mouse), hash);
+        return PipelineCache::Hash(&updates, sizeof(updates), hash);
+    }
+};
+
+uint Walker::session = 0;
+
+// executa a aplicação com passo fixo e quadros de duração fixa
+static ullong Run(const vector<InputEvent> & script, uint frames)
+{
+    Engine * engine = new Engine();
+    Engine::FixedStep(1.0 / 120.0);
+    Walker * walker = new Walker();
+    engine->Script(script);
+    engine->Headless(walker, frames, 0.0, 1.0 / 60.0);
+    Engine::FixedStep(0.0);
+
+    ullong hash = walker->Hash();
+    delete engine;
+    return hash;
+}
+
+// grava uma sessão de usuário roteirizado e relê o arquivo
+static vector<InputEvent> Session(uint frames, ullong & hash)
+{
+    // eventos que sobraram na fila de execuções anteriores ficam de fora
+    Input::Poll();
+    Input::NextFrame();
+
+    Walker::session = frames - 20;
+    Input::Record(true);
+    hash = Run({}, frames);
+    Input::Record(false);
+    Walker::session = 0;
+
+    vector<InputEvent> events;
+    CHECK(Input::Save("HeadlessTest.input"));
+    CHECK(Input::Load("HeadlessTest.input", events));
+    std::remove("HeadlessTest.input");
+    return events;
+}
+
+// -------------------------------------------------------------------------------
+
+// execução sem janela: todos os quadros chegam ao dispositivo nulo
+static void TestHeadless()
+{
+    const uint frames = 60;
+    const uint draws = 1000;
+    Reset(draws);
+
+    // 600 quadros/s dão tempo ao gerador de postar eventos entre os quadros
+    Engine * engine = new Engine();
+    Engine::FrameRate(600.0);
+    engine->Synthetic(2000);
+    CHECK(engine->Headless(new Scene(), frames) == 0);
+    Engine::FrameRate(0.0);
+
+    CHECK(Scene::updates == frames);
+    CHECK(Scene::frames == frames);
+    CHECK(Scene::recorded == ullong(frames) * draws);
+    CHECK(Engine::graphics->Frames() == frames);
+
+    // dois comandos por desenho, mais a abertura e o fechamento do quadro
+    CHECK(Engine::graphics->Commands() > ullong(frames) * draws * 2);
+    CHECK(Engine::graphics->Bytes() >= ullong(frames) * draws * (12 + 16 * 4 + 20));
+
+    // os movimentos postados pelo gerador chegam às aplicações
+    CHECK(Scene::moves > 0);
+
+    delete engine;
+}
+
+// -------------------------------------------------------------------------------
+
+// laço principal termina quando a aplicação fecha a janela
+static void TestLoop()
+{
+    Reset(64, 10);
+
+    Engine * engine = new Engine();
+    CHECK(engine->Start(new Scene()) == 0);
+
+    CHECK(Scene::updates == 10);
+    CHECK(Scene::frames == 10);
+    CHECK(Engine::graphics->Frames() == 10);
+
+    delete engine;
+}
+
+// -------------------------------------------------------------------------------
+
+// latência inclui a espera na fila e o desenho, também na thread de desenho
+static void TestLatency()
+{
+    // evento gerado antes da execução: a espera na fila conta
+    Reset(16);
+    Engine * engine = new Engine();
+    double generated = Clock::Seconds() - 0.05;
+    Input::Post({ 0, 0, false, INPUT_MOVE, 1, 2, generated });
+    engine->Headless(new Scene(), 1);
+    CHECK(engine->Latency().size() == 1);
+    CHECK(!engine->Latency().empty() && engine->Latency()[0] >= 0.05);
+    delete engine;
+
+    // o quadro só termina depois de Draw e Present, com ou sem thread de desenho
+    for (bool threaded : { false, true })
+    {
+        Reset(16);
+        Scene::drawMs = 3;
+
+        // um evento na fila garante amostras mesmo se o gerador
+        // não for escalonado durante os quadros (núcleo ocupado)
+        engine = new Engine();
+        Engine::RenderThread(threaded);
+        engine->Synthetic(1000);
+        Input::Post({ 0, 0, false, INPUT_MOVE, 1, 2, Clock::Seconds() });
+        engine->Headless(new Scene(), 20);
+        Engine::RenderThread(false);
+
+        CHECK(!engine->Latency().empty());
+        for (double latency : engine->Latency())
+            CHECK(latency >= 0.003);
+
+        delete engine;
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+// passos fixos: mesmo estado em qualquer taxa de quadros e atraso descartado
+static void TestFixedStep()
+{
+    const double step = 1.0 / 64.0;
+    double positions[2];
+    uint i = 0;
+
+    // um segundo a 32 e a 128 quadros por segundo
+    for (uint frames : { 32u, 128u })
+    {
+        Reset(16);
+        Engine * engine = new Engine();
+        Engine::FixedStep(step);
+        engine->Headless(new Scene(), frames, 0.0, 1.0 / frames);
+
+        CHECK(Scene::updates == frames);
+        CHECK(Scene::steps == 64);
+        CHECK(Engine::interpolation == 0.0);
+        positions[i++] = Scene::position;
+        delete engine;
+    }
+    CHECK(positions[0] == positions[1] && positions[0] == 6.0);
+
+    // quadros de um segundo executam no máximo 5 passos cada
+    Reset(16);
+    Engine * engine = new Engine();
+    Engine::FixedStep(step, 5);
+    engine->Headless(new Scene(), 3, 0.0, 1.0);
+    CHECK(Scene::steps == 15);
+    delete engine;
+
+    // sem passo fixo: um passo por quadro
+    Reset(16);
+    engine = new Engine();
+    Engine::FixedStep(0.0);
+    engine->Headless(new Scene(), 10);
+    CHECK(Scene::steps == 10 && Engine::interpolation == 1.0);
+    delete engine;
+}
+
+// -------------------------------------------------------------------------------
+
+// sob demanda: quadros apenas após entrada, roteiro ou Invalidate
+static uint OnDemand(uint frames, const vector<InputEvent> & script = {}, uint postAfterMs = 0)
+{
+    Engine * engine = new Engine();
+    engine->Script(script);
+
+    // evento postado por outra thread durante a espera
+    std::thread poster;
+    if (postAfterMs)
+        poster = std::thread([postAfterMs]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(postAfterMs));
+            Input::Post({ 0, 0, false, INPUT_MOVE, 7, 8, Clock::Seconds() });
+        });
+
+    // quadros de 2 ms: cada quadro ocioso espera 2 ms por eventos
+    engine->Headless(new Scene(), frames, 0.0, 1.0 / 500.0);
+    if (poster.joinable())
+        poster.join();
+
+    uint presented = uint(Engine::graphics->Frames());
+    delete engine;
+    return presented;
+}
+
+static void TestOnDemand()
+{
+    Engine::OnDemand(true);
+
+    // sem entrada e sem Invalidate nada é desenhado
+    Reset(16);
+    CHECK(OnDemand(30) == 0);
+    CHECK(Scene::updates == 0 && Scene::frames == 0);
+
+    // Invalidate em Init: exatamente um quadro
+    Reset(16);
+    Scene::animated = 1;
+    CHECK(OnDemand(30) == 1);
+    CHECK(Scene::updates == 1 && Scene::frames == 1);
+
+    // animação: cada Invalidate em Update pede mais um quadro
+    Reset(16);
+    Scene::animated = 4;
+    CHECK(OnDemand(30) == 4 && Scene::frames == 4);
+
+    // evento na fila antes da execução: exatamente um quadro
+    Reset(16);
+    Input::Post({ 0, 0, false, INPUT_MOVE, 1, 2, Clock::Seconds() });
+    CHECK(OnDemand(30) == 1);
+    CHECK(Scene::moves == 1);
+
+    // evento postado durante a espera acorda o laço: exatamente um quadro
+    Reset(16);
+    CHECK(OnDemand(200, {}, 20) == 1);
+    CHECK(Scene::moves == 1);
+
+    // evento roteirizado no quadro 10: exatamente um quadro
+    Reset(16);
+    CHECK(OnDemand(30, { { 10, 0, false, INPUT_MOVE, 3, 4 } }) == 1);
+    CHECK(Scene::moves == 1);
+
+    // fora do modo sob demanda todos os quadros são desenhados
+    Engine::OnDemand(false);
+    Reset(16);
+    CHECK(OnDemand(30) == 30 && Scene::frames == 30);
+}
+
+// -------------------------------------------------------------------------------
+
+// sessão gravada e reproduzida duas vezes: o mesmo estado final
+static void TestReplay()
+{
+    const uint frames = 300;
+
+    // sessão original: a entrada chega pela fila, como a do usuário
+    ullong recorded;
+    vector<InputEvent> events = Session(frames, recorded);
+    CHECK(events.size() > 50 && events.front().frame > 0 && events.back().frame < frames);
+
+    // as reproduções aplicam o roteiro nos mesmos quadros
+    ullong first = Run(events, frames);
+    ullong second = Run(events, frames);
+    CHECK(first == second);
+    CHECK(first == recorded);
+
+    // sem a entrada o estado é outro
+    CHECK(Run({}, frames) != first);
+}
+
+// -------------------------------------------------------------------------------
+
+// tempo de gravação por quadro com 10 mil e 100 mil desenhos
+static void BenchRecord()
+{
+    for (uint draws : { 10000u, 100000u })
+    {
+        Reset(draws);
+
+        Engine * engine = new Engine();
+        engine->Headless(new Scene(), 200);
+
+        double best = Best(20, [] { Engine::app->Draw(); });
+        printf("Gravação de %u desenhos: %.3f ms por quadro (%u listas)\n",
+            draws, best * 1000.0, Engine::graphics->Recorders());
+
+        delete engine;
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+// Update e Draw caros (4 ms cada): com a thread de desenho os dois se sobrepõem
+static void BenchPipeline()
+{
+    const uint frames = 120;
+    for (bool threaded : { false, true })
+    {
+        Reset(1000);
+        Engine * engine = new Engine();
+        Engine::Workload(0.004);
+        Engine::RenderThread(threaded);
+
+        Timer timer;
+        timer.Start();
+        engine->Headless(new Scene(), frames);
+        double elapsed = timer.Elapsed();
+
+        Engine::RenderThread(false);
+        Engine::Workload(0.0);
+        printf("%s: %.1f quadros/s (%.2f ms por quadro)\n",
+            threaded ? "Thread de desenho" : "Thread única", frames / elapsed, elapsed / frames * 1000.0);
+
+        delete engine;
+    }
+}
+
+// um segundo a 60 quadros/s parado e com 10 movimentos do mouse por segundo:
+// quadros desenhados e ocupação da CPU com e sem o modo sob demanda
+static void BenchOnDemand()
+{
+    for (uint moves : { 0u, 10u })
+        for (bool demand : { false, true })
+        {
+            Reset(1000);
+            Engine * engine = new Engine();
+            Engine::OnDemand(demand);
+            Engine::FrameRate(60.0);
+            engine->Synthetic(moves);
+
+            std::clock_t cpu = std::clock();
+            double start = Clock::Seconds();
+            engine->Headless(new Scene(), 0, 1.0);
+            double wall = Clock::Seconds() - start;
+            double usage = 100.0 * double(std::clock() - cpu) / CLOCKS_PER_SEC / wall;
+
+            Engine::FrameRate(0.0);
+            Engine::OnDemand(false);
+            printf("%s, %2u movimentos/s: %3u quadros desenhados em %.2f s, CPU %5.1f%%\n",
+                demand ? "Sob demanda" : "Contínuo   ", moves, Scene::frames, wall, usage);
+
+            delete engine;
+        }
+}
+
+// -------------------------------------------------------------------------------
+
+// reprodução de uma sessão longa: leitura do arquivo e quadros por segundo
+static void BenchReplay()
+{
+    const uint frames = 20000;
+    ullong recorded;
+    vector<InputEvent> events = Session(frames, recorded);
+
+    vector<InputEvent> loaded;
+    Input::Save("HeadlessTest.input");
+    double load = Best(5, [&] { Input::Load("HeadlessTest.input", loaded); });
+    std::remove("HeadlessTest.input");
+
+    ullong hashes[2];
+    double replay = Best(1, [&] { hashes[0] = Run(events, frames); });
+    hashes[1] = Run(events, frames);
+    printf("Reprodução de %u quadros com %zu eventos: leitura %.3f ms, %.0f quadros/s, estado %s\n",
+        frames, events.size(), load * 1000.0, frames / replay,
+        hashes[0] == hashes[1] && hashes[0] == recorded ? "igual ao gravado" : "diferente");
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestHeadless();
+    TestLoop();
+    TestLatency();
+    TestFixedStep();
+    TestOnDemand();
+    TestReplay();
+
+    if (Bench(argc, argv))
+    {
+        BenchRecord();
+        BenchPipeline();
+        BenchOnDemand();
+        BenchReplay();
+    }
+
+    return Result("HeadlessTest");
+}
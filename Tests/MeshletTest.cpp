@@ -0,0 +1,306 @@
+/**********************************************************************************
+// MeshletTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica os grupos de Geometry::Clusterize e o descarte de
+//              MeshletCuller: os grupos respeitam os limites de vértices e
+//              triângulos, cobrem exatamente os triângulos do original, e
+//              suas esferas e cones contêm os vértices e as normais. O
+//              descarte é conservador: todo triângulo descartado está de
+//              costas para a câmera ou fora do volume de visão. Com --bench
+//              mostra as estatísticas dos grupos, a vazão da construção e a
+//              fração de triângulos descartados nos modelos do Multi.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "Meshlet.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// triângulos de uma faixa, rotacionados para começar pelo menor índice
+static vector<std::array<uint, 3>> Triangles(const Geometry & geometry, uint start, uint count)
+{
+    vector<std::array<uint, 3>> triangles;
+    for (uint i = start; i < start + count; i += 3)
+    {
+        std::array<uint, 3> t = { geometry.indices[i], geometry.indices[i + 1], geometry.indices[i + 2] };
+        std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+        triangles.push_back(t);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// normal não normalizada do triângulo que começa no índice i
+static XMFLOAT3 Normal(const Geometry & geometry, uint i)
+{
+    const XMFLOAT3 & a = geometry.vertices[geometry.indices[i]].pos;
+    const XMFLOAT3 & b = geometry.vertices[geometry.indices[i + 1]].pos;
+    const XMFLOAT3 & c = geometry.vertices[geometry.indices[i + 2]].pos;
+    float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+    float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+    return XMFLOAT3(uy * vz - uz * vy, uz * vx - ux * vz, ux * vy - uy * vx);
+}
+
+// geometrias verificadas: modelos do Multi e formas da biblioteca
+static vector<Geometry> Shapes()
+{
+    vector<Geometry> shapes;
+    for (const char * name : Models)
+        shapes.push_back(LoadModel(name));
+    shapes.push_back(Sphere(1.0f, 64, 64));
+    shapes.push_back(Cylinder(1.0f, 0.5f, 3.0f, 40, 20));
+    shapes.push_back(Grid(4.0f, 4.0f, 50, 50));
+    return shapes;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestClusters()
+{
+    for (Geometry & geometry : Shapes())
+    {
+        uint original = geometry.IndexCount();
+        CHECK(original > 0);
+        geometry.Clusterize();
+        CHECK(!geometry.meshlets.empty());
+
+        // grupos em sequência depois do original, cobrindo os mesmos triângulos
+        uint expected = original;
+        bool limits = true, sequence = true, counted = true, bounded = true, cone = true;
+        for (const Meshlet & m : geometry.meshlets)
+        {
+            sequence = sequence && m.startIndex == expected && m.indexCount > 0 && m.indexCount % 3 == 0;
+            limits = limits && m.vertexCount <= 64 && m.indexCount / 3 <= 124;
+            expected += m.indexCount;
+
+            vector<uint> distinct(geometry.indices.begin() + m.startIndex, geometry.indices.begin() + m.startIndex + m.indexCount);
+            std::sort(distinct.begin(), distinct.end());
+            counted = counted && std::unique(distinct.begin(), distinct.end()) - distinct.begin() == m.vertexCount;
+
+            // esfera contém os vértices e o cone contém as normais
+            float spread = std::sqrt(1.0f - m.coneCutoff * m.coneCutoff);
+            for (uint i = m.startIndex; i < m.startIndex + m.indexCount; i += 3)
+            {
+                for (uint k = 0; k < 3; ++k)
+                {
+                    const XMFLOAT3 & p = geometry.vertices[geometry.indices[i + k]].pos;
+                    float dx = p.x - m.center.x, dy = p.y - m.center.y, dz = p.z - m.center.z;
+                    bounded = bounded && std::sqrt(dx * dx + dy * dy + dz * dz) <= m.radius * 1.0001f + 1e-6f;
+                }
+
+                XMFLOAT3 n = Normal(geometry, i);
+                float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+                if (m.coneCutoff < 1.0f && length > 0.0f)
+                    cone = cone && (n.x * m.coneAxis.x + n.y * m.coneAxis.y + n.z * m.coneAxis.z) / length >= spread - 1e-4f;
+            }
+        }
+
+        CHECK(sequence && limits && counted && bounded && cone);
+        CHECK(expected == geometry.IndexCount());
+        CHECK(Triangles(geometry, 0, original) == Triangles(geometry, original, original));
+
+        // agrupar de novo refaz os grupos no mesmo lugar
+        vector<uint> indices = geometry.indices;
+        geometry.Clusterize();
+        CHECK(geometry.indices == indices);
+    }
+
+    // limites menores produzem mais grupos, sempre dentro dos limites
+    Sphere sphere(1.0f, 32, 32);
+    sphere.Clusterize(16, 20);
+    bool small = true;
+    for (const Meshlet & m : sphere.meshlets)
+        small = small && m.vertexCount <= 16 && m.indexCount / 3 <= 20;
+    CHECK(small && sphere.meshlets.size() >= sphere.OriginalCount() / 3 / 20);
+
+    // níveis de detalhe e arestas continuam válidos depois dos grupos
+    Sphere detailed(1.0f, 32, 32);
+    detailed.Simplify(2);
+    detailed.ExtractEdges();
+    vector<LevelOfDetail> lods = detailed.lods;
+    vector<uint> lines(detailed.indices.begin() + detailed.edges.startIndex,
+                       detailed.indices.begin() + detailed.edges.startIndex + detailed.edges.indexCount);
+    detailed.Clusterize();
+    detailed.Clusterize();
+    CHECK(detailed.lods.size() == lods.size() && detailed.lods.back().indexCount == lods.back().indexCount);
+    CHECK(detailed.OriginalCount() == lods[0].indexCount);
+    CHECK(vector<uint>(detailed.indices.begin() + detailed.edges.startIndex,
+                       detailed.indices.begin() + detailed.edges.startIndex + detailed.edges.indexCount) == lines);
+}
+
+// -------------------------------------------------------------------------------
+
+// matriz combinada transposta de uma câmera em eye olhando para target
+static XMFLOAT4X4 Camera(const XMFLOAT3 & eye, const XMFLOAT3 & target)
+{
+    XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(eye.x, eye.y, eye.z, 1.0f),
+        XMVectorSet(target.x, target.y, target.z, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+    XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 16.0f / 9.0f, 0.5f, 100.0f);
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, XMMatrixTranspose(view * proj));
+    return m;
+}
+
+// triângulo de costas para eye ou inteiramente fora de um plano de recorte
+static bool Hidden(const Geometry & geometry, uint i, const XMFLOAT4X4 & m, const XMFLOAT3 & eye)
+{
+    const XMFLOAT3 & a = geometry.vertices[geometry.indices[i]].pos;
+    XMFLOAT3 n = Normal(geometry, i);
+    if (n.x * (eye.x - a.x) + n.y * (eye.y - a.y) + n.z * (eye.z - a.z) <= 1e-6f)
+        return true;
+
+    for (uint plane = 0; plane < 6; ++plane)
+    {
+        bool all = true;
+        for (uint k = 0; k < 3 && all; ++k)
+        {
+            const XMFLOAT3 & p = geometry.vertices[geometry.indices[i + k]].pos;
+            float clip[4];
+            for (uint r = 0; r < 4; ++r)
+                clip[r] = m.m[r][0] * p.x + m.m[r][1] * p.y + m.m[r][2] * p.z + m.m[r][3];
+
+            float d = plane == 0 ? clip[3] + clip[0] : plane == 1 ? clip[3] - clip[0]
+                    : plane == 2 ? clip[3] + clip[1] : plane == 3 ? clip[3] - clip[1]
+                    : plane == 4 ? clip[2] : clip[3] - clip[2];
+            all = d < 0.0f;
+        }
+        if (all)
+            return true;
+    }
+    return false;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestCull()
+{
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    for (Geometry & geometry : Shapes())
+    {
+        geometry.Clusterize();
+        MeshletCuller culler;
+        bool conservative = true, merged = true, counted = true;
+
+        for (uint view = 0; view < 100; ++view)
+        {
+            // câmeras em volta do objeto olhando para pontos perto dele
+            float theta = 6.283f * unit(random), phi = 0.2f + 2.7f * unit(random), r = 2.0f + 6.0f * unit(random);
+            XMFLOAT3 eye(r * std::sin(phi) * std::cos(theta), r * std::cos(phi), r * std::sin(phi) * std::sin(theta));
+            XMFLOAT3 target(4.0f * unit(random) - 2.0f, 4.0f * unit(random) - 2.0f, 4.0f * unit(random) - 2.0f);
+            XMFLOAT4X4 m = Camera(eye, target);
+
+            vector<MeshletRange> ranges;
+            uint visible = culler.Cull(geometry, m, eye, ranges);
+
+            vector<bool> drawn(geometry.IndexCount() / 3, false);
+            uint total = 0;
+            for (uint i = 0; i < ranges.size(); ++i)
+            {
+                // faixas vizinhas no buffer são unidas numa só
+                merged = merged && (i == 0 || ranges[i - 1].startIndex + ranges[i - 1].indexCount < ranges[i].startIndex);
+                for (uint j = ranges[i].startIndex; j < ranges[i].startIndex + ranges[i].indexCount; j += 3)
+                    drawn[j / 3] = true;
+                total += ranges[i].indexCount / 3;
+            }
+            counted = counted && total == visible;
+
+            for (const Meshlet & g : geometry.meshlets)
+                for (uint i = g.startIndex; i < g.startIndex + g.indexCount; i += 3)
+                    conservative = conservative && (drawn[i / 3] || Hidden(geometry, i, m, eye));
+        }
+
+        CHECK(conservative && merged && counted);
+        CHECK(culler.Tested() == 100ull * geometry.OriginalCount() / 3);
+        CHECK(culler.Outside() + culler.Backfacing() < culler.Tested());
+    }
+
+    // câmera de costas para o objeto: todos fora do volume de visão
+    Sphere sphere(1.0f, 64, 64);
+    sphere.Clusterize();
+    MeshletCuller away;
+    vector<MeshletRange> ranges;
+    XMFLOAT3 eye(0.0f, 0.0f, -5.0f);
+    CHECK(away.Cull(sphere, Camera(eye, XMFLOAT3(0.0f, 0.0f, -10.0f)), eye, ranges) == 0);
+    CHECK(ranges.empty() && away.Outside() == away.Tested());
+
+    // de frente para a esfera: parte de trás descartada pelos cones
+    MeshletCuller front;
+    uint visible = front.Cull(sphere, Camera(eye, XMFLOAT3(0.0f, 0.0f, 0.0f)), eye, ranges);
+    CHECK(front.Outside() == 0 && front.Backfacing() > front.Tested() / 4);
+    CHECK(visible + front.Backfacing() == front.Tested());
+}
+
+// -------------------------------------------------------------------------------
+
+// estatísticas dos grupos, vazão da construção e fração descartada
+static void BenchMeshlets()
+{
+    vector<Geometry> shapes;
+    vector<const char *> names;
+    for (const char * name : Models)
+    {
+        shapes.push_back(LoadModel(name));
+        names.push_back(name);
+    }
+    shapes.push_back(Sphere(1.0f, 512, 512));
+    names.push_back("Sphere 512");
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    printf("Clusterize(64, 124) e 200 vistas em volta do objeto:\n");
+    for (uint s = 0; s < shapes.size(); ++s)
+    {
+        Geometry & geometry = shapes[s];
+        uint triangles = geometry.OriginalCount() / 3;
+        double time = Best(3, [&] { geometry.Clusterize(); });
+
+        double vertices = 0.0;
+        for (const Meshlet & m : geometry.meshlets)
+            vertices += m.vertexCount;
+
+        MeshletCuller culler;
+        vector<MeshletRange> ranges;
+        for (uint view = 0; view < 200; ++view)
+        {
+            float theta = 6.283f * unit(random), phi = 0.2f + 2.7f * unit(random), r = 2.0f + 6.0f * unit(random);
+            XMFLOAT3 eye(r * std::sin(phi) * std::cos(theta), r * std::cos(phi), r * std::sin(phi) * std::sin(theta));
+            XMFLOAT3 target(4.0f * unit(random) - 2.0f, 4.0f * unit(random) - 2.0f, 4.0f * unit(random) - 2.0f);
+            ranges.clear();
+            culler.Cull(geometry, Camera(eye, target), eye, ranges);
+        }
+
+        size_t count = geometry.meshlets.size();
+        printf("  %-12s %7u triângulos %6zu grupos (%5.1f vértices, %5.1f triângulos)  %7.2f ms  %5.2f Mtri/s"
+            "  fora %4.1f%%  costas %4.1f%%\n",
+            names[s], triangles, count, vertices / count, double(triangles) / count, time * 1e3,
+            triangles / time * 1e-6, 100.0 * culler.Outside() / culler.Tested(), 100.0 * culler.Backfacing() / culler.Tested());
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestClusters();
+    TestCull();
+
+    if (Bench(argc, argv))
+        BenchMeshlets();
+
+    return Result("MeshletTest");
+}
@@ -0,0 +1,66 @@
+/**********************************************************************************
+// Models (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Lê os modelos OBJ do Multi para os testes: posições e o
+//              primeiro triângulo de cada face, como Multi::LoadOBJ.
+//
+**********************************************************************************/
+
+#ifndef DXUT_MODELS_H_
+#define DXUT_MODELS_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Geometry.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+using std::string;
+
+// -------------------------------------------------------------------------------
+
+// modelos que acompanham o Multi
+static const char * const Models[] = { "ball.obj", "capsule.obj", "house.obj", "monkey.obj", "thorus.obj" };
+
+// lê um modelo da pasta do Multi (geometria vazia se o arquivo não existe)
+inline Geometry LoadModel(const string & name)
+{
+    Geometry geometry;
+    std::ifstream file(string(MODELS_DIR) + "/" + name);
+    string line;
+
+    while (std::getline(file, line))
+    {
+        std::istringstream iss(line);
+        string prefix;
+        iss >> prefix;
+
+        if (prefix == "v")
+        {
+            Vertex vertex;
+            iss >> vertex.pos.x >> vertex.pos.y >> vertex.pos.z;
+            vertex.color = XMFLOAT4(0.41f, 0.41f, 0.41f, 1.0f);
+            geometry.vertices.push_back(vertex);
+        }
+        else if (prefix == "f")
+        {
+            // "v", "v/vt", "v//vn" ou "v/vt/vn": o índice da posição vem primeiro
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                string token;
+                iss >> token;
+                geometry.indices.push_back(uint(std::stoul(token)) - 1);
+            }
+        }
+    }
+
+    return geometry;
+}
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,325 @@
+/**********************************************************************************
+// NormalsTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica Geometry::ComputeNormals: os pesos por área e por
+//              ângulo, a soma igual à de uma referência em double nos
+//              modelos do Multi e nas geometrias geradas, o mesmo resultado
+//              com e sem as threads auxiliares e a precisão em relação às
+//              normais vn dos arquivos .obj. Com --bench mede a geração em
+//              malhas de um milhão de triângulos.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// ângulo em graus entre dois vetores (180 se algum é nulo)
+static double Angle(const XMFLOAT3 & a, const XMFLOAT3 & b)
+{
+    double la = std::sqrt(double(a.x) * a.x + double(a.y) * a.y + double(a.z) * a.z);
+    double lb = std::sqrt(double(b.x) * b.x + double(b.y) * b.y + double(b.z) * b.z);
+    if (la == 0.0 || lb == 0.0)
+        return 180.0;
+
+    double d = (double(a.x) * b.x + double(a.y) * b.y + double(a.z) * b.z) / (la * lb);
+    return std::acos(std::max(-1.0, std::min(1.0, d))) * 180.0 / 3.14159265358979;
+}
+
+// referência sem vincos: cada vértice soma as normais unitárias das faces
+// pesadas pela área ou pelo ângulo do canto, em double
+static vector<XMFLOAT3> Reference(const Geometry & g, uint weight)
+{
+    vector<double> sum(g.vertices.size() * 3, 0.0);
+    for (uint t = 0; t + 2 < g.OriginalCount(); t += 3)
+    {
+        double p[3][3];
+        for (uint k = 0; k < 3; ++k)
+        {
+            const XMFLOAT3 & v = g.vertices[g.indices[t + k]].pos;
+            p[k][0] = v.x; p[k][1] = v.y; p[k][2] = v.z;
+        }
+
+        double e1[3], e2[3], n[3];
+        for (uint i = 0; i < 3; ++i)
+        {
+            e1[i] = p[1][i] - p[0][i];
+            e2[i] = p[2][i] - p[0][i];
+        }
+        n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+        n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+        n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+        double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length == 0.0)
+            continue;
+
+        for (uint k = 0; k < 3; ++k)
+        {
+            double a[3], b[3];
+            for (uint i = 0; i < 3; ++i)
+            {
+                a[i] = p[(k + 1) % 3][i] - p[k][i];
+                b[i] = p[(k + 2) % 3][i] - p[k][i];
+            }
+            double w = weight == NORMALS_AREA ? length
+                : std::atan2(length, a[0] * b[0] + a[1] * b[1] + a[2] * b[2]);
+
+            for (uint i = 0; i < 3; ++i)
+                sum[size_t(g.indices[t + k]) * 3 + i] += w * n[i] / length;
+        }
+    }
+
+    vector<XMFLOAT3> normals(g.vertices.size());
+    for (size_t v = 0; v < normals.size(); ++v)
+        normals[v] = XMFLOAT3(float(sum[v * 3]), float(sum[v * 3 + 1]), float(sum[v * 3 + 2]));
+    return normals;
+}
+
+// modelo com a normal vn de cada canto; as faces são divididas em leque
+// (LoadModel fica só com o primeiro triângulo dos quadriláteros)
+static Geometry LoadNormals(const string & name, vector<XMFLOAT3> & corners)
+{
+    std::ifstream file(string(MODELS_DIR) + "/" + name);
+    vector<XMFLOAT3> normals;
+    Geometry geometry;
+    string line;
+
+    while (std::getline(file, line))
+    {
+        std::istringstream iss(line);
+        string prefix;
+        iss >> prefix;
+
+        if (prefix == "v")
+        {
+            Vertex vertex;
+            iss >> vertex.pos.x >> vertex.pos.y >> vertex.pos.z;
+            geometry.vertices.push_back(vertex);
+        }
+        else if (prefix == "vn")
+        {
+            XMFLOAT3 n;
+            iss >> n.x >> n.y >> n.z;
+            normals.push_back(n);
+        }
+        else if (prefix == "f")
+        {
+            // a normal é o último índice de "v//vn" ou "v/vt/vn"
+            vector<uint> positions;
+            vector<XMFLOAT3> face;
+            string token;
+            while (iss >> token)
+            {
+                size_t slash = token.rfind('/');
+                uint n = slash == string::npos ? 0 : uint(std::stoul(token.substr(slash + 1)));
+                positions.push_back(uint(std::stoul(token)) - 1);
+                face.push_back(n > 0 && n <= normals.size() ? normals[n - 1] : XMFLOAT3(0.0f, 0.0f, 0.0f));
+            }
+
+            for (uint k = 1; k + 1 < positions.size(); ++k)
+                for (uint corner : { 0u, k, k + 1 })
+                {
+                    geometry.indices.push_back(positions[corner]);
+                    corners.push_back(face[corner]);
+                }
+        }
+    }
+    return geometry;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestWeights()
+{
+    // vértice 0 no canto reto de um triângulo grande (normal z) e de
+    // um pequeno (normal y), que não compartilham outros vértices
+    Geometry g;
+    for (XMFLOAT3 p : { XMFLOAT3(0, 0, 0), XMFLOAT3(4, 0, 0), XMFLOAT3(0, 4, 0), XMFLOAT3(0, 0, 1), XMFLOAT3(1, 0, 0) })
+        g.vertices.push_back({ p, XMFLOAT4() });
+    g.indices = { 0, 1, 2, 0, 3, 4 };
+
+    // pela área a normal pende para o triângulo grande (16 contra 1)
+    g.ComputeNormals(NORMALS_AREA);
+    CHECK(g.normals.size() == 5);
+    CHECK(std::fabs(g.normals[0].x) < 1e-6f);
+    CHECK(std::fabs(g.normals[0].z / g.normals[0].y - 16.0f) < 1e-3f);
+
+    // pelo ângulo os dois cantos retos pesam igual
+    g.ComputeNormals(NORMALS_ANGLE);
+    CHECK(std::fabs(g.normals[0].y - g.normals[0].z) < 1e-6f);
+    CHECK(std::fabs(g.normals[0].y - 0.70710678f) < 1e-5f);
+
+    // vértices de um só triângulo ficam com a normal dele; isolados, com zero
+    CHECK(g.normals[1].z > 0.99999f && g.normals[3].y > 0.99999f);
+    g.vertices.push_back({ XMFLOAT3(9, 9, 9), XMFLOAT4() });
+    g.ComputeNormals();
+    CHECK(g.normals[5].x == 0.0f && g.normals[5].y == 0.0f && g.normals[5].z == 0.0f);
+
+    // triângulos degenerados não contribuem
+    g.indices.insert(g.indices.end(), { 0, 4, 4 });
+    g.ComputeNormals(NORMALS_AREA);
+    CHECK(std::fabs(g.normals[0].z / g.normals[0].y - 16.0f) < 1e-3f);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestReference()
+{
+    vector<Geometry> shapes;
+    for (const char * name : Models)
+        shapes.push_back(LoadModel(name));
+    shapes.push_back(Sphere(1.0f, 20, 20));
+    shapes.push_back(Cylinder(1.0f, 0.5f, 3.0f, 20, 10));
+    shapes.push_back(GeoSphere(1.0f, 3));
+    shapes.push_back(Grid(3.0f, 2.0f, 7, 5));
+    shapes.push_back(Sphere(1.0f, 256, 256));        // acima do limite paralelo
+
+    for (const Geometry & shape : shapes)
+        for (uint weight : { NORMALS_AREA, NORMALS_ANGLE })
+        {
+            Geometry g = shape;
+            g.ComputeNormals(weight);
+            vector<XMFLOAT3> reference = Reference(shape, weight);
+
+            // sem vincos os vértices não mudam e as normais são unitárias
+            CHECK(g.VertexCount() == shape.VertexCount() && g.indices == shape.indices);
+
+            double worst = 0.0;
+            bool unit = true;
+            for (uint v = 0; v < g.VertexCount(); ++v)
+            {
+                const XMFLOAT3 & n = g.normals[v];
+                float length = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+                const XMFLOAT3 & r = reference[v];
+                if (r.x == 0.0f && r.y == 0.0f && r.z == 0.0f)
+                    continue;
+                worst = std::max(worst, Angle(n, r));
+                unit = unit && std::fabs(length - 1.0f) < 1e-5f;
+            }
+            CHECK(unit && worst < 0.01);
+        }
+}
+
+// -------------------------------------------------------------------------------
+
+// mesmo resultado com as threads auxiliares ou com o conjunto ocupado
+static void TestThreads()
+{
+    Sphere sphere(1.0f, 300, 200);
+    Geometry serial = sphere;
+    Geometry parallel = sphere;
+
+    parallel.ComputeNormals(NORMALS_ANGLE, 40.0f);
+
+    // dentro de um trabalho do conjunto compartilhado tudo roda na mesma thread
+    ThreadPool::Shared().Run(2, 2, [&](uint chunk, uint, uint)
+    {
+        if (chunk == 0)
+            serial.ComputeNormals(NORMALS_ANGLE, 40.0f);
+    });
+
+    CHECK(serial.vertices.size() == parallel.vertices.size() && serial.indices == parallel.indices);
+    CHECK(serial.normals.size() == parallel.normals.size());
+    CHECK(memcmp(serial.normals.data(), parallel.normals.data(), serial.normals.size() * sizeof(XMFLOAT3)) == 0);
+}
+
+// -------------------------------------------------------------------------------
+
+// normais geradas contra as vn dos modelos: média e pior ângulo por canto
+static void Compare(const char * name, uint weight, float crease, double & mean, double & worst)
+{
+    vector<XMFLOAT3> file;
+    Geometry g = LoadNormals(name, file);
+    g.ComputeNormals(weight, crease);
+
+    mean = worst = 0.0;
+    for (uint c = 0; c < g.IndexCount(); ++c)
+    {
+        double e = Angle(g.normals[g.indices[c]], file[c]);
+        mean += e;
+        worst = std::max(worst, e);
+    }
+    mean /= g.IndexCount();
+}
+
+static void TestAccuracy()
+{
+    double mean, worst;
+
+    // casa, macaco e toro têm uma vn por face: um vinco pequeno as reproduz,
+    // exceto onde faces vizinhas quase planas (abaixo do vinco) são suavizadas
+    for (const char * name : { "house.obj", "monkey.obj", "thorus.obj" })
+    {
+        Compare(name, NORMALS_ANGLE, 1.0f, mean, worst);
+        CHECK(mean < 0.05 && worst < 1.0);
+    }
+
+    // bola e cápsula são suaves: perto das normais do arquivo sem vinco
+    for (const char * name : { "ball.obj", "capsule.obj" })
+    {
+        Compare(name, NORMALS_ANGLE, 180.0f, mean, worst);
+        CHECK(mean < 0.5);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+static void BenchNormals()
+{
+    printf("Precisão contra as normais vn dos modelos (graus por canto):\n");
+    for (const char * name : Models)
+    {
+        printf("  %-12s", name);
+        for (uint weight : { NORMALS_AREA, NORMALS_ANGLE })
+            for (float crease : { 180.0f, 1.0f })
+            {
+                double mean, worst;
+                Compare(name, weight, crease, mean, worst);
+                printf("  %s %3.0f: %5.2f média %6.2f pior", weight == NORMALS_AREA ? "área" : "ângulo", crease, mean, worst);
+            }
+        printf("\n");
+    }
+
+    printf("ComputeNormals (%u threads):\n", ThreadPool::Shared().Size());
+    Sphere sphere(1.0f, 708, 708);
+    Grid grid(1.0f, 1.0f, 709, 709);
+    for (const Geometry * shape : { (const Geometry *) &sphere, (const Geometry *) &grid })
+    {
+        uint triangles = shape->IndexCount() / 3;
+        printf("  %-10s %8u triângulos", shape == &sphere ? "Sphere 708" : "Grid 709", triangles);
+        for (uint weight : { NORMALS_AREA, NORMALS_ANGLE })
+            for (float crease : { 180.0f, 60.0f })
+            {
+                Geometry g = *shape;
+                double time = Best(3, [&] { g.vertices.resize(shape->VertexCount()); g.ComputeNormals(weight, crease); });
+                printf("  %s %3.0f: %6.2f Mtri/s", weight == NORMALS_AREA ? "área" : "ângulo", crease, triangles / time * 1e-6);
+            }
+        printf("\n");
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestWeights();
+    TestReference();
+    TestThreads();
+    TestAccuracy();
+
+    if (Bench(argc, argv))
+        BenchNormals();
+
+    return Result("NormalsTest");
+}
@@ -0,0 +1,167 @@
+/**********************************************************************************
+// PacerTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica o limitador de quadros com um relógio simulado: o
+//              ritmo é mantido, a margem de giro acompanha o atraso do sono
+//              e, com o tick de 15.6 ms do Windows, a margem cobre o quadro
+//              e a espera vira giro. Com --bench mede o desvio e a ocupação
+//              da CPU com o sono real do sistema.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Pacer.h"
+#include "Timer.h"
+#include <cmath>
+#include <ctime>
+
+// -------------------------------------------------------------------------------
+
+// relógio simulado: cada leitura custa 1 us e o sono termina no
+// próximo múltiplo de tick, mais um atraso fixo
+struct FakeSystem
+{
+    double now = 1.0;
+    double tick = 0.0;
+    double late = 0.0;
+    ullong reads = 0;
+
+    double Clock() { ++reads; return now += 1e-6; }
+
+    void Sleep(double secs)
+    {
+        double end = now + secs;
+        if (tick > 0.0)
+            end = std::ceil(end / tick) * tick;
+        now = end + late;
+    }
+};
+
+// roda frames quadros com uma carga fixa antes de cada espera
+static PaceStats Run(FakeSystem & system, double fps, uint frames, double work = 0.002)
+{
+    Pacer pacer([&] { return system.Clock(); }, [&](double secs) { system.Sleep(secs); });
+    pacer.Rate(fps);
+
+    for (uint i = 0; i < frames; ++i)
+    {
+        system.now += work;
+        pacer.Wait();
+    }
+
+    return pacer.Stats();
+}
+
+// -------------------------------------------------------------------------------
+
+// sono preciso: ritmo exato, margem pequena e pouco giro
+static void TestAccurate()
+{
+    FakeSystem system;
+    system.late = 0.0005;
+    PaceStats stats = Run(system, 60.0, 300);
+
+    CHECK(stats.frames == 256);
+    CHECK(stats.p99 < 0.00001);
+    CHECK(stats.margin > 0.0004 && stats.margin < 0.001);
+    CHECK(stats.spin < 0.06);
+}
+
+// -------------------------------------------------------------------------------
+
+// tick de 15.6 ms: a margem cobre o tempo livre e o quadro nunca dorme
+static void TestCoarseTick()
+{
+    FakeSystem system;
+    system.tick = 0.015625;
+    PaceStats stats = Run(system, 60.0, 300);
+
+    CHECK(stats.p99 < 0.00001);
+    CHECK(stats.margin > 1.0 / 60.0 - 0.002);       // maior que o tempo livre do quadro
+    CHECK(stats.spin > 0.8);
+
+    // com 1 ms de tick (timeBeginPeriod ou temporizador) quase não há giro
+    FakeSystem fine;
+    fine.tick = 0.001;
+    PaceStats better = Run(fine, 60.0, 300);
+
+    CHECK(better.p99 < 0.00001);
+    CHECK(better.margin < 0.002);
+    CHECK(better.spin < 0.15);
+}
+
+// -------------------------------------------------------------------------------
+
+// quadro atrasado mais de um período recomeça o ritmo em vez de acelerar
+static void TestLateFrame()
+{
+    FakeSystem system;
+    Pacer pacer([&] { return system.Clock(); }, [&](double secs) { system.Sleep(secs); });
+    pacer.Rate(100.0);
+
+    for (uint i = 0; i < 10; ++i)
+        pacer.Wait();
+
+    system.now += 0.05;
+    pacer.Wait();
+
+    // os quadros seguintes voltam a durar um período
+    double start = system.now;
+    for (uint i = 0; i < 10; ++i)
+        pacer.Wait();
+
+    CHECK(std::fabs(system.now - start - 0.1) < 0.0001);
+    CHECK(pacer.Rate() == 100.0);
+
+    // sem limite a espera retorna imediatamente
+    pacer.Rate(0.0);
+    double before = system.now;
+    pacer.Wait();
+    CHECK(system.now == before);
+}
+
+// -------------------------------------------------------------------------------
+
+// ritmo real: desvio, margem, giro e ocupação da CPU
+static void BenchPace()
+{
+    for (double fps : { 60.0, 240.0 })
+    {
+        Pacer pacer;
+        pacer.Rate(fps);
+
+        uint frames = uint(fps * 2.0);
+        std::clock_t cpuStart = std::clock();
+        Timer wall;
+        wall.Start();
+
+        for (uint i = 0; i <= frames; ++i)
+            pacer.Wait();
+
+        double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+        double usage = 100.0 * cpu / wall.Elapsed();
+        PaceStats stats = pacer.Stats();
+
+        printf("Ritmo %.0f fps (%s): desvio P50 %.3f ms  P99 %.3f ms  máx %.3f ms  margem %.3f ms  giro %.1f%%  CPU %.1f%%\n",
+            fps, pacer.Sleeper(), stats.p50 * 1000.0, stats.p99 * 1000.0, stats.max * 1000.0,
+            stats.margin * 1000.0, stats.spin * 100.0, usage);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestAccurate();
+    TestCoarseTick();
+    TestLateFrame();
+
+    if (Bench(argc, argv))
+        BenchPace();
+
+    return Result("PacerTest");
+}
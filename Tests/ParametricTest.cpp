@@ -0,0 +1,250 @@
+/**********************************************************************************
+// ParametricTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica as geometrias paramétricas: o nível nominal reproduz
+//              a geometria fixa do construtor, os níveis vão do mais
+//              detalhado ao mais simples com o desvio medido dentro do
+//              informado, conjuntos repetidos vêm do cache e a folga da
+//              escolha evita trocas de nível com a câmera tremendo. Com
+//              --bench repete uma câmera orbitando uma cena de esferas e
+//              cilindros e mostra os triângulos economizados.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Parametric.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+static const Parametric SceneSphere = { PARAMETRIC_SPHERE, 1.0f, 0.0f, 0.0f, 20, 20 };
+static const Parametric SceneCylinder = { PARAMETRIC_CYLINDER, 1.0f, 0.5f, 3.0f, 20, 10 };
+static const Parametric SceneGeoSphere = { PARAMETRIC_GEOSPHERE, 1.0f, 0.0f, 0.0f, 3, 0 };
+
+// o nível reproduz a geometria: mesmas posições e índices deslocados
+static bool Reproduces(const Geometry & all, const LevelOfDetail & lod, const Geometry & shape)
+{
+    if (lod.indexCount != shape.IndexCount())
+        return false;
+
+    uint base = all.indices[lod.startIndex] - shape.indices[0];
+    for (uint i = 0; i < lod.indexCount; ++i)
+        if (all.indices[lod.startIndex + i] != shape.indices[i] + base)
+            return false;
+
+    return base + shape.VertexCount() <= all.VertexCount()
+        && memcmp(&all.vertices[base], shape.VertexData(), shape.VertexCount() * sizeof(Vertex)) == 0;
+}
+
+// maior distância de um triângulo do nível até a superfície da esfera
+// (pelo centro do triângulo, o ponto mais afastado de um triângulo pequeno)
+static float SphereDeviation(const Geometry & geometry, const LevelOfDetail & lod, float radius)
+{
+    float worst = 0.0f;
+    for (uint i = lod.startIndex; i < lod.startIndex + lod.indexCount; i += 3)
+    {
+        XMVECTOR c = XMVectorZero();
+        for (uint k = 0; k < 3; ++k)
+            c = XMVectorAdd(c, XMLoadFloat3(&geometry.vertices[geometry.indices[i + k]].pos));
+        worst = std::max(worst, radius - std::sqrt(XMVectorGetX(XMVector3LengthSq(c))) / 3.0f);
+    }
+    return worst;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestLevels()
+{
+    ParametricCache cache;
+    uint nominal;
+
+    // o nível nominal é a geometria fixa da cena do Multi
+    const Geometry & sphere = cache.Build(SceneSphere, nominal);
+    CHECK(nominal == 1 && sphere.lods.size() == ParametricCache::Levels);
+    CHECK(Reproduces(sphere, sphere.lods[nominal], Sphere(1.0f, 20, 20)));
+    CHECK(Reproduces(sphere, sphere.lods[0], Sphere(1.0f, 40, 40)));
+    CHECK(Reproduces(sphere, sphere.lods[3], Sphere(1.0f, 5, 5)));
+
+    const Geometry & cylinder = cache.Build(SceneCylinder, nominal);
+    CHECK(Reproduces(cylinder, cylinder.lods[nominal], Cylinder(1.0f, 0.5f, 3.0f, 20, 10)));
+
+    const Geometry & geo = cache.Build(SceneGeoSphere, nominal);
+    CHECK(Reproduces(geo, geo.lods[nominal], GeoSphere(1.0f, 3)));
+    CHECK(Reproduces(geo, geo.lods[0], GeoSphere(1.0f, 4)));
+
+    // do mais detalhado ao mais simples, com desvio crescente
+    for (const Geometry * g : { &sphere, &cylinder, &geo })
+    {
+        uint end = 0;
+        for (uint level = 0; level < g->lods.size(); ++level)
+        {
+            const LevelOfDetail & lod = g->lods[level];
+            CHECK(lod.startIndex == end && lod.indexCount % 3 == 0);
+            CHECK(level == 0 || (lod.indexCount < g->lods[level - 1].indexCount && lod.error > g->lods[level - 1].error));
+            end += lod.indexCount;
+        }
+        CHECK(end == g->IndexCount());
+        CHECK(std::all_of(g->indices.begin(), g->indices.end(), [&](uint i) { return i < g->VertexCount(); }));
+    }
+
+    // desvio medido dentro do informado
+    for (const LevelOfDetail & lod : sphere.lods)
+        CHECK(SphereDeviation(sphere, lod, 1.0f) <= lod.error * 1.001f);
+    for (const LevelOfDetail & lod : geo.lods)
+        CHECK(SphereDeviation(geo, lod, 1.0f) <= lod.error * 1.001f);
+
+    // limites mínimos não repetem níveis
+    const Geometry & tiny = cache.Build({ PARAMETRIC_SPHERE, 1.0f, 0.0f, 0.0f, 3, 2 }, nominal);
+    CHECK(tiny.lods.size() == 2 && nominal == 1);
+    CHECK(Reproduces(tiny, tiny.lods[nominal], Sphere(1.0f, 3, 2)));
+
+    // esfera geodésica no limite de subdivisões: o nominal é o mais detalhado
+    const Geometry & finest = cache.Build({ PARAMETRIC_GEOSPHERE, 1.0f, 0.0f, 0.0f, 6, 0 }, nominal);
+    CHECK(nominal == 0 && finest.lods.size() == 3);
+    CHECK(finest.lods[0].indexCount == GeoSphere(1.0f, 6).IndexCount());
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestCache()
+{
+    ParametricCache cache;
+    uint nominal;
+
+    // conjuntos repetidos reaproveitam a mesma geometria
+    const Geometry * first = &cache.Build(SceneSphere, nominal);
+    const Geometry * again = &cache.Build(SceneSphere, nominal);
+    CHECK(first == again && cache.Hits() == 1 && cache.Misses() == 1);
+
+    // qualquer parâmetro diferente gera outra
+    Parametric bigger = SceneSphere;
+    bigger.radius = 2.0f;
+    Parametric finer = SceneSphere;
+    finer.slices = 24;
+    CHECK(&cache.Build(bigger, nominal) != first);
+    CHECK(&cache.Build(finer, nominal) != first);
+    CHECK(&cache.Build(SceneCylinder, nominal) != first);
+    CHECK(cache.Size() == 4 && cache.Misses() == 4);
+
+    // referências continuam válidas depois de novos conjuntos
+    for (uint slices = 3; slices < 40; ++slices)
+        cache.Build({ PARAMETRIC_CYLINDER, 1.0f, 1.0f, 1.0f, slices, 4 }, nominal);
+    CHECK(&cache.Build(SceneSphere, nominal) == first && first->lods.size() == ParametricCache::Levels);
+    CHECK(cache.Hits() == 2);
+}
+
+// -------------------------------------------------------------------------------
+
+// câmera se aproximando e afastando com tremor: trocas de nível com e sem folga
+static uint Switches(const Geometry & geometry, float slack)
+{
+    float pixelsPerUnit = 0.5f * 600.0f * 2.414f;
+    uint level = 0, switches = 0;
+    for (uint frame = 0; frame < 2000; ++frame)
+    {
+        float distance = 9.0f + 6.0f * std::sin(frame * 0.01f) + 0.3f * std::sin(frame * 0.7f);
+        uint next = geometry.Select(level, pixelsPerUnit / distance, 1.0f, slack);
+        switches += next != level;
+        level = next;
+    }
+    return switches;
+}
+
+static void TestHysteresis()
+{
+    ParametricCache cache;
+    uint nominal;
+    const Geometry & sphere = cache.Build(SceneSphere, nominal);
+
+    // sem folga o tremor troca o nível várias vezes em cada passagem
+    uint plain = Switches(sphere, 1.0f);
+    uint damped = Switches(sphere, 0.75f);
+    CHECK(damped > 0 && damped * 2 < plain);
+}
+
+// -------------------------------------------------------------------------------
+
+// câmera orbitando uma cena de esferas e cilindros (--headless do Multi)
+static void BenchOrbit()
+{
+    ParametricCache cache;
+    uint sphereNominal, cylinderNominal;
+
+    double build = Best(1, [&]
+    {
+        cache.Build(SceneSphere, sphereNominal);
+        cache.Build(SceneCylinder, cylinderNominal);
+    });
+    const Geometry & sphere = cache.Build(SceneSphere, sphereNominal);
+    const Geometry & cylinder = cache.Build(SceneCylinder, cylinderNominal);
+
+    // grade de 20x20 objetos, alternando esferas e cilindros
+    vector<XMFLOAT3> positions;
+    for (int i = 0; i < 20; ++i)
+        for (int j = 0; j < 20; ++j)
+            positions.push_back(XMFLOAT3(i * 4.0f - 38.0f, 0.0f, j * 4.0f - 38.0f));
+
+    // 45 graus de campo de visão vertical em 1080 linhas
+    float pixelsPerUnit = 0.5f * 1080.0f / std::tan(XM_PI / 8.0f);
+    const uint frames = 600;
+    printf("Órbita de %u quadros, %zu objetos (geração dos níveis %.2f ms):\n", frames, positions.size(), build * 1e3);
+
+    for (float tolerance : { 0.5f, 1.0f, 2.0f, 4.0f })
+    {
+        vector<uint> levels(positions.size(), 0);
+        ullong fixed = 0, drawn = 0;
+        uint switches = 0;
+
+        double time = Best(1, [&]
+        {
+            for (uint frame = 0; frame < frames; ++frame)
+            {
+                // órbita de raio 50 subindo e descendo
+                float angle = frame * 2.0f * XM_PI / frames;
+                XMFLOAT3 eye(50.0f * std::cos(angle), 10.0f + 8.0f * std::sin(2.0f * angle), 50.0f * std::sin(angle));
+
+                for (uint i = 0; i < positions.size(); ++i)
+                {
+                    const Geometry & g = i % 2 ? cylinder : sphere;
+                    uint nominal = i % 2 ? cylinderNominal : sphereNominal;
+                    float dx = positions[i].x - eye.x, dy = positions[i].y - eye.y, dz = positions[i].z - eye.z;
+                    float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+                    uint level = g.Select(levels[i], pixelsPerUnit / distance, tolerance);
+                    switches += level != levels[i];
+                    levels[i] = level;
+
+                    fixed += g.lods[nominal].indexCount / 3;
+                    drawn += g.lods[level].indexCount / 3;
+                }
+            }
+        });
+
+        printf("  desvio de %.1f pixel: %.0f triângulos por quadro fixos, %.0f escolhidos (%+.1f%%), "
+            "%.2f trocas por quadro, %.1f ns por objeto\n",
+            tolerance, double(fixed) / frames, double(drawn) / frames, 100.0 * (double(drawn) / fixed - 1.0),
+            double(switches) / frames, time / (frames * positions.size()) * 1e9);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestLevels();
+    TestCache();
+    TestHysteresis();
+
+    if (Bench(argc, argv))
+        BenchOrbit();
+
+    return Result("ParametricTest");
+}
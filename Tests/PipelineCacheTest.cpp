@@ -0,0 +1,182 @@
+/**********************************************************************************
+// PipelineCacheTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica o cache de pipelines em disco: blobs voltam iguais
+//              aos gravados e arquivos corrompidos, truncados, de outra chave
+//              ou de outra versão são recusados sem derrubar a aplicação.
+//              Com --bench mede leitura e gravação de blobs típicos.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "PipelineCache.h"
+#include <filesystem>
+#include <fstream>
+using std::fstream;
+using std::ios;
+
+// -------------------------------------------------------------------------------
+
+static const char * const Dir = "PipelineCacheTest.cache";
+
+// blob com conteúdo conhecido
+static vector<byte> Blob(size_t size, uint seed)
+{
+    vector<byte> blob(size);
+    for (size_t i = 0; i < size; ++i)
+        blob[i] = byte((i * 131 + seed) & 0xff);
+    return blob;
+}
+
+// caminho do arquivo do cache (mesmo formato de PipelineCache::FileName)
+static string Path(ullong key, const string & ext)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.", key);
+    return string(Dir) + "/" + name + ext;
+}
+
+// altera bytes do arquivo na posição offset
+static void Patch(const string & path, size_t offset, const void * data, size_t size)
+{
+    fstream file(path, ios::in | ios::out | ios::binary);
+    file.seekp(std::streamoff(offset));
+    file.write(static_cast<const char *>(data), std::streamsize(size));
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestRoundTrip()
+{
+    PipelineCache cache(Dir);
+    vector<byte> blob = Blob(4096, 7), loaded;
+
+    CHECK(!cache.Load(1, "pso", loaded));
+    CHECK(cache.Misses() == 1);
+
+    CHECK(cache.Store(1, "pso", blob.data(), blob.size()));
+    CHECK(cache.Load(1, "pso", loaded));
+    CHECK(loaded == blob);
+    CHECK(cache.Hits() == 1);
+
+    // extensões separam pipelines e assinaturas com a mesma chave
+    vector<byte> root = Blob(100, 3);
+    CHECK(cache.Store(1, "rs", root.data(), root.size()));
+    CHECK(cache.Load(1, "rs", loaded) && loaded == root);
+    CHECK(cache.Load(1, "pso", loaded) && loaded == blob);
+
+    // blob vazio também é válido
+    CHECK(cache.Store(2, "pso", nullptr, 0));
+    CHECK(cache.Load(2, "pso", loaded) && loaded.empty());
+
+    // nenhum arquivo temporário sobra depois da gravação
+    CHECK(!std::filesystem::exists(Path(1, "pso") + ".tmp"));
+
+    cache.Invalidate(1, "pso");
+    CHECK(!cache.Load(1, "pso", loaded));
+    CHECK(loaded.empty());
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestRejected()
+{
+    PipelineCache cache(Dir);
+    vector<byte> blob = Blob(1000, 11), loaded;
+    const size_t HeaderSize = 32;
+
+    // conteúdo corrompido: o hash não confere
+    CHECK(cache.Store(10, "pso", blob.data(), blob.size()));
+    byte flip = byte(blob[500] ^ 0xff);
+    Patch(Path(10, "pso"), HeaderSize + 500, &flip, 1);
+    CHECK(!cache.Load(10, "pso", loaded));
+    CHECK(loaded.empty());
+
+    // arquivo truncado no meio do conteúdo e no meio do cabeçalho
+    for (size_t size : { HeaderSize + 10, size_t(12) })
+    {
+        CHECK(cache.Store(11, "pso", blob.data(), blob.size()));
+        std::filesystem::resize_file(Path(11, "pso"), size);
+        CHECK(!cache.Load(11, "pso", loaded));
+    }
+
+    // tamanho corrompido no cabeçalho não pode pedir memória absurda
+    CHECK(cache.Store(12, "pso", blob.data(), blob.size()));
+    ullong huge = ~0ull >> 1;
+    Patch(Path(12, "pso"), 16, &huge, sizeof(huge));
+    CHECK(!cache.Load(12, "pso", loaded));
+
+    // arquivo de outra chave copiado com o nome errado
+    CHECK(cache.Store(13, "pso", blob.data(), blob.size()));
+    std::filesystem::copy_file(Path(13, "pso"), Path(14, "pso"),
+        std::filesystem::copy_options::overwrite_existing);
+    CHECK(!cache.Load(14, "pso", loaded));
+
+    // outra versão do formato e arquivo estranho
+    CHECK(cache.Store(15, "pso", blob.data(), blob.size()));
+    uint version = 99;
+    Patch(Path(15, "pso"), 4, &version, sizeof(version));
+    CHECK(!cache.Load(15, "pso", loaded));
+
+    std::ofstream(Path(16, "pso"), ios::binary) << "not a pipeline cache file at all";
+    CHECK(!cache.Load(16, "pso", loaded));
+
+    // todas as recusas contam como falhas
+    CHECK(cache.Hits() == 0);
+    CHECK(cache.Misses() == 7);
+
+    // depois de regravado o blob volta a ser usado
+    CHECK(cache.Store(10, "pso", blob.data(), blob.size()));
+    CHECK(cache.Load(10, "pso", loaded) && loaded == blob);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestHash()
+{
+    // FNV-1a de 64 bits: valores de referência
+    CHECK(PipelineCache::Hash("", 0) == 14695981039346656037ULL);
+    CHECK(PipelineCache::Hash("a", 1) == 0xaf63dc4c8601ec8cULL);
+
+    // encadear com a semente equivale a somar os bytes
+    ullong part = PipelineCache::Hash("ab", 2);
+    CHECK(PipelineCache::Hash("c", 1, part) == PipelineCache::Hash("abc", 3));
+}
+
+// -------------------------------------------------------------------------------
+
+// leitura e gravação de um pipeline típico (64 KB)
+static void BenchCache()
+{
+    PipelineCache cache(Dir);
+    vector<byte> blob = Blob(65536, 5), loaded;
+
+    double store = Best(20, [&] { cache.Store(100, "pso", blob.data(), blob.size()); });
+    double load = Best(20, [&] { cache.Load(100, "pso", loaded); });
+    double hash = Best(20, [&] { PipelineCache::Hash(blob.data(), blob.size()); });
+
+    printf("Cache de 64 KB: gravação %.3f ms  leitura %.3f ms  hash %.3f ms\n",
+        store * 1000.0, load * 1000.0, hash * 1000.0);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(Dir, ec);
+
+    TestRoundTrip();
+    TestRejected();
+    TestHash();
+
+    if (Bench(argc, argv))
+        BenchCache();
+
+    std::filesystem::remove_all(Dir, ec);
+    return Result("PipelineCacheTest");
+}
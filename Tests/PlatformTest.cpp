@@ -0,0 +1,232 @@
+/**********************************************************************************
+// PlatformTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica a camada de plataforma: relógio, janela (superfície
+//              fora da tela fora do Windows) e entrada postada por outras
+//              threads, gravada e relida, com arquivos corrompidos ou
+//              truncados rejeitados. Com --bench mede o custo do
+//              relógio e a vazão da entrada sintética.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Timer.h"
+#include "Window.h"
+#include "Input.h"
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+using std::vector;
+using std::thread;
+
+// -------------------------------------------------------------------------------
+
+static void TestClock()
+{
+    // o contador nunca volta atrás
+    llong last = Clock::Counter();
+    bool monotonic = true;
+    for (int i = 0; i < 100000; ++i)
+    {
+        llong now = Clock::Counter();
+        monotonic = monotonic && now >= last;
+        last = now;
+    }
+    CHECK(monotonic);
+    CHECK(Clock::Frequency() > 0);
+
+    // Timer e Clock concordam sobre um sono de 20 ms
+    Timer timer;
+    timer.Start();
+    double start = Clock::Seconds();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    double slept = Clock::Seconds() - start;
+    double elapsed = timer.Elapsed();
+
+    CHECK(slept >= 0.019 && slept < 0.5);
+    CHECK(elapsed >= 0.019 && elapsed < 0.5);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestWindow()
+{
+    Window window;
+    window.Mode(WINDOWED);
+    window.Size(800, 600);
+
+    CHECK(window.Width() == 800 && window.Height() == 600);
+    CHECK(window.CenterX() == 400 && window.CenterY() == 300);
+    CHECK(window.AspectRatio() > 1.33f && window.AspectRatio() < 1.34f);
+    CHECK(window.Mode() == WINDOWED);
+
+#ifndef _WIN32
+    // a superfície fora da tela não precisa de sistema de janelas
+    CHECK(window.Create());
+    CHECK(window.Width() == 800 && window.FullWidth() == 800);
+    CHECK(!window.Closed());
+    window.Close();
+    CHECK(window.Closed());
+#endif
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestInput()
+{
+    Input input;
+
+    // teclas postadas só valem depois da drenagem
+    Input::Post({ 0, 'A', true });
+    CHECK(input.KeyUp('A'));
+    CHECK(Input::Poll() == 1);
+    CHECK(input.KeyDown('A'));
+    CHECK(input.KeyPress('A') == false);    // precisa de uma liberação antes
+
+    Input::Post({ 0, 'A', false });
+    Input::Poll();
+    CHECK(input.KeyUp('A'));
+    CHECK(!input.KeyPress('A'));
+    Input::Post({ 0, 'A', true });
+    Input::Poll();
+    CHECK(input.KeyPress('A'));
+    Input::NextFrame();
+    CHECK(input.Events().empty());
+
+    // eventos guardam o instante em que foram gerados, não o da drenagem;
+    // eventos roteirizados sem instante são gerados ao serem aplicados
+    double generated = Clock::Seconds() - 1.0;
+    Input::Post({ 0, 0, false, INPUT_MOVE, 3, 4, generated });
+    Input::Poll();
+    double before = Clock::Seconds();
+    Input::Script({ 0, 0, false, INPUT_MOVE, 5, 6 });
+    CHECK(input.Events().size() == 2);
+    CHECK(input.Events().size() == 2 && input.Events()[0].time == generated);
+    CHECK(input.Events().size() == 2 && input.Events()[1].time >= before);
+    Input::NextFrame();
+
+    // várias threads postam movimentos: nenhum é perdido e a ordem
+    // de cada thread é mantida
+    const int Threads = 4;
+    const int Moves = 2000;
+    Input::Record(true);
+    uint frame = Input::Frame();
+
+    vector<thread> posters;
+    for (int t = 0; t < Threads; ++t)
+        posters.emplace_back([t]
+        {
+            for (int i = 0; i < Moves; ++i)
+                Input::Post({ 0, 0, false, INPUT_MOVE, i, t });
+        });
+
+    uint polled = 0;
+    for (thread & t : posters)
+    {
+        t.join();
+        polled += Input::Poll();
+    }
+    polled += Input::Poll();
+    Input::Record(false);
+
+    const vector<InputEvent> & events = input.Events();
+    CHECK(polled == Threads * Moves);
+    CHECK(events.size() == size_t(Threads * Moves));
+
+    int next[Threads] = { 0 };
+    bool ordered = true;
+    for (const InputEvent & e : events)
+    {
+        ordered = ordered && e.type == INPUT_MOVE && e.frame == frame && e.x == next[e.y]++;
+        ordered = ordered && e.time > 0.0;
+    }
+    CHECK(ordered);
+
+    // o último movimento de alguma thread define a posição final
+    CHECK(input.MouseX() == Moves - 1);
+
+    // a gravação relida devolve os mesmos eventos, com os quadros
+    // contados a partir do início da gravação
+    vector<InputEvent> loaded;
+    CHECK(Input::Save("PlatformTest.input"));
+    CHECK(Input::Load("PlatformTest.input", loaded));
+    CHECK(loaded.size() == events.size());
+
+    bool same = loaded.size() == events.size();
+    for (size_t i = 0; same && i < loaded.size(); ++i)
+        same = loaded[i].frame == events[i].frame - frame && loaded[i].type == events[i].type
+            && loaded[i].x == events[i].x && loaded[i].y == events[i].y;
+    CHECK(same);
+
+    // contagem de eventos corrompida no cabeçalho: rejeitada sem alocar
+    {
+        std::fstream file("PlatformTest.input", std::ios::in | std::ios::out | std::ios::binary);
+        uint count = 0xFFFFFFF0;
+        file.seekp(2 * sizeof(uint));
+        file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    }
+    loaded.assign(3, InputEvent{});
+    CHECK(!Input::Load("PlatformTest.input", loaded));
+
+    // arquivo truncado no meio dos eventos
+    CHECK(Input::Save("PlatformTest.input"));
+    std::filesystem::resize_file("PlatformTest.input", std::filesystem::file_size("PlatformTest.input") / 2);
+    CHECK(!Input::Load("PlatformTest.input", loaded));
+    std::remove("PlatformTest.input");
+
+    Input::NextFrame();
+    CHECK(Input::Frame() == frame + 1);
+}
+
+// -------------------------------------------------------------------------------
+
+static void Benchmark()
+{
+    // custo de uma leitura do relógio
+    const int Reads = 1000000;
+    volatile double sink = 0.0;
+    double clock = Best(5, [&] { for (int i = 0; i < Reads; ++i) sink = sink + Clock::Seconds(); });
+    printf("Clock::Seconds: %.1f ns por leitura\n", clock / Reads * 1e9);
+
+    // vazão da entrada sintética: uma thread posta enquanto outra drena
+    const int Events = 1000000;
+    double start = Clock::Seconds();
+    thread poster([] { for (int i = 0; i < Events; ++i) Input::Post({ 0, 0, false, INPUT_MOVE, i & 0x1ff, 0 }); });
+
+    uint drained = 0;
+    uint frames = 0;
+    while (drained < uint(Events))
+    {
+        drained += Input::Poll();
+        Input::NextFrame();
+        ++frames;
+    }
+    poster.join();
+    double elapsed = Clock::Seconds() - start;
+
+    printf("Input::Post/Poll: %u eventos em %.1f ms (%.1f milhões/s, %u drenagens)\n",
+        drained, elapsed * 1000.0, drained / elapsed / 1e6, frames);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestClock();
+    TestWindow();
+    TestInput();
+
+    if (Bench(argc, argv))
+        Benchmark();
+
+    return Result("PlatformTest");
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,258 @@
+/**********************************************************************************
+// ProfileScopeTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica os escopos de PROFILE_SCOPE: aninhamento, entrega das
+//              faixas ao fechar o escopo mais externo (ou a cada 256), um
+//              buffer por thread e nenhuma faixa sem profiler ativo. É
+//              compilado duas vezes: ProfileScopeOffTest define
+//              DXUT_NO_PROFILE e verifica que nada é medido. Com --bench
+//              mede o custo de um escopo em cada configuração.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Profiler.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+#ifdef DXUT_NO_PROFILE
+static const bool Enabled = false;
+static const char * const Name = "ProfileScopeOffTest";
+#else
+static const bool Enabled = true;
+static const char * const Name = "ProfileScopeTest";
+#endif
+
+// relógio simulado: cada leitura avança um tique (seguro entre threads)
+static std::atomic<ullong> ticks{ 0 };
+static double Tick() { return double(ticks++); }
+
+// a faixa inner está contida na faixa outer
+static bool Inside(const ProfileRange & inner, const ProfileRange & outer)
+{ return inner.start > outer.start && inner.end < outer.end && inner.depth == outer.depth + 1; }
+
+// -------------------------------------------------------------------------------
+
+static void TestNesting()
+{
+    Profiler profiler(Tick);
+    Profiler::Active(&profiler);
+
+    {
+        PROFILE_SCOPE("Update");
+        {
+            PROFILE_SCOPE("LoadOBJ");
+            {
+                PROFILE_SCOPE("Parse");
+            }
+        }
+
+        // nada é entregue antes do escopo mais externo terminar
+        CHECK(profiler.Count() == 0);
+
+        PROFILE_SCOPE("Upload");
+    }
+
+    if (!Enabled)
+    {
+        CHECK(profiler.Count() == 0);
+        Profiler::Active(nullptr);
+        return;
+    }
+
+    // entregues na ordem em que terminam
+    CHECK(profiler.Count() == 4);
+    if (profiler.Count() == 4)
+    {
+        ProfileRange parse = profiler.Range(0);
+        ProfileRange load = profiler.Range(1);
+        ProfileRange upload = profiler.Range(2);
+        ProfileRange update = profiler.Range(3);
+
+        CHECK(parse.name == "Parse" && load.name == "LoadOBJ");
+        CHECK(upload.name == "Upload" && update.name == "Update");
+        CHECK(update.depth == 0 && update.track == CPU_TRACK);
+        CHECK(Inside(parse, load) && Inside(load, update) && Inside(upload, update));
+        CHECK(load.end < upload.start);
+        CHECK(parse.thread == update.thread);
+    }
+
+    Profiler::Active(nullptr);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestFlush()
+{
+    Profiler profiler(Tick);
+    Profiler::Active(&profiler);
+
+    // um escopo longo com muitos filhos entrega as faixas em blocos de 256
+    {
+        PROFILE_SCOPE("Frame");
+        for (uint i = 0; i < 300; ++i)
+        {
+            PROFILE_SCOPE("Draw");
+        }
+        CHECK(profiler.Count() == (Enabled ? 256u : 0u));
+    }
+    CHECK(profiler.Count() == (Enabled ? 301u : 0u));
+
+    // sem profiler ativo os escopos não medem nada
+    Profiler::Active(nullptr);
+    {
+        PROFILE_SCOPE("Ignored");
+    }
+    CHECK(profiler.Count() == (Enabled ? 301u : 0u));
+
+    // ao ativar no meio de um escopo só os escopos seguintes são medidos
+    {
+        PROFILE_SCOPE("Outer");
+        Profiler::Active(&profiler);
+        {
+            PROFILE_SCOPE("Inner");
+        }
+    }
+    ProfileRange inner;
+    CHECK(profiler.Last("Inner", inner) == Enabled);
+    CHECK(!Enabled || inner.depth == 1);
+    CHECK(!profiler.Last("Outer", inner));
+
+    // faixas pendentes ao desativar no meio de um escopo são descartadas
+    {
+        PROFILE_SCOPE("Outer");
+        {
+            PROFILE_SCOPE("Lost");
+        }
+        Profiler::Active(nullptr);
+    }
+    Profiler next(Tick);
+    Profiler::Active(&next);
+    {
+        PROFILE_SCOPE("Next");
+    }
+    Profiler::Active(nullptr);
+    CHECK(!profiler.Last("Lost", inner) && !next.Last("Lost", inner));
+    CHECK(next.Count() == (Enabled ? 1u : 0u));
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestThreads()
+{
+    Profiler profiler(Tick);
+    Profiler::Active(&profiler);
+
+    // cada thread mede no seu buffer e entrega as suas faixas
+    const uint threads = 4, scopes = 500;
+    vector<std::thread> workers;
+    for (uint t = 0; t < threads; ++t)
+        workers.emplace_back([&]
+        {
+            PROFILE_SCOPE("Worker");
+            for (uint i = 0; i < scopes; ++i)
+            {
+                PROFILE_SCOPE("Task");
+                PROFILE_SCOPE("Step");
+            }
+        });
+
+    for (std::thread & worker : workers)
+        worker.join();
+    Profiler::Active(nullptr);
+
+    if (!Enabled)
+    {
+        CHECK(profiler.Count() == 0);
+        return;
+    }
+
+    CHECK(profiler.Count() == threads * (1 + 2 * scopes));
+
+    // faixas da mesma thread têm o mesmo número e aninhamento coerente
+    vector<uint> ids;
+    vector<ProfileRange> workerRanges;
+    bool nested = true;
+    for (uint i = 0; i < profiler.Count(); ++i)
+    {
+        ProfileRange r = profiler.Range(i);
+        if (r.name == "Worker")
+        {
+            ids.push_back(r.thread);
+            workerRanges.push_back(r);
+        }
+        nested = nested && r.depth == (r.name == "Worker" ? 0u : r.name == "Task" ? 1u : 2u);
+    }
+    CHECK(nested);
+    CHECK(ids.size() == threads);
+
+    bool distinct = true;
+    for (uint a = 0; a < ids.size(); ++a)
+        for (uint b = a + 1; b < ids.size(); ++b)
+            distinct = distinct && ids[a] != ids[b];
+    CHECK(distinct);
+
+    bool contained = true;
+    for (uint i = 0; i < profiler.Count(); ++i)
+    {
+        ProfileRange r = profiler.Range(i);
+        for (const ProfileRange & w : workerRanges)
+            if (r.thread == w.thread && r.name != "Worker")
+                contained = contained && r.start > w.start && r.end < w.end;
+    }
+    CHECK(contained);
+
+    // o trace nomeia a thread de cada trabalhador
+    string trace = profiler.ChromeTrace();
+    for (uint id : ids)
+        CHECK(trace.find("\"name\":\"CPU " + std::to_string(id) + "\"") != string::npos);
+}
+
+// -------------------------------------------------------------------------------
+
+// custo de um escopo com o relógio real, com e sem profiler ativo
+static void BenchScope()
+{
+    Profiler profiler;
+    const uint scopes = 1000000;
+
+    auto run = [&]
+    {
+        PROFILE_SCOPE("Frame");
+        for (uint i = 0; i < scopes; ++i)
+        {
+            PROFILE_SCOPE("Scope");
+        }
+    };
+
+    Profiler::Active(&profiler);
+    double active = Best(5, run);
+    Profiler::Active(nullptr);
+    double inactive = Best(5, run);
+
+    printf("%s: %.1f ns por escopo (ativo)  %.1f ns (sem profiler)%s\n",
+        Name, active / scopes * 1e9, inactive / scopes * 1e9,
+        Enabled ? "" : "  [DXUT_NO_PROFILE]");
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestNesting();
+    TestFlush();
+    TestThreads();
+
+    if (Bench(argc, argv))
+        BenchScope();
+
+    return Result(Name);
+}
@@ -0,0 +1,239 @@
+/**********************************************************************************
+// ProfilerTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica o profiler com um relógio simulado: faixas da CPU e
+//              da GPU na mesma linha do tempo, conversão dos timestamps da
+//              GPU pela calibração, histórico circular de 4096 faixas,
+//              consultas, trace do Chrome (escape dos nomes, threads e
+//              estatísticas) e gravação em arquivo. Com --bench mede o custo
+//              de registrar uma faixa.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Profiler.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// -------------------------------------------------------------------------------
+
+// faixa da GPU já convertida para a linha do tempo
+static ProfileRange Gpu(const char * name, double start, double end)
+{
+    ProfileRange range = {};
+    range.name = name;
+    range.track = GPU_TRACK;
+    range.start = start;
+    range.end = end;
+    return range;
+}
+
+static bool Near(double a, double b)
+{ return a - b < 1e-9 && b - a < 1e-9; }
+
+// -------------------------------------------------------------------------------
+
+static void TestTimeline()
+{
+    // a linha do tempo começa no valor do relógio na criação
+    double now = 100.0;
+    Profiler profiler([&] { return now; });
+    CHECK(profiler.Origin() == 100.0);
+    CHECK(profiler.Now() == 0.0);
+
+    ProfileMark mark = profiler.BeginCpu("Update");
+    now = 100.004;
+    profiler.EndCpu(mark);
+
+    profiler.NextFrame();
+    mark = profiler.BeginCpu("Draw");
+    now = 100.010;
+    profiler.EndCpu(mark);
+
+    CHECK(profiler.Count() == 2);
+    ProfileRange update = profiler.Range(0);
+    ProfileRange draw = profiler.Range(1);
+    CHECK(update.name == "Update" && update.track == CPU_TRACK && update.frame == 0);
+    CHECK(Near(update.start, 0.0) && Near(update.end, 0.004));
+    CHECK(draw.name == "Draw" && draw.frame == 1);
+    CHECK(Near(draw.start, 0.004) && Near(draw.Duration(), 0.006));
+    CHECK(update.thread == draw.thread);
+
+    // faixas da GPU entram entre as da CPU
+    profiler.Add(Gpu("Frame", 0.002, 0.009));
+    ProfileRange frame;
+    CHECK(profiler.Last("Frame", frame) && frame.track == GPU_TRACK);
+    CHECK(Near(frame.Duration(), 0.007));
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestGpuTime()
+{
+    // calibração: tick 5000 da GPU lido no instante 2 s da linha do tempo
+    const ullong frequency = 1000;
+    CHECK(Profiler::GpuTime(5000, 5000, frequency, 2.0) == 2.0);
+    CHECK(Near(Profiler::GpuTime(5250, 5000, frequency, 2.0), 2.25));
+
+    // consultas do quadro anterior ficam antes da calibração
+    CHECK(Near(Profiler::GpuTime(4000, 5000, frequency, 2.0), 1.0));
+
+    // relógio da GPU ligado há dias em 10 MHz: a diferença não perde precisão
+    const ullong mhz = 10000000;
+    ullong base = (1ull << 62) + 7;
+    CHECK(Profiler::GpuTime(base + 1, base, mhz, 0.5) == 0.5 + 1e-7);
+    CHECK(Profiler::GpuTime(base - 3, base, mhz, 0.5) == 0.5 - 3e-7);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestHistory()
+{
+    double now = 0.0;
+    Profiler profiler([&] { return now; });
+
+    // 5000 faixas: só as 4096 mais recentes ficam, da mais antiga para a mais nova
+    const uint total = 5000, kept = 4096;
+    for (uint i = 0; i < total; ++i)
+    {
+        ProfileRange range = Gpu(i % 2 ? "Odd" : "Even", i, i + (i % 2 ? 2.0 : 1.0));
+        range.frame = i;
+        profiler.Add(range);
+    }
+
+    CHECK(profiler.Count() == kept);
+    CHECK(profiler.Range(0).frame == total - kept);
+    CHECK(profiler.Range(kept - 1).frame == total - 1);
+
+    bool ordered = true;
+    for (uint i = 1; i < kept; ++i)
+        ordered = ordered && profiler.Range(i).frame == profiler.Range(i - 1).frame + 1;
+    CHECK(ordered);
+
+    ProfileRange last;
+    CHECK(profiler.Last("Even", last) && last.frame == total - 2);
+    CHECK(profiler.Last("Odd", last) && last.frame == total - 1);
+    CHECK(!profiler.Last("Missing", last));
+    CHECK(profiler.Average("Even") == 1.0);
+    CHECK(profiler.Average("Odd") == 2.0);
+    CHECK(profiler.Average("Missing") == 0.0);
+
+    // lote que passa do fim do histórico também dá a volta
+    vector<ProfileRange> batch(10, Gpu("Batch", 0.0, 0.5));
+    profiler.Add(batch);
+    CHECK(profiler.Count() == kept);
+    CHECK(profiler.Range(0).frame == total - kept + 10);
+    CHECK(profiler.Average("Batch") == 0.5);
+
+    profiler.Clear();
+    CHECK(profiler.Count() == 0);
+    CHECK(!profiler.Last("Batch", last));
+    CHECK(profiler.Average("Batch") == 0.0);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestTrace()
+{
+    double now = 0.0;
+    Profiler profiler([&] { return now; });
+
+    // faixa da CPU: a thread de teste é registrada pelo profiler
+    ProfileMark mark = profiler.BeginCpu("Up\"date\\");
+    now = 0.0015;
+    profiler.EndCpu(mark);
+    uint thread = profiler.Range(0).thread;
+
+    ProfileRange gpu = Gpu("Line\nTab\t", 0.001, 0.003);
+    gpu.frame = 7;
+    gpu.hasStats = true;
+    gpu.vertices = 300;
+    gpu.primitives = 100;
+    gpu.pixels = 4096;
+    profiler.Add(gpu);
+
+    string trace = profiler.ChromeTrace();
+    auto has = [&](const string & text) { return trace.find(text) != string::npos; };
+
+    // aspas, barras e caracteres de controle escapados
+    CHECK(has("\"name\":\"Up\\\"date\\\\\""));
+    CHECK(has("\"name\":\"Line\\u000aTab\\u0009\""));
+    CHECK(trace.find('\n', trace.find("Line")) > trace.find("Tab"));
+
+    // tempos em microssegundos, GPU na thread 0 e CPU na thread + 1
+    string cpuTid = "\"tid\":" + std::to_string(thread + 1);
+    CHECK(has(cpuTid + ",\"ts\":0.000,\"dur\":1500.000,\"args\":{\"frame\":0}}"));
+    CHECK(has("\"tid\":0,\"ts\":1000.000,\"dur\":2000.000,\"args\":{\"frame\":7,"
+              "\"vertices\":300,\"primitives\":100,\"pixels\":4096}}"));
+
+    // nomes das threads para o visualizador
+    CHECK(has("\"tid\":0,\"args\":{\"name\":\"GPU\"}"));
+    CHECK(has(cpuTid + ",\"args\":{\"name\":\"CPU " + std::to_string(thread) + "\"}"));
+    CHECK(trace.rfind("{\"traceEvents\":[", 0) == 0);
+    CHECK(trace.size() > 4 && trace.compare(trace.size() - 4, 4, "\n]}\n") == 0);
+
+    // histórico vazio ainda produz um trace válido
+    profiler.Clear();
+    string empty = profiler.ChromeTrace();
+    CHECK(empty.rfind("{\"traceEvents\":[\n{\"name\":\"thread_name\"", 0) == 0);
+
+    // o arquivo gravado é o mesmo trace
+    profiler.Add(gpu);
+    const char * file = "ProfilerTest.json";
+    CHECK(profiler.Export(file));
+    std::ifstream fin(file);
+    std::stringstream saved;
+    saved << fin.rdbuf();
+    fin.close();
+    CHECK(saved.str() == profiler.ChromeTrace());
+    std::remove(file);
+
+    CHECK(!profiler.Export("ProfilerTest.missing/Trace.json"));
+}
+
+// -------------------------------------------------------------------------------
+
+// custo de registrar uma faixa da CPU com o relógio real
+static void BenchRanges()
+{
+    Profiler profiler;
+    const uint ranges = 100000;
+
+    double end = Best(5, [&]
+    {
+        for (uint i = 0; i < ranges; ++i)
+            profiler.EndCpu(profiler.BeginCpu("Range"));
+    });
+
+    ProfileRange range = Gpu("Gpu", 0.0, 1.0);
+    double add = Best(5, [&]
+    {
+        for (uint i = 0; i < ranges; ++i)
+            profiler.Add(range);
+    });
+
+    double trace = Best(5, [&] { profiler.ChromeTrace(); });
+
+    printf("Faixa da CPU: %.1f ns  Add: %.1f ns  trace de 4096 faixas: %.2f ms\n",
+        end / ranges * 1e9, add / ranges * 1e9, trace * 1000.0);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestTimeline();
+    TestGpuTime();
+    TestHistory();
+    TestTrace();
+
+    if (Bench(argc, argv))
+        BenchRanges();
+
+    return Result("ProfilerTest");
+}
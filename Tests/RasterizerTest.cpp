@@ -0,0 +1,565 @@
+/**********************************************************************************
+// RasterizerTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica o rasterizador por software: malhas que cobrem a
+//              tela deixam cada pixel com exatamente um triângulo (sem
+//              buracos nem sobreposição nas arestas compartilhadas), teste
+//              de profundidade, descarte de costas, recorte no plano
+//              próximo, preenchimento em arame, imagens iguais com qualquer
+//              número de threads e arquivos PNG e PPM válidos. Com --bench
+//              mede triângulos por segundo e a escala com as threads nos
+//              modelos do Multi.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "Rasterizer.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+static const uint White = 0xffffffffu;
+static const uint Black = 0xff000000u;
+
+// matriz identidade: posições já estão em espaço de recorte
+static XMFLOAT4X4 Identity()
+{
+    XMFLOAT4X4 m = {};
+    m.m[0][0] = m.m[1][1] = m.m[2][2] = m.m[3][3] = 1.0f;
+    return m;
+}
+
+static Vertex Point(float x, float y, float z = 0.5f, XMFLOAT4 color = XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f))
+{
+    Vertex v;
+    v.pos = XMFLOAT3(x, y, z);
+    v.color = color;
+    return v;
+}
+
+static RasterDraw Draw(const Geometry & geometry, uint first = 0, uint count = 0)
+{
+    RasterDraw draw;
+    draw.vertices = geometry.vertices.data();
+    draw.indices = geometry.indices.data();
+    draw.indexCount = count ? count : geometry.IndexCount();
+    draw.startIndex = first;
+    draw.baseVertex = 0;
+    draw.worldViewProj = Identity();
+    return draw;
+}
+
+// pixels com a cor dada
+static uint Count(const Rasterizer & r, uint color)
+{
+    uint count = 0;
+    for (uint y = 0; y < r.Height(); ++y)
+        for (uint x = 0; x < r.Width(); ++x)
+            count += r.Pixel(x, y) == color;
+    return count;
+}
+
+// -------------------------------------------------------------------------------
+
+// grade de side x side células cobrindo o volume de visão: vértices internos
+// deslocados por jitter (em frações de célula) e metade das células com a
+// diagonal invertida
+static Geometry Mesh(uint side, float jitter)
+{
+    Geometry mesh;
+    uint seed = 12345;
+    auto random = [&] { seed = seed * 1664525u + 1013904223u; return float(seed >> 8) / 16777216.0f - 0.5f; };
+
+    float cell = 2.0f / side;
+    for (uint j = 0; j <= side; ++j)
+        for (uint i = 0; i <= side; ++i)
+        {
+            bool border = i == 0 || j == 0 || i == side || j == side;
+            float dx = border ? 0.0f : random() * jitter * cell;
+            float dy = border ? 0.0f : random() * jitter * cell;
+            mesh.vertices.push_back(Point(-1.0f + i * cell + dx, -1.0f + j * cell + dy));
+        }
+
+    for (uint j = 0; j < side; ++j)
+        for (uint i = 0; i < side; ++i)
+        {
+            uint a = j * (side + 1) + i, b = a + 1, c = a + side + 1, d = c + 1;
+            if ((i + j) % 2)
+                mesh.indices.insert(mesh.indices.end(), { a, c, b, b, c, d });
+            else
+                mesh.indices.insert(mesh.indices.end(), { a, c, d, a, d, b });
+        }
+
+    return mesh;
+}
+
+// leque de triângulos finos em volta de um ponto fora da grade de pixels
+static Geometry Fan(uint count)
+{
+    Geometry fan;
+    fan.vertices.push_back(Point(0.0123f, -0.0371f));
+    for (uint i = 0; i <= count; ++i)
+    {
+        float t = float(i) / count * 8.0f;
+        float x = t < 2 ? -1.0f + t : t < 4 ? 1.0f : t < 6 ? 1.0f - (t - 4) : -1.0f;
+        float y = t < 2 ? -1.0f : t < 4 ? -1.0f + (t - 2) : t < 6 ? 1.0f : 1.0f - (t - 6);
+        fan.vertices.push_back(Point(x, y));
+    }
+    for (uint i = 1; i <= count; ++i)
+        fan.indices.insert(fan.indices.end(), { 0, i, i + 1 });
+    return fan;
+}
+
+// -------------------------------------------------------------------------------
+
+// cada pixel coberto por exatamente um triângulo da malha
+static bool Watertight(const Geometry & mesh, uint width, uint height)
+{
+    Rasterizer r(width, height, 1);
+    r.Cull(false);
+    vector<uint> coverage(size_t(width) * height, 0);
+
+    // um triângulo por vez: a profundidade não esconde sobreposições
+    for (uint t = 0; t < mesh.IndexCount() / 3; ++t)
+    {
+        r.Clear(0.0f, 0.0f, 0.0f);
+        r.Draw(Draw(mesh, t * 3, 3));
+        r.Finish();
+
+        for (uint y = 0; y < height; ++y)
+            for (uint x = 0; x < width; ++x)
+                coverage[size_t(y) * width + x] += r.Pixel(x, y) == White;
+    }
+
+    for (uint c : coverage)
+        if (c != 1)
+            return false;
+    return true;
+}
+
+static void TestWatertight()
+{
+    // vértices sobre cantos de pixels, diagonais passando pelos centros
+    CHECK(Watertight(Mesh(8, 0.0f), 128, 128));
+
+    // vértices em posições quaisquer e imagem que não é múltipla do bloco
+    CHECK(Watertight(Mesh(8, 0.9f), 131, 77));
+    CHECK(Watertight(Mesh(5, 0.7f), 200, 150));
+
+    // muitas arestas encontrando um mesmo vértice
+    CHECK(Watertight(Fan(48), 96, 96));
+
+    // a malha inteira de uma vez cobre toda a tela
+    Geometry mesh = Mesh(16, 0.8f);
+    Rasterizer r(160, 90);
+    r.Cull(false);
+    r.Clear(0.0f, 0.0f, 0.0f);
+    r.Draw(Draw(mesh));
+    r.Finish();
+    CHECK(Count(r, White) == 160u * 90u);
+    CHECK(r.Triangles() == mesh.IndexCount() / 3);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestDepthAndCull()
+{
+    const XMFLOAT4 red(1.0f, 0.0f, 0.0f, 1.0f), blue(0.0f, 0.0f, 1.0f, 1.0f);
+
+    // dois triângulos sobrepostos: o mais próximo vence em qualquer ordem
+    Geometry pair;
+    pair.vertices = {
+        Point(-0.8f, -0.8f, 0.3f, red), Point(-0.8f, 0.8f, 0.3f, red), Point(0.8f, -0.8f, 0.3f, red),
+        Point(-0.6f, -0.6f, 0.6f, blue), Point(-0.6f, 0.9f, 0.6f, blue), Point(0.9f, -0.6f, 0.6f, blue) };
+    pair.indices = { 0, 1, 2, 3, 4, 5 };
+
+    for (bool reversed : { false, true })
+    {
+        Rasterizer r(64, 64);
+        r.Cull(false);
+        r.Clear(0.0f, 0.0f, 0.0f);
+        r.Draw(Draw(pair, reversed ? 3 : 0, 3));
+        r.Draw(Draw(pair, reversed ? 0 : 3, 3));
+        r.Finish();
+        CHECK(r.Pixel(16, 40) == 0xff0000ffu);      // vermelho à frente
+        CHECK(r.Pixel(38, 32) == 0xffff0000u);      // azul onde está sozinho
+    }
+
+    // só um dos dois sentidos sobrevive ao descarte de costas
+    Geometry back;
+    back.vertices = { Point(-0.5f, -0.5f), Point(-0.5f, 0.5f), Point(0.5f, -0.5f) };
+    back.indices = { 0, 1, 2, 0, 2, 1 };
+
+    uint drawn[2];
+    for (uint i = 0; i < 2; ++i)
+    {
+        Rasterizer r(32, 32);
+        r.Clear(0.0f, 0.0f, 0.0f);
+        r.Draw(Draw(back, i * 3, 3));
+        r.Finish();
+        drawn[i] = Count(r, White);
+    }
+    CHECK((drawn[0] == 0) != (drawn[1] == 0));
+    CHECK(drawn[0] + drawn[1] > 100);
+
+    // profundidade fora de [0, 1] é descartada
+    Geometry far;
+    far.vertices = { Point(-1.0f, -1.0f, 1.5f), Point(-1.0f, 1.0f, 1.5f), Point(1.0f, -1.0f, 1.5f) };
+    far.indices = { 0, 1, 2 };
+    Rasterizer r(32, 32);
+    r.Cull(false);
+    r.Clear(0.0f, 0.0f, 0.0f);
+    r.Draw(Draw(far));
+    r.Finish();
+    CHECK(Count(r, White) == 0 && r.Triangles() == 0);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestClipping()
+{
+    // triângulo atravessando o plano próximo em perspectiva: a parte
+    // da frente é desenhada e a de trás da câmera não gera lixo na tela
+    XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(90.0f), 1.0f, 1.0f, 100.0f);
+    Geometry tri;
+    tri.vertices = { Point(-2.0f, -1.0f, 5.0f), Point(0.0f, -1.0f, -5.0f), Point(2.0f, -1.0f, 5.0f) };
+    tri.indices = { 0, 1, 2 };
+
+    RasterDraw draw = Draw(tri);
+    XMStoreFloat4x4(&draw.worldViewProj, XMMatrixTranspose(proj));
+
+    Rasterizer r(64, 64);
+    r.Cull(false);
+    r.Clear(0.0f, 0.0f, 0.0f);
+    r.Draw(draw);
+    r.Finish();
+
+    // chão visto de cima para baixo: só a metade de baixo da tela
+    uint top = 0, bottom = 0;
+    for (uint y = 0; y < 64; ++y)
+        for (uint x = 0; x < 64; ++x)
+            (y < 32 ? top : bottom) += r.Pixel(x, y) == White;
+    CHECK(top == 0 && bottom > 200);
+    CHECK(r.Triangles() >= 1);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestWireframe()
+{
+    Geometry quad;
+    quad.vertices = { Point(-0.9f, -0.9f), Point(-0.9f, 0.9f), Point(0.9f, 0.9f), Point(0.9f, -0.9f) };
+    quad.indices = { 0, 1, 2, 0, 2, 3 };
+
+    Rasterizer solid(100, 100), wire(100, 100);
+    for (Rasterizer * r : { &solid, &wire })
+    {
+        r->Cull(false);
+        r->Fill(r == &wire ? RASTER_WIREFRAME : RASTER_SOLID);
+        r->Clear(0.0f, 0.0f, 0.0f);
+        r->Draw(Draw(quad));
+        r->Finish();
+    }
+
+    // arame: bordas e diagonal desenhadas, interior vazio
+    CHECK(solid.Pixel(75, 45) == White);
+    CHECK(wire.Pixel(75, 45) == Black);
+    CHECK(wire.Pixel(5, 50) == White && wire.Pixel(94, 50) == White);
+    CHECK(wire.Pixel(50, 50) == White);
+
+    // todo pixel em arame também está no sólido, e são bem menos
+    uint wirePixels = 0;
+    bool subset = true;
+    for (uint y = 0; y < 100; ++y)
+        for (uint x = 0; x < 100; ++x)
+            if (wire.Pixel(x, y) == White)
+            {
+                ++wirePixels;
+                subset = subset && solid.Pixel(x, y) == White;
+            }
+    CHECK(subset);
+    CHECK(wirePixels > 4 * 80 && wirePixels < Count(solid, White) / 4);
+}
+
+// -------------------------------------------------------------------------------
+
+// cena com vários modelos em perspectiva
+static void Scene(Rasterizer & r, const vector<Geometry> & models, uint instances)
+{
+    XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0.0f, 6.0f, -14.0f, 1.0f),
+        XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+    XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), float(r.Width()) / r.Height(), 1.0f, 100.0f);
+
+    uint side = 1;
+    while (side * side < instances)
+        ++side;
+
+    for (uint i = 0; i < instances; ++i)
+    {
+        const Geometry & model = models[i % models.size()];
+        XMMATRIX world = XMMatrixScaling(0.8f, 0.8f, 0.8f) * XMMatrixRotationY(0.7f * i)
+            * XMMatrixTranslation(2.5f * (float(i % side) - side * 0.5f), 0.0f, 2.5f * float(i / side));
+
+        RasterDraw draw = Draw(model);
+        XMStoreFloat4x4(&draw.worldViewProj, XMMatrixTranspose(world * view * proj));
+        r.Draw(draw);
+    }
+}
+
+static vector<Geometry> Models3D()
+{
+    vector<Geometry> models;
+    for (const char * name : Models)
+    {
+        Geometry model = LoadModel(name);
+        if (!model.vertices.empty())
+            models.push_back(model);
+    }
+    return models;
+}
+
+// mesma imagem com qualquer número de threads
+static void TestThreads()
+{
+    vector<Geometry> models = Models3D();
+    CHECK(!models.empty());
+    if (models.empty())
+        return;
+
+    vector<uint> reference[2];
+    for (uint threads : { 1u, 2u, 3u, 8u })
+    {
+        for (uint fill : { uint(RASTER_SOLID), uint(RASTER_WIREFRAME) })
+        {
+            Rasterizer r(320, 180, threads);
+            r.Fill(fill);
+            r.Clear(0.1f, 0.2f, 0.3f);
+            Scene(r, models, 20);
+            r.Finish();
+
+            vector<uint> image;
+            for (uint y = 0; y < r.Height(); ++y)
+                for (uint x = 0; x < r.Width(); ++x)
+                    image.push_back(r.Pixel(x, y));
+
+            // primeira execução de cada preenchimento é a referência
+            if (threads == 1)
+                reference[fill] = image;
+            else
+                CHECK(image == reference[fill]);
+
+            CHECK(r.Threads() == threads);
+        }
+    }
+
+}
+
+// -------------------------------------------------------------------------------
+
+// leitura mínima de PNG com blocos deflate armazenados
+static bool ReadPng(const char * file, uint & width, uint & height, vector<byte> & rgb)
+{
+    std::ifstream fin(file, std::ios::binary);
+    vector<byte> data((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+
+    const byte signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    if (data.size() < 8 || !std::equal(signature, signature + 8, data.begin()))
+        return false;
+
+    auto big = [&](size_t at) { return uint(data[at]) << 24 | uint(data[at + 1]) << 16 | uint(data[at + 2]) << 8 | data[at + 3]; };
+
+    // CRC-32 de cada bloco
+    auto crc = [&](size_t at, size_t size)
+    {
+        uint c = 0xffffffffu;
+        for (size_t i = at; i < at + size; ++i)
+        {
+            c ^= data[i];
+            for (uint k = 0; k < 8; ++k)
+                c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        }
+        return c ^ 0xffffffffu;
+    };
+
+    vector<byte> zlib;
+    bool ended = false;
+    for (size_t at = 8; at + 12 <= data.size() && !ended; )
+    {
+        uint size = big(at);
+        string type(data.begin() + at + 4, data.begin() + at + 8);
+        if (at + 12 + size > data.size() || crc(at + 4, size + 4) != big(at + 8 + size))
+            return false;
+
+        if (type == "IHDR")
+        {
+            width = big(at + 8);
+            height = big(at + 12);
+            if (size != 13 || data[at + 16] != 8 || data[at + 17] != 2)
+                return false;
+        }
+        else if (type == "IDAT")
+            zlib.insert(zlib.end(), data.begin() + at + 8, data.begin() + at + 8 + size);
+        else if (type == "IEND")
+            ended = true;
+
+        at += 12 + size;
+    }
+
+    // cabeçalho zlib, blocos armazenados e Adler-32
+    if (!ended || zlib.size() < 6 || (zlib[0] * 256 + zlib[1]) % 31 != 0 || (zlib[0] & 0x0f) != 8)
+        return false;
+
+    vector<byte> raw;
+    size_t at = 2;
+    for (bool last = false; !last; )
+    {
+        if (at + 5 > zlib.size() || (zlib[at] & 6) != 0)
+            return false;
+        last = zlib[at] & 1;
+        uint length = zlib[at + 1] | zlib[at + 2] << 8;
+        uint inverse = zlib[at + 3] | zlib[at + 4] << 8;
+        if ((length ^ 0xffff) != inverse || at + 5 + length > zlib.size())
+            return false;
+        raw.insert(raw.end(), zlib.begin() + at + 5, zlib.begin() + at + 5 + length);
+        at += 5 + length;
+    }
+
+    uint s1 = 1, s2 = 0;
+    for (byte b : raw)
+    {
+        s1 = (s1 + b) % 65521;
+        s2 = (s2 + s1) % 65521;
+    }
+    if (at + 4 != zlib.size() || (uint(zlib[at]) << 24 | uint(zlib[at + 1]) << 16 | uint(zlib[at + 2]) << 8 | zlib[at + 3]) != (s2 << 16 | s1))
+        return false;
+
+    // linhas com filtro nulo
+    if (raw.size() != size_t(width * 3 + 1) * height)
+        return false;
+
+    rgb.clear();
+    for (uint y = 0; y < height; ++y)
+    {
+        const byte * line = &raw[size_t(width * 3 + 1) * y];
+        if (line[0] != 0)
+            return false;
+        rgb.insert(rgb.end(), line + 1, line + 1 + width * 3);
+    }
+    return true;
+}
+
+static void TestSave()
+{
+    // imagem maior que um bloco deflate (65535 bytes) e largura ímpar
+    Geometry mesh = Mesh(6, 0.8f);
+    for (uint i = 0; i < mesh.vertices.size(); ++i)
+        mesh.vertices[i].color = XMFLOAT4((i % 7) / 6.0f, (i % 5) / 4.0f, (i % 3) / 2.0f, 1.0f);
+
+    Rasterizer r(257, 131);
+    r.Cull(false);
+    r.Clear(0.0f, 0.0f, 0.0f);
+    r.Draw(Draw(mesh));
+    r.Finish();
+
+    vector<byte> expected;
+    for (uint y = 0; y < r.Height(); ++y)
+        for (uint x = 0; x < r.Width(); ++x)
+        {
+            uint p = r.Pixel(x, y);
+            expected.insert(expected.end(), { byte(p), byte(p >> 8), byte(p >> 16) });
+        }
+
+    const char * png = "RasterizerTest.png";
+    uint width = 0, height = 0;
+    vector<byte> rgb;
+    CHECK(r.Save(png));
+    CHECK(ReadPng(png, width, height, rgb));
+    CHECK(width == 257 && height == 131 && rgb == expected);
+    std::remove(png);
+
+    // PPM binário: cabeçalho seguido das linhas RGB
+    const char * ppm = "RasterizerTest.ppm";
+    CHECK(r.Save(ppm));
+    std::ifstream fin(ppm, std::ios::binary);
+    string magic;
+    uint w = 0, h = 0, max = 0;
+    fin >> magic >> w >> h >> max;
+    fin.get();
+    vector<byte> pixels((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+    fin.close();
+    CHECK(magic == "P6" && w == 257 && h == 131 && max == 255);
+    CHECK(pixels == expected);
+    std::remove(ppm);
+
+    CHECK(!r.Save("RasterizerTest.missing/image.png"));
+}
+
+// -------------------------------------------------------------------------------
+
+// triângulos por segundo na cena dos modelos do Multi com 1 a N threads
+static void BenchScene()
+{
+    vector<Geometry> models = Models3D();
+    if (models.empty())
+        return;
+
+    uint cores = std::max(1u, std::thread::hardware_concurrency());
+    double single = 0.0;
+
+    for (uint threads = 1; threads <= std::max(8u, cores); threads *= 2)
+    {
+        double ms[2], rate[2];
+        for (uint fill : { uint(RASTER_SOLID), uint(RASTER_WIREFRAME) })
+        {
+            Rasterizer r(1280, 720, threads);
+            r.Fill(fill);
+
+            ullong before = 0;
+            double best = Best(5, [&]
+            {
+                before = r.Triangles();
+                r.Clear(0.0f, 0.0f, 0.0f);
+                Scene(r, models, 100);
+                r.Finish();
+            });
+            ms[fill] = best * 1000.0;
+            rate[fill] = (r.Triangles() - before) / best;
+        }
+
+        if (threads == 1)
+            single = rate[RASTER_SOLID];
+
+        printf("%u threads: sólido %6.2f ms %6.2f M triângulos/s (%.2fx)  arame %6.2f ms %6.2f M triângulos/s\n",
+            threads, ms[RASTER_SOLID], rate[RASTER_SOLID] / 1e6, rate[RASTER_SOLID] / single,
+            ms[RASTER_WIREFRAME], rate[RASTER_WIREFRAME] / 1e6);
+    }
+    printf("(%u núcleos disponíveis)\n", cores);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestWatertight();
+    TestDepthAndCull();
+    TestClipping();
+    TestWireframe();
+    TestThreads();
+    TestSave();
+
+    if (Bench(argc, argv))
+        BenchScene();
+
+    return Result("RasterizerTest");
+}
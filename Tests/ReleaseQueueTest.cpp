@@ -0,0 +1,150 @@
+/**********************************************************************************
+// ReleaseQueueTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica a fila de liberação adiada usada por Graphics: um
+//              objeto só é liberado depois que as barreiras da fila de
+//              desenho e da fila de cópia passam do seu último uso, e os
+//              recursos vivos ficam limitados durante uma edição intensa.
+//              Com --bench mede o custo de Collect com milhares de objetos.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "ReleaseQueue.h"
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// objeto liberado: registra a ordem das liberações
+struct Resource
+{
+    uint id;
+    vector<uint> * released;
+};
+
+static void Release(Resource r)
+{
+    r.released->push_back(r.id);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestFences()
+{
+    ReleaseQueue<Resource> queue;
+    vector<uint> released;
+
+    queue.Track(1000);
+    queue.Track(500);
+    queue.Track(250);
+    CHECK(queue.Live() == 3 && queue.LiveBytes() == 1750);
+
+    // usado até a barreira 2; usado por uma cópia do lote 3; heap não contabilizado
+    queue.Retire({ 1, &released }, 2, 0, 1000);
+    queue.Retire({ 2, &released }, 2, 3, 500);
+    queue.Retire({ 3, &released }, 1);
+    CHECK(queue.Pending() == 3);
+
+    // nenhuma barreira alcançada
+    CHECK(queue.Collect(0, 0, Release) == 0);
+    CHECK(released.empty());
+
+    // só o heap
+    CHECK(queue.Collect(1, 0, Release) == 1);
+    CHECK(released == vector<uint>{ 3 });
+    CHECK(queue.Live() == 3 && queue.LiveBytes() == 1750);
+
+    // a fila de desenho passou, mas o lote de cópia não: 2 fica
+    CHECK(queue.Collect(2, 2, Release) == 1);
+    CHECK(released == (vector<uint>{ 3, 1 }));
+    CHECK(queue.Live() == 2 && queue.LiveBytes() == 750);
+
+    CHECK(queue.Collect(2, 3, Release) == 1);
+    CHECK(released == (vector<uint>{ 3, 1, 2 }));
+    CHECK(queue.Live() == 1 && queue.LiveBytes() == 250);
+    CHECK(queue.Pending() == 0);
+}
+
+// -------------------------------------------------------------------------------
+
+// edição intensa: cada quadro troca a malha de muitos objetos sem
+// esperar a GPU; a memória viva fica limitada pela latência das barreiras
+static void TestChurn()
+{
+    ReleaseQueue<Resource> queue;
+    vector<uint> released;
+
+    const uint Objects = 100;
+    const uint Lag = 2;                 // quadros que a GPU está atrás da CPU
+    const ullong Bytes = 65536;
+
+    for (uint i = 0; i < Objects; ++i)
+        queue.Track(Bytes);
+
+    uint maxLive = 0;
+    for (ullong frame = 1; frame <= 1000; ++frame)
+    {
+        // metade dos objetos troca de malha; a antiga foi usada neste quadro
+        for (uint i = 0; i < Objects / 2; ++i)
+        {
+            queue.Retire({ i, &released }, frame, frame % 3 ? 0 : frame, Bytes);
+            queue.Track(Bytes);
+        }
+
+        ullong completed = frame > Lag ? frame - Lag : 0;
+        queue.Collect(completed, completed, Release);
+        maxLive = queue.Live() > maxLive ? queue.Live() : maxLive;
+    }
+
+    // vivos = objetos + trocas de (Lag + 1) quadros aguardando
+    CHECK(maxLive <= Objects + (Lag + 1) * Objects / 2);
+    CHECK(queue.Pending() <= (Lag + 1) * Objects / 2);
+    CHECK(queue.LiveBytes() == queue.Live() * Bytes);
+
+    // depois que a GPU alcança a CPU restam só os objetos da cena
+    queue.Collect(~0ull, ~0ull, Release);
+    CHECK(queue.Live() == Objects);
+    CHECK(queue.Pending() == 0);
+    CHECK(released.size() == 1000 * Objects / 2);
+}
+
+// -------------------------------------------------------------------------------
+
+// Collect com muitos objetos pendentes e poucos prontos
+static void BenchCollect()
+{
+    for (uint pending : { 1000u, 10000u, 100000u })
+    {
+        ReleaseQueue<Resource> queue;
+        vector<uint> released;
+
+        for (uint i = 0; i < pending; ++i)
+        {
+            queue.Track(1);
+            queue.Retire({ i, &released }, 10 + i, 0, 1);
+        }
+
+        double best = Best(20, [&] { queue.Collect(5, 5, Release); });
+        double all = Best(1, [&] { queue.Collect(~0ull, ~0ull, Release); });
+        printf("Collect com %u pendentes: %.3f ms sem liberar, %.3f ms liberando todos\n",
+            pending, best * 1000.0, all * 1000.0);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestFences();
+    TestChurn();
+
+    if (Bench(argc, argv))
+        BenchCollect();
+
+    return Result("ReleaseQueueTest");
+}
@@ -0,0 +1,188 @@
+/**********************************************************************************
+// SceneTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Roda a parte da CPU de uma cena fora do Windows: lê os
+//              modelos do Multi, gera as formas da biblioteca e atualiza
+//              as matrizes de milhares de objetos por quadro. Com --bench
+//              mede leitura, geração e o tempo de CPU de cada quadro.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include "Timer.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// índices formam triângulos e apontam para vértices existentes
+static bool Valid(const Geometry & geometry)
+{
+    if (geometry.vertices.empty() || geometry.indices.empty() || geometry.IndexCount() % 3)
+        return false;
+
+    for (uint index : geometry.indices)
+        if (index >= geometry.VertexCount())
+            return false;
+
+    return true;
+}
+
+// -------------------------------------------------------------------------------
+
+// objeto da cena: geometria, posição e rotação
+struct SceneObject
+{
+    uint geometry;
+    XMFLOAT3 position;
+    float angle;
+    float speed;
+    XMFLOAT4X4 wvp;
+};
+
+// cena de objetos girando diante de uma câmera fixa
+class Scene
+{
+private:
+    vector<SceneObject> objects;
+    XMFLOAT4X4 viewProj;
+
+public:
+    Scene(uint count, uint geometries)
+    {
+        // grade de objetos com velocidades diferentes
+        uint side = uint(std::ceil(std::sqrt(double(count))));
+        for (uint i = 0; i < count; ++i)
+        {
+            SceneObject obj = {};
+            obj.geometry = i % geometries;
+            obj.position = XMFLOAT3(float(i % side) - side * 0.5f, 0.0f, float(i / side));
+            obj.speed = 0.5f + (i % 7) * 0.25f;
+            objects.push_back(obj);
+        }
+
+        XMMATRIX view = XMMatrixLookAtLH(XMVectorSet(0.0f, 10.0f, -20.0f, 1.0f),
+            XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+        XMMATRIX proj = XMMatrixPerspectiveFovLH(XMConvertToRadians(45.0f), 16.0f / 9.0f, 1.0f, 1000.0f);
+        XMStoreFloat4x4(&viewProj, view * proj);
+    }
+
+    // avança a rotação e recalcula a matriz de cada objeto
+    void Update(float dt)
+    {
+        XMMATRIX vp = XMLoadFloat4x4(&viewProj);
+        for (SceneObject & obj : objects)
+        {
+            obj.angle += obj.speed * dt;
+            XMMATRIX world = XMMatrixScaling(0.4f, 0.4f, 0.4f) * XMMatrixRotationY(obj.angle)
+                * XMMatrixTranslation(obj.position.x, obj.position.y, obj.position.z);
+            XMStoreFloat4x4(&obj.wvp, XMMatrixTranspose(world * vp));
+        }
+    }
+
+    // todas as matrizes são finitas
+    bool Finite() const
+    {
+        for (const SceneObject & obj : objects)
+            for (int i = 0; i < 4; ++i)
+                for (int j = 0; j < 4; ++j)
+                    if (!std::isfinite(obj.wvp.m[i][j]))
+                        return false;
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------
+
+static vector<Geometry> Shapes()
+{
+    vector<Geometry> shapes;
+    shapes.push_back(Box(2.0f, 2.0f, 2.0f));
+    shapes.push_back(Cylinder(1.0f, 0.5f, 3.0f, 20, 10));
+    shapes.push_back(Sphere(1.0f, 20, 20));
+    shapes.push_back(GeoSphere(1.0f, 3));
+    shapes.push_back(Grid(100.0f, 20.0f, 20, 20));
+    shapes.push_back(Quad(2.0f, 1.0f));
+    return shapes;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestScene()
+{
+    // modelos lidos do disco
+    for (const char * name : Models)
+    {
+        Geometry model = LoadModel(name);
+        CHECK(Valid(model));
+    }
+
+    // formas geradas
+    vector<Geometry> shapes = Shapes();
+    for (const Geometry & shape : shapes)
+        CHECK(Valid(shape));
+
+    // alguns quadros da cena
+    Scene scene(1000, uint(shapes.size()));
+    for (int frame = 0; frame < 10; ++frame)
+        scene.Update(1.0f / 60.0f);
+    CHECK(scene.Finite());
+}
+
+// -------------------------------------------------------------------------------
+
+static void Benchmark()
+{
+    // leitura dos modelos
+    for (const char * name : Models)
+    {
+        Geometry model;
+        double load = Best(5, [&] { model = LoadModel(name); });
+        printf("%-12s %7u triângulos  leitura %7.2f ms\n", name, model.IndexCount() / 3, load * 1000.0);
+    }
+
+    // geração das formas
+    double generate = Best(20, [] { Shapes(); });
+    printf("formas da biblioteca: %.3f ms\n", generate * 1000.0);
+
+    // tempo de CPU de cada quadro da cena
+    for (uint count : { 1000u, 10000u, 100000u })
+    {
+        Scene scene(count, 6);
+        const uint Frames = 300;
+        vector<double> times;
+        Timer timer;
+
+        for (uint frame = 0; frame < Frames; ++frame)
+        {
+            timer.Start();
+            scene.Update(1.0f / 60.0f);
+            times.push_back(timer.Elapsed());
+        }
+
+        std::sort(times.begin(), times.end());
+        printf("cena com %6u objetos: P50 %.3f ms  P99 %.3f ms  (%.1f M objetos/s)\n", count,
+            times[Frames / 2] * 1000.0, times[Frames * 99 / 100] * 1000.0, count / times[Frames / 2] / 1e6);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestScene();
+
+    if (Bench(argc, argv))
+        Benchmark();
+
+    return Result("SceneTest");
+}
+
+// -------------------------------------------------------------------------------
@@ -0,0 +1,225 @@
+/**********************************************************************************
+// SimplifyTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica os níveis de detalhe de Geometry::Simplify: cada
+//              nível fica nos mesmos buffers, tem menos triângulos que o
+//              anterior, usa apenas vértices existentes, não abre buracos
+//              em malhas fechadas e fica perto da superfície original.
+//              Verifica também a escolha do nível por tamanho na tela.
+//              Com --bench mede a simplificação dos modelos do Multi e os
+//              triângulos desenhados por quadro com e sem níveis.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Models.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// índices do nível formam triângulos de vértices existentes
+static bool Valid(const Geometry & geometry, const LevelOfDetail & lod)
+{
+    if (lod.indexCount == 0 || lod.indexCount % 3 || lod.startIndex + lod.indexCount > geometry.IndexCount())
+        return false;
+
+    for (uint i = lod.startIndex; i < lod.startIndex + lod.indexCount; ++i)
+        if (geometry.indices[i] >= geometry.VertexCount())
+            return false;
+
+    return true;
+}
+
+// arestas do nível (vértices unidos pela posição) que não têm exatamente duas faces
+static uint OpenEdges(const Geometry & geometry, const LevelOfDetail & lod)
+{
+    std::map<std::tuple<float, float, float>, uint> weld;
+    vector<uint> id(geometry.VertexCount());
+    for (uint i = 0; i < geometry.VertexCount(); ++i)
+    {
+        const XMFLOAT3 & p = geometry.vertices[i].pos;
+        id[i] = weld.emplace(std::make_tuple(p.x, p.y, p.z), uint(weld.size())).first->second;
+    }
+
+    std::map<std::pair<uint, uint>, uint> edges;
+    for (uint i = lod.startIndex; i < lod.startIndex + lod.indexCount; i += 3)
+        for (uint k = 0; k < 3; ++k)
+        {
+            uint a = id[geometry.indices[i + k]], b = id[geometry.indices[i + (k + 1) % 3]];
+            ++edges[{ std::min(a, b), std::max(a, b) }];
+        }
+
+    uint open = 0;
+    for (const auto & edge : edges)
+        open += edge.second != 2;
+    return open;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestLevels()
+{
+    // icosaedro subdividido: fechado e com os vértices compartilhados
+    GeoSphere sphere(1.0f, 3);
+    uint original = sphere.IndexCount();
+    sphere.Simplify(4, 0.5f);
+
+    // o original continua no início dos índices
+    CHECK(sphere.lods.size() == 5);
+    CHECK(sphere.lods[0].startIndex == 0 && sphere.lods[0].indexCount == original);
+    CHECK(sphere.lods[0].error == 0.0f);
+    CHECK(sphere.OriginalCount() == original);
+
+    for (uint level = 1; level < sphere.lods.size(); ++level)
+    {
+        const LevelOfDetail & lod = sphere.lods[level];
+        const LevelOfDetail & prev = sphere.lods[level - 1];
+
+        // níveis em sequência nos mesmos buffers, cada um com metade dos triângulos
+        CHECK(Valid(sphere, lod));
+        CHECK(lod.startIndex == prev.startIndex + prev.indexCount);
+        CHECK(lod.indexCount < prev.indexCount);
+        CHECK(lod.indexCount / 3 <= uint(original / 3 * std::pow(0.5f, float(level))));
+        CHECK(lod.error >= prev.error);
+
+        // a esfera fechada continua fechada
+        CHECK(OpenEdges(sphere, lod) == 0);
+
+        // centros dos triângulos perto da superfície: o desvio estimado
+        // cobre a distância até a superfície (mais a do próprio original)
+        float worst = 0.0f;
+        for (uint i = lod.startIndex; i < lod.startIndex + lod.indexCount; i += 3)
+        {
+            XMVECTOR c = XMVectorZero();
+            for (uint k = 0; k < 3; ++k)
+                c = XMVectorAdd(c, XMLoadFloat3(&sphere.vertices[sphere.indices[i + k]].pos));
+            float r = std::sqrt(XMVectorGetX(XMVector3LengthSq(c))) / 3.0f;
+            worst = std::max(worst, 1.0f - r);
+        }
+        CHECK(worst <= lod.error + 0.005f);
+    }
+
+    // simplificar de novo recomeça do original
+    vector<uint> indices = sphere.indices;
+    sphere.Simplify(4, 0.5f);
+    CHECK(sphere.indices == indices);
+    sphere.Simplify(0);
+    CHECK(sphere.lods.size() == 1 && sphere.IndexCount() == original);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestModels()
+{
+    for (const char * name : Models)
+    {
+        Geometry model = LoadModel(name);
+        CHECK(!model.indices.empty());
+        if (model.indices.empty())
+            continue;
+
+        uint open = OpenEdges(model, { 0, model.IndexCount(), 0.0f });
+        model.Simplify(3, 0.5f);
+        CHECK(model.lods.size() >= 2);
+
+        for (uint level = 1; level < model.lods.size(); ++level)
+        {
+            CHECK(Valid(model, model.lods[level]));
+            CHECK(model.lods[level].indexCount < model.lods[level - 1].indexCount);
+
+            // malhas fechadas não ganham buracos
+            CHECK(open != 0 || OpenEdges(model, model.lods[level]) == 0);
+        }
+    }
+
+    // níveis descartam os grupos e as arestas do original
+    Sphere sphere(1.0f, 20, 20);
+    sphere.Clusterize();
+    sphere.ExtractEdges();
+    sphere.Simplify(2);
+    CHECK(sphere.meshlets.empty() && sphere.edges.indexCount == 0);
+    CHECK(sphere.lods[0].indexCount == Sphere(1.0f, 20, 20).IndexCount());
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestSelect()
+{
+    Geometry geometry;
+    geometry.lods = { { 0, 300, 0.0f }, { 300, 150, 0.01f }, { 450, 75, 0.02f }, { 525, 36, 0.04f } };
+
+    // perto da câmera: original; longe: o nível mais simples
+    CHECK(geometry.Select(0, 1000.0f, 1.0f) == 0);
+    CHECK(geometry.Select(3, 1000.0f, 1.0f) == 0);
+    CHECK(geometry.Select(0, 1.0f, 1.0f) == 3);
+
+    // desvio do nível 2 em 1 pixel: fica no nível atual perto do limite
+    CHECK(geometry.Select(1, 50.0f, 1.0f) == 1);
+    CHECK(geometry.Select(2, 50.0f, 1.0f) == 2);
+    CHECK(geometry.Select(2, 51.0f, 1.0f) == 1);
+    CHECK(geometry.Select(1, 37.0f, 1.0f) == 2);
+
+    // sem níveis só existe o original
+    Geometry plain;
+    CHECK(plain.Select(2, 1.0f, 1.0f) == 0);
+}
+
+// -------------------------------------------------------------------------------
+
+// simplificação por segundo e triângulos desenhados com e sem níveis
+static void BenchSimplify()
+{
+    printf("Simplify(5):\n");
+    for (const char * name : Models)
+    {
+        Geometry model = LoadModel(name);
+        uint triangles = model.IndexCount() / 3;
+        double time = Best(3, [&] { model.Simplify(5); });
+        printf("  %-12s %7u triângulos  %7.2f ms  %6.2f Mtri/s  último nível %u\n",
+            name, triangles, time * 1e3, triangles / time * 1e-6, model.lods.back().indexCount / 3);
+    }
+
+    Sphere sphere(1.0f, 512, 512);
+    uint triangles = sphere.IndexCount() / 3;
+    double time = Best(3, [&] { sphere.Simplify(5); });
+    printf("  %-12s %7u triângulos  %7.2f ms  %6.2f Mtri/s\n",
+        "Sphere 512", triangles, time * 1e3, triangles / time * 1e-6);
+
+    // fileira de macacos afastando-se da câmera (90 graus, 1080 linhas)
+    Geometry monkey = LoadModel("monkey.obj");
+    monkey.Simplify(5);
+    float pixelsPerUnit = 0.5f * 1080.0f;
+    ullong full = 0, drawn = 0;
+    for (uint i = 0; i < 200; ++i)
+    {
+        float distance = 2.0f + i * 0.5f;
+        uint level = monkey.Select(0, pixelsPerUnit / distance, 1.0f);
+        full += monkey.lods[0].indexCount / 3;
+        drawn += monkey.lods[level].indexCount / 3;
+    }
+    printf("Triângulos por quadro (200 macacos de 2 a 102 unidades): %llu sem níveis, %llu com níveis (%.1f%%)\n",
+        full, drawn, 100.0 * drawn / full);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestLevels();
+    TestModels();
+    TestSelect();
+
+    if (Bench(argc, argv))
+        BenchSimplify();
+
+    return Result("SimplifyTest");
+}
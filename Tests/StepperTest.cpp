@@ -0,0 +1,237 @@
+/**********************************************************************************
+// StepperTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica o acumulador dos passos fixos da Engine: o número de
+//              passos e o estado simulado não dependem da taxa de quadros,
+//              a posição interpolada anda na mesma velocidade a 30 ou 240
+//              quadros por segundo, quadros longos executam no máximo o
+//              limite de passos e descartam o resto do atraso. Com --bench
+//              mostra os passos por segundo em várias taxas de quadros.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Stepper.h"
+#include <cmath>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// corpo que anda 6 unidades por segundo e gira um pouco a cada passo
+struct Body
+{
+    double previous = 0.0;                  // posição no passo anterior
+    double position = 0.0;                  // posição no passo atual
+    double angle = 0.0;                     // acumula erro de arredondamento
+    uint steps = 0;                         // passos executados
+
+    void Step(double dt)
+    {
+        previous = position;
+        position += 6.0 * dt;
+        angle = std::fmod(angle + 0.1 * std::sin(position), 6.283185307179586);
+        ++steps;
+    }
+
+    double Draw(double t) const
+    { return previous + (position - previous) * t; }
+};
+
+// simula frames quadros de duração dt (jitter alterna quadros curtos e longos)
+static Body Run(Stepper & stepper, uint frames, double dt, double jitter = 0.0)
+{
+    Body body;
+    for (uint i = 0; i < frames; ++i)
+    {
+        double frame = dt + (i % 2 ? jitter : -jitter);
+        stepper.Advance(frame, [&] { body.Step(stepper.Step()); });
+    }
+    return body;
+}
+
+// -------------------------------------------------------------------------------
+
+// mesmo tempo total em taxas diferentes: mesmos passos e mesmo estado
+static void TestDeterminism()
+{
+    const double step = 1.0 / 64.0;
+    struct Rate { uint frames; double dt; double jitter; };
+    const Rate rates[] = {
+        { 32, 1.0 / 32.0, 0.0 },            // 32 fps: dois passos por quadro
+        { 64, 1.0 / 64.0, 0.0 },            // 64 fps: um passo por quadro
+        { 256, 1.0 / 256.0, 0.0 },          // 256 fps: um passo a cada 4 quadros
+        { 128, 1.0 / 128.0, 1.0 / 512.0 },  // 128 fps irregular
+    };
+
+    Stepper reference;
+    reference.Fixed(step);
+    Body expected = Run(reference, 64, step);
+    CHECK(expected.steps == 64);
+
+    for (const Rate & rate : rates)
+    {
+        Stepper stepper;
+        stepper.Fixed(step);
+        Body body = Run(stepper, rate.frames, rate.dt, rate.jitter);
+
+        // estado idêntico bit a bit: os passos não dependem do quadro
+        CHECK(body.steps == expected.steps);
+        CHECK(body.position == expected.position && body.angle == expected.angle);
+        CHECK(stepper.Steps() == 64 && stepper.Skipped() == 0);
+        CHECK(stepper.Interpolation() == 0.0);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+// posição desenhada acompanha o tempo real em qualquer taxa de quadros
+static void TestInterpolation()
+{
+    const double step = 1.0 / 60.0;
+    const double seconds = 2.0;
+
+    for (double fps : { 30.0, 75.0, 144.0, 240.0 })
+    {
+        Stepper stepper;
+        stepper.Fixed(step);
+
+        Body body;
+        uint frames = uint(seconds * fps);
+        bool inside = true, monotonic = true;
+        double last = -1.0;
+
+        for (uint i = 0; i < frames; ++i)
+        {
+            stepper.Advance(1.0 / fps, [&] { body.Step(step); });
+
+            // o desenho fica um passo atrás do tempo real
+            double t = stepper.Interpolation();
+            double drawn = body.Draw(t);
+            inside = inside && t >= 0.0 && t < 1.0;
+            monotonic = monotonic && drawn >= last;
+            last = drawn;
+        }
+
+        double elapsed = frames / fps;
+        CHECK(inside && monotonic);
+        CHECK(std::fabs(last - 6.0 * (elapsed - step)) < 1e-9);
+        CHECK(stepper.Steps() == body.steps);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestCatchUp()
+{
+    const double step = 1.0 / 64.0;
+    Stepper stepper;
+    stepper.Fixed(step, 5);
+
+    Body body;
+    auto fixed = [&] { body.Step(step); };
+
+    // engasgo de um segundo: 5 passos e o resto do atraso descartado
+    CHECK(stepper.Advance(1.0, fixed) == 5);
+    CHECK(stepper.Skipped() == 59);
+    CHECK(stepper.Interpolation() == 0.0);
+
+    // os quadros seguintes voltam ao ritmo normal, sem recuperar o atraso
+    for (uint i = 0; i < 10; ++i)
+        CHECK(stepper.Advance(step, fixed) == 1);
+
+    // atraso com fração: a fração continua no acumulador
+    CHECK(stepper.Advance(10.5 * step, fixed) == 5);
+    CHECK(stepper.Skipped() == 64);
+    CHECK(stepper.Interpolation() == 0.5);
+    CHECK(stepper.Advance(0.5 * step, fixed) == 1);
+    CHECK(stepper.Interpolation() == 0.0);
+
+    CHECK(stepper.Steps() == 21 && body.steps == 21);
+
+    // limite maior recupera mais do atraso por quadro
+    Stepper patient;
+    patient.Fixed(step, 100);
+    CHECK(patient.Advance(1.0, fixed) == 64 && patient.Skipped() == 0);
+
+    // quadros curtos seguidos não executam passo até completar um passo
+    Stepper idle;
+    idle.Fixed(step);
+    CHECK(idle.Advance(step / 3.0, fixed) == 0);
+    CHECK(idle.Advance(step / 3.0, fixed) == 0);
+    CHECK(idle.Interpolation() > 0.6 && idle.Interpolation() < 0.7);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestDisabled()
+{
+    // sem passo fixo: um passo por quadro e nenhuma interpolação
+    Stepper stepper;
+    uint calls = 0;
+    CHECK(stepper.Advance(0.5, [&] { ++calls; }) == 1);
+    CHECK(stepper.Advance(0.001, [&] { ++calls; }) == 1);
+    CHECK(calls == 2 && stepper.Interpolation() == 1.0);
+
+    // trocar o passo descarta o tempo pendente
+    stepper.Fixed(0.1);
+    CHECK(stepper.Advance(0.05, [&] { ++calls; }) == 0);
+    stepper.Fixed(0.1);
+    CHECK(stepper.Advance(0.05, [&] { ++calls; }) == 0);
+    CHECK(stepper.Interpolation() == 0.5);
+
+    stepper.Fixed(0.0);
+    CHECK(stepper.Advance(0.05, [&] { ++calls; }) == 1);
+    CHECK(calls == 3);
+}
+
+// -------------------------------------------------------------------------------
+
+// passos de simulação por segundo: limitados pelo passo fixo, não pela taxa
+static void BenchSteps()
+{
+    printf("Passos por segundo (passo de 1/60 s):\n");
+    for (double fps : { 30.0, 60.0, 144.0, 240.0, 1000.0 })
+    {
+        Stepper fixed, variable;
+        fixed.Fixed(1.0 / 60.0);
+        uint frames = uint(10.0 * fps);
+        for (uint i = 0; i < frames; ++i)
+        {
+            fixed.Advance(1.0 / fps, [] {});
+            variable.Advance(1.0 / fps, [] {});
+        }
+        printf("  %6.0f fps: fixo %5.1f  por quadro %6.1f\n",
+            fps, fixed.Steps() / 10.0, variable.Steps() / 10.0);
+    }
+
+    Stepper stepper;
+    stepper.Fixed(1.0 / 60.0);
+    const uint frames = 1000000;
+    volatile uint sink = 0;
+    double cost = Best(5, [&]
+    {
+        for (uint i = 0; i < frames; ++i)
+            stepper.Advance(1.0 / 144.0, [&] { sink = sink + 1; });
+    });
+    printf("Advance: %.1f ns por quadro\n", cost / frames * 1e9);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestDeterminism();
+    TestInterpolation();
+    TestCatchUp();
+    TestDisabled();
+
+    if (Bench(argc, argv))
+        BenchSteps();
+
+    return Result("StepperTest");
+}
@@ -0,0 +1,237 @@
+/**********************************************************************************
+// TelemetryTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica a telemetria de quadros: percentis de cada etapa,
+//              contagem de engasgos depois do aquecimento, janela circular
+//              de 1024 quadros, exportação em CSV e JSON e leituras feitas
+//              por outra thread enquanto a thread principal grava (nenhum
+//              quadro parcial ou fora de ordem). Com --bench mede o custo
+//              de registrar um quadro, que deve ficar abaixo de 1 us.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "Telemetry.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+using std::string;
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+static const uint Capacity = 1024;
+
+// linhas do CSV exportado (sem o cabeçalho)
+static vector<string> Lines(const Telemetry & telemetry, const char * file)
+{
+    vector<string> lines;
+    if (!telemetry.Export(file))
+        return lines;
+
+    std::ifstream fin(file);
+    string line;
+    std::getline(fin, line);
+    while (std::getline(fin, line))
+        lines.push_back(line);
+    return lines;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestStats()
+{
+    Telemetry telemetry;
+    FrameStats empty = telemetry.Stats();
+    CHECK(empty.frames == 0 && empty.max == 0.0);
+
+    // quadros de 1 a 100 ms fora de ordem: percentis pela posição na ordenação
+    for (uint i = 0; i < 100; ++i)
+    {
+        uint ms = (i * 37) % 100 + 1;
+        telemetry.Add(ms / 1000.0, 0.002, 0.001);
+    }
+
+    FrameStats update = telemetry.Stats(FRAME_UPDATE);
+    CHECK(update.frames == 100);
+    CHECK(update.average == 50.5);
+    CHECK(update.p50 == 50.0 && update.p95 == 95.0 && update.p99 == 99.0);
+    CHECK(update.max == 100.0);
+
+    FrameStats draw = telemetry.Stats(FRAME_DRAW);
+    CHECK(draw.p50 == draw.max && float(draw.max) == 2.0f);
+
+    FrameStats total = telemetry.Stats(FRAME_TOTAL);
+    CHECK(float(total.max) == 103.0f);
+    CHECK(telemetry.Frames() == 100);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestHitches()
+{
+    Telemetry telemetry;
+
+    // picos durante o aquecimento não contam
+    for (uint i = 0; i < 30; ++i)
+        telemetry.Add(i % 10 ? 0.010 : 0.100, 0.0, 0.0);
+    CHECK(telemetry.Hitches() == 0);
+
+    for (uint i = 0; i < 200; ++i)
+        telemetry.Add(0.010, 0.0, 0.0);
+    CHECK(telemetry.Hitches() == 0);
+
+    // acima de duas vezes a média conta, abaixo não
+    telemetry.Add(0.015, 0.0, 0.0);
+    telemetry.Add(0.010, 0.0, 0.0);
+    CHECK(telemetry.Hitches() == 0);
+    telemetry.Add(0.025, 0.0, 0.0);
+    CHECK(telemetry.Hitches() == 1);
+
+    // limite configurável
+    for (uint i = 0; i < 200; ++i)
+        telemetry.Add(0.010, 0.0, 0.0);
+    telemetry.HitchFactor(1.2);
+    telemetry.Add(0.015, 0.0, 0.0);
+    CHECK(telemetry.Hitches() == 2);
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestExport()
+{
+    Telemetry telemetry;
+    const uint total = 1500;
+    for (uint i = 0; i < total; ++i)
+        telemetry.Add((i % 100) / 1000.0, 0.001, 0.0);
+
+    // apenas a janela recente fica, numerada pelo quadro original
+    CHECK(telemetry.Stats().frames == Capacity);
+
+    const char * csv = "TelemetryTest.csv";
+    vector<string> lines = Lines(telemetry, csv);
+    CHECK(lines.size() == Capacity);
+    if (lines.size() == Capacity)
+    {
+        CHECK(lines.front() == std::to_string(total - Capacity) + ",76,1,0,77");
+        CHECK(lines.back() == std::to_string(total - 1) + ",99,1,0,100");
+    }
+    std::remove(csv);
+
+    // JSON com o resumo e um objeto por quadro
+    const char * json = "TelemetryTest.json";
+    CHECK(telemetry.Export(json));
+    std::ifstream fin(json);
+    std::stringstream text;
+    text << fin.rdbuf();
+    fin.close();
+    std::remove(json);
+
+    string s = text.str();
+    CHECK(s.rfind("{\"hitches\":", 0) == 0);
+    CHECK(s.find("\"p50\":") != string::npos && s.find("\"p99\":") != string::npos);
+    CHECK(s.find("{\"frame\":476,\"update\":76,\"draw\":1,\"present\":0,\"total\":77}") != string::npos);
+    CHECK(std::count(s.begin(), s.end(), '\n') == Capacity + 2);
+
+    CHECK(!telemetry.Export("TelemetryTest.missing/Telemetry.csv"));
+}
+
+// -------------------------------------------------------------------------------
+
+// outra thread exporta enquanto a principal grava: cada linha é um quadro
+// completo, as linhas são consecutivas e a numeração confere com os tempos
+static void TestConcurrent()
+{
+    Telemetry telemetry;
+    std::atomic<bool> done{ false };
+
+    std::thread writer([&]
+    {
+        for (uint n = 0; n < 200000; ++n)
+        {
+            double ms = n % 4096;
+            telemetry.Add(ms / 1000.0, 2.0 * ms / 1000.0, 0.0);
+        }
+        done = true;
+    });
+
+    const char * csv = "TelemetryTest.concurrent.csv";
+    bool consistent = true;
+    uint exports = 0;
+
+    while (!done || exports == 0)
+    {
+        vector<string> lines = Lines(telemetry, csv);
+        ++exports;
+
+        llong previous = -1;
+        for (const string & line : lines)
+        {
+            unsigned long long frame;
+            float update, draw, present, total;
+            if (sscanf(line.c_str(), "%llu,%f,%f,%f,%f", &frame, &update, &draw, &present, &total) != 5)
+            {
+                consistent = false;
+                break;
+            }
+
+            bool whole = update == float(frame % 4096) && draw == 2.0f * update && total == 3.0f * update;
+            bool next = previous < 0 || frame == ullong(previous) + 1;
+            consistent = consistent && whole && next;
+            previous = llong(frame);
+        }
+    }
+
+    writer.join();
+    std::remove(csv);
+
+    CHECK(consistent);
+    CHECK(telemetry.Frames() == 200000);
+}
+
+// -------------------------------------------------------------------------------
+
+// custo por quadro: registrar e, uma vez por segundo, calcular os percentis
+static void BenchAdd()
+{
+    Telemetry telemetry;
+    const uint frames = 1000000;
+
+    double add = Best(5, [&]
+    {
+        for (uint i = 0; i < frames; ++i)
+            telemetry.Add(0.004, 0.006, 0.001 + (i & 7) * 1e-5);
+    });
+
+    double stats = Best(20, [&] { telemetry.Stats(); });
+    double perFrame = add / frames;
+
+    printf("Add: %.1f ns por quadro  Stats: %.1f us (%.1f ns por quadro a 60 Hz)\n",
+        perFrame * 1e9, stats * 1e6, stats / 60.0 * 1e9);
+
+    CHECK(perFrame + stats / 60.0 < 1e-6);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestStats();
+    TestHitches();
+    TestExport();
+    TestConcurrent();
+
+    if (Bench(argc, argv))
+        BenchAdd();
+
+    return Result("TelemetryTest");
+}
@@ -0,0 +1,72 @@
+/**********************************************************************************
+// Test (Arquivo de Cabeçalho)
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verificações e medições usadas pelos testes do motor. Cada
+//              teste é um executável: sem argumentos roda as verificações
+//              e com --bench roda também as medições de desempenho.
+//
+**********************************************************************************/
+
+#ifndef DXUT_TEST_H_
+#define DXUT_TEST_H_
+
+// -------------------------------------------------------------------------------
+
+#include "Types.h"
+#include "Clock.h"
+#include <cstdio>
+#include <cstring>
+
+// -------------------------------------------------------------------------------
+
+// número de verificações que falharam
+inline int & Failures()
+{
+    static int failures = 0;
+    return failures;
+}
+
+// verifica uma condição e mostra onde ela falhou
+#define CHECK(cond) \
+    ((cond) ? (void)0 : (void)(++Failures(), printf("%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond)))
+
+// -------------------------------------------------------------------------------
+
+// medições pedidas na linha de comando (--bench)
+inline bool Bench(int argc, char ** argv)
+{
+    for (int i = 1; i < argc; ++i)
+        if (strcmp(argv[i], "--bench") == 0)
+            return true;
+    return false;
+}
+
+// menor tempo em segundos entre várias execuções de func
+template<class Func>
+double Best(uint repeats, Func func)
+{
+    double best = 1e30;
+    for (uint i = 0; i < repeats; ++i)
+    {
+        double start = Clock::Seconds();
+        func();
+        double elapsed = Clock::Seconds() - start;
+        best = elapsed < best ? elapsed : best;
+    }
+    return best;
+}
+
+// mostra o resultado e retorna o código de saída do teste
+inline int Result(const char * name)
+{
+    printf("%s: %s\n", name, Failures() ? "FALHOU" : "ok");
+    return Failures() ? 1 : 0;
+}
+
+// -------------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,166 @@
+/**********************************************************************************
+// ThreadPoolTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica a divisão do trabalho do ThreadPool usado pela
+//              gravação paralela de comandos: cada elemento é visitado uma
+//              vez, os blocos são contíguos e em ordem e o mesmo conjunto de
+//              threads atende trabalhos seguidos. Trabalhos disparados com o
+//              conjunto ocupado, de outras threads ou de dentro de um bloco,
+//              executam inteiros na thread atual. Com --bench mede o custo de
+//              disparar um trabalho (a gravação de 10 mil e 100 mil desenhos
+//              fica no HeadlessTest).
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+using std::vector;
+
+// -------------------------------------------------------------------------------
+
+// cada elemento visitado uma vez e cada bloco cobre sua faixa contígua
+static bool Covers(ThreadPool & pool, uint chunks, uint count)
+{
+    vector<std::atomic<uint>> visits(count);
+    vector<uint> firsts(chunks, ~0u), lasts(chunks, ~0u);
+
+    pool.Run(chunks, count, [&](uint chunk, uint first, uint last)
+    {
+        firsts[chunk] = first;
+        lasts[chunk] = last;
+        for (uint i = first; i < last; ++i)
+            ++visits[i];
+    });
+
+    for (uint i = 0; i < count; ++i)
+        if (visits[i] != 1)
+            return false;
+
+    // blocos em ordem: o fim de um é o início do seguinte
+    for (uint c = 0; c < chunks; ++c)
+    {
+        if (firsts[c] > lasts[c])
+            return false;
+        if (c > 0 && firsts[c] != lasts[c - 1])
+            return false;
+    }
+
+    return firsts[0] == 0 && lasts[chunks - 1] == count;
+}
+
+// -------------------------------------------------------------------------------
+
+static void TestCoverage()
+{
+    // mais threads que núcleos também precisa funcionar
+    for (uint threads : { 1u, 2u, 4u, 8u })
+    {
+        ThreadPool pool(threads);
+        CHECK(pool.Size() == threads);
+
+        CHECK(Covers(pool, 1, 1000));
+        CHECK(Covers(pool, threads, 1000));
+        CHECK(Covers(pool, 8, 100003));
+        CHECK(Covers(pool, 7, 5));          // mais blocos que elementos
+        CHECK(Covers(pool, 3, 0));          // blocos vazios
+    }
+
+    // sem blocos nada é executado
+    ThreadPool pool(4);
+    bool called = false;
+    pool.Run(0, 100, [&](uint, uint, uint) { called = true; });
+    CHECK(!called);
+}
+
+// -------------------------------------------------------------------------------
+
+// trabalhos seguidos reutilizam as threads sem perder blocos
+static void TestReuse()
+{
+    ThreadPool pool(4);
+    std::atomic<ullong> total{ 0 };
+
+    for (uint run = 0; run < 2000; ++run)
+        pool.Run(4, 256, [&](uint, uint first, uint last) { total += last - first; });
+
+    CHECK(total == 2000ull * 256);
+}
+
+// -------------------------------------------------------------------------------
+
+// conjunto ocupado: o trabalho executa na thread que o disparou
+static void TestBusy()
+{
+    ThreadPool & shared = ThreadPool::Shared();
+    CHECK(&shared == &ThreadPool::Shared());
+
+    // trabalhos disparados de dentro de um bloco
+    ThreadPool pool(4);
+    std::atomic<uint> inner{ 0 };
+    std::atomic<uint> wrong{ 0 };
+    pool.Run(4, 4, [&](uint, uint, uint)
+    {
+        std::thread::id self = std::this_thread::get_id();
+        wrong += !Covers(pool, 8, 1000);
+        pool.Run(3, 30, [&](uint, uint first, uint last)
+        {
+            inner += last - first;
+            wrong += std::this_thread::get_id() != self;
+        });
+    });
+    CHECK(inner == 4 * 30 && wrong == 0);
+
+    // várias threads disparando no conjunto compartilhado ao mesmo tempo
+    vector<std::thread> callers;
+    for (uint t = 0; t < 4; ++t)
+        callers.emplace_back([&]
+        {
+            for (uint run = 0; run < 500; ++run)
+                wrong += !Covers(shared, 8, 1000 + run);
+        });
+    for (std::thread & t : callers)
+        t.join();
+    CHECK(wrong == 0);
+
+    // livre de novo, o conjunto volta a usar as threads
+    CHECK(Covers(shared, shared.Size() * 4, 100003));
+}
+
+// -------------------------------------------------------------------------------
+
+// custo de disparar e concluir um trabalho vazio
+static void BenchRun()
+{
+    for (uint threads : { 2u, 4u, 8u })
+    {
+        ThreadPool pool(threads);
+        const uint runs = 10000;
+        double best = Best(5, [&]
+        {
+            for (uint i = 0; i < runs; ++i)
+                pool.Run(threads, threads, [](uint, uint, uint) {});
+        });
+        printf("Disparo com %u threads: %.2f us por trabalho\n", threads, best / runs * 1e6);
+    }
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestCoverage();
+    TestReuse();
+    TestBusy();
+
+    if (Bench(argc, argv))
+        BenchRun();
+
+    return Result("ThreadPoolTest");
+}
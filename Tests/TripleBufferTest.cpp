@@ -0,0 +1,175 @@
+/**********************************************************************************
+// TripleBufferTest
+//
+// Criação:     19 Out 2026
+// Atualização: 19 Out 2026
+// Compilador:  Visual C++ 2022
+//
+// Descrição:   Verifica a troca de cenas entre Update e a thread de desenho:
+//              a consumidora recebe sempre a publicação mais recente, nunca
+//              uma anterior à já lida, e nunca uma cópia que a produtora
+//              está preenchendo. O teste de estresse troca um milhão de
+//              cenas entre duas threads; compilado com DXUT_SANITIZE=thread
+//              o ThreadSanitizer aponta qualquer acesso concorrente. Com
+//              --bench mede o custo de publicar e adquirir.
+//
+**********************************************************************************/
+
+#include "Test.h"
+#include "TripleBuffer.h"
+#include <atomic>
+#include <thread>
+
+// -------------------------------------------------------------------------------
+
+// cena com número de sequência e conteúdo derivado dele
+struct Snapshot
+{
+    static const uint Size = 64;
+    ullong sequence;
+    uint values[Size];
+
+    void Fill(ullong seq)
+    {
+        sequence = seq;
+        for (uint i = 0; i < Size; ++i)
+            values[i] = uint(seq * 2654435761u + i);
+    }
+
+    bool Whole() const
+    {
+        for (uint i = 0; i < Size; ++i)
+            if (values[i] != uint(sequence * 2654435761u + i))
+                return false;
+        return true;
+    }
+};
+
+// -------------------------------------------------------------------------------
+
+static void TestOrder()
+{
+    TripleBuffer<Snapshot> buffer;
+
+    // nada publicado ainda
+    CHECK(!buffer.Acquire());
+
+    buffer.Write().Fill(1);
+    buffer.Publish();
+    CHECK(buffer.Acquire());
+    CHECK(buffer.Read().sequence == 1);
+    CHECK(!buffer.Acquire());
+    CHECK(buffer.Read().sequence == 1);
+
+    // publicações não lidas são substituídas pela mais recente
+    for (ullong seq = 2; seq <= 5; ++seq)
+    {
+        buffer.Write().Fill(seq);
+        buffer.Publish();
+    }
+    CHECK(buffer.Acquire());
+    CHECK(buffer.Read().sequence == 5 && buffer.Read().Whole());
+
+    // a produtora nunca recebe a cópia que a consumidora está lendo
+    const Snapshot * reading = &buffer.Read();
+    for (ullong seq = 6; seq < 20; ++seq)
+    {
+        CHECK(&buffer.Write() != reading);
+        buffer.Write().Fill(seq);
+        buffer.Publish();
+    }
+    CHECK(buffer.Read().sequence == 5);
+    CHECK(buffer.Acquire() && buffer.Read().sequence == 19);
+}
+
+// -------------------------------------------------------------------------------
+
+// produtora e consumidora em threads separadas
+static void TestStress()
+{
+    TripleBuffer<Snapshot> buffer;
+    const ullong publishes = 1000000;
+    std::atomic<bool> done{ false };
+
+    std::thread producer([&]
+    {
+        for (ullong seq = 1; seq <= publishes; ++seq)
+        {
+            buffer.Write().Fill(seq);
+            buffer.Publish();
+        }
+        done = true;
+    });
+
+    ullong last = 0, acquired = 0;
+    bool whole = true, newer = true;
+
+    for (;;)
+    {
+        bool finished = done;
+        if (buffer.Acquire())
+        {
+            const Snapshot & s = buffer.Read();
+            whole = whole && s.Whole();
+            newer = newer && s.sequence > last;
+            last = s.sequence;
+            ++acquired;
+        }
+        else if (finished)
+        {
+            break;
+        }
+    }
+
+    producer.join();
+
+    CHECK(whole && newer);
+    CHECK(acquired > 0);
+
+    // a última publicação sempre chega
+    CHECK(last == publishes);
+}
+
+// -------------------------------------------------------------------------------
+
+// custo de publicar e de adquirir uma cena pequena
+static void BenchSwap()
+{
+    TripleBuffer<Snapshot> buffer;
+    const uint swaps = 1000000;
+
+    double publish = Best(5, [&]
+    {
+        for (uint i = 0; i < swaps; ++i)
+        {
+            buffer.Write().sequence = i;
+            buffer.Publish();
+        }
+    });
+
+    double both = Best(5, [&]
+    {
+        for (uint i = 0; i < swaps; ++i)
+        {
+            buffer.Write().sequence = i;
+            buffer.Publish();
+            buffer.Acquire();
+        }
+    });
+
+    printf("Publish: %.1f ns  Publish + Acquire: %.1f ns\n",
+        publish / swaps * 1e9, both / swaps * 1e9);
+}
+
+// -------------------------------------------------------------------------------
+
+int main(int argc, char ** argv)
+{
+    TestOrder();
+    TestStress();
+
+    if (Bench(argc, argv))
+        BenchSwap();
+
+    return Result("TripleBufferTest");
+}